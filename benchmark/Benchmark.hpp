@@ -0,0 +1,58 @@
+/**
+ * @file Benchmark.hpp
+ * @brief Minimal timing helpers shared by the headless benchmarks.
+ *
+ * The benchmarks do not need the game engine: they drive the model library directly and
+ * print their results on the standard output.
+ */
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * @struct BenchmarkResult
+ * @brief The outcome of a timed benchmark run.
+ */
+struct BenchmarkResult {
+    std::string name; ///< The name of the benchmark.
+    long iterations; ///< The number of iterations run.
+    double seconds; ///< The total wall time of the run, in seconds.
+
+    /**
+     * @brief Retrieves the average time of one iteration.
+     * @return The time per iteration, in microseconds.
+     */
+    [[nodiscard]] double microsecondsPerIteration() const {
+        return seconds * 1e6 / static_cast<double>(iterations);
+    }
+};
+
+/**
+ * @brief Runs a function a number of times and measures the total wall time.
+ * @param name The name of the benchmark.
+ * @param iterations The number of iterations to run.
+ * @param function The function to run, receiving the iteration index.
+ * @return The result of the run.
+ */
+template<typename Function>
+BenchmarkResult measure(const std::string&name, const long iterations, Function&&function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i) {
+        function(i);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return {name, iterations, std::chrono::duration<double>(end - start).count()};
+}
+
+/**
+ * @brief Prints a benchmark result on the standard output.
+ * @param result The result to print.
+ */
+inline void report(const BenchmarkResult&result) {
+    std::cout << result.name << ": " << result.iterations << " iterations, "
+              << result.microsecondsPerIteration() << " us/iteration, "
+              << static_cast<double>(result.iterations) / result.seconds << " iterations/s" << std::endl;
+}
+#endif //BENCHMARK_HPP
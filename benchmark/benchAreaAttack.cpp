@@ -0,0 +1,84 @@
+/**
+ * @file benchAreaAttack.cpp
+ * @brief Measures an area attack hitting 1,000 enemies, resolved in one pass or one hit at a time.
+ */
+#include "Benchmark.hpp"
+#include "Level.hpp"
+#include <cmath>
+#include <numbers>
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNT = 1000; ///< Number of enemies within the area.
+    constexpr long ATTACKS = 2000; ///< Number of area attacks resolved by each run.
+    constexpr AreaOfEffect AREA{CIRCLE, 4.0, 0.5}; ///< Area of the attack.
+    constexpr int DAMAGE = 0; ///< Damage of the attack, none so that every enemy stays alive.
+
+    /**
+     * @brief Builds a level with one ready spawn point per enemy.
+     * @return The loaded level.
+     */
+    Level buildLevel() {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = ENEMY_COUNT / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {0, areas};
+    }
+}
+
+int main() {
+    Level level = buildLevel();
+    const auto ids = level.spawnReady(std::chrono::steady_clock::now(), ENEMY_COUNT, 1.0);
+    const Vector2D center{Level::AREA_SIZE * 1.5, Level::AREA_SIZE * 1.5};
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> angle(0.0, 2 * std::numbers::pi);
+    std::uniform_real_distribution<> distance(0.0, AREA.radius * 0.99);
+    for (const int id: ids) {
+        const double a = angle(gen);
+        const double d = distance(gen);
+        level.setEnemyPosition(id, {center.x + d * std::cos(a), center.y + d * std::sin(a)});
+    }
+
+    long hit = 0;
+    std::vector<AreaHit> hits;
+    DamageBuffer buffer;
+    std::vector<DamageResult> results;
+    const auto batched = measure("Area attack resolved in one pass, 1000 enemies", ATTACKS, [&](long) {
+        level.findEnemiesInArea(center, 1, AREA, DAMAGE, hits);
+        for (const AreaHit&areaHit: hits) {
+            buffer.push({-1, areaHit.characterId, areaHit.damage});
+        }
+        results.clear();
+        level.resolveEnemyHits(buffer.sortByTarget(), results);
+        buffer.clear();
+        hit += static_cast<long>(results.size());
+    });
+    report(batched);
+
+    // One call per enemy, as a caller without area attacks would do: validate the ID, look the enemy up
+    // to test the area, then hurt it through its ID.
+    const auto perEnemy = measure("Area attack resolved one enemy at a time, 1000 enemies", ATTACKS, [&](long) {
+        for (const int id: level.getEnemyIds()) {
+            if (!level.isAValidEnemyId(id)) {
+                continue;
+            }
+            const Vector2D position = level.getEnemy(id).getPosition();
+            if (AREA.contains({position.x - center.x, position.y - center.y}, 1)) {
+                level.hurtEnemy(id, AREA.damageAt(DAMAGE, std::sqrt(position.squaredDistanceTo(center))));
+                ++hit;
+            }
+        }
+    });
+    report(perEnemy);
+    std::cout << "hit " << hit << " enemies over " << ids.size() << " enemies" << std::endl;
+    return 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file benchCooldowns.cpp
+ * @brief Measures the readiness of every capability of 10,000 enemies, polled one object at a time or packed into bitmasks.
+ */
+#include "Benchmark.hpp"
+#include "CooldownTable.hpp"
+#include "Enemies.hpp"
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNT = 10000; ///< Number of enemies.
+    constexpr long TICKS = 600; ///< Ten simulated seconds at 60 ticks per second.
+    constexpr long POLLED_TICKS = 60; ///< One simulated second, polling being much slower.
+}
+
+int main() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<> pick(0, DefinedEnemies::size() - 1);
+    std::bernoulli_distribution uses(0.5);
+    std::vector<Enemy> enemies;
+    enemies.reserve(ENEMY_COUNT);
+    for (int i = 0; i < ENEMY_COUNT; ++i) {
+        enemies.push_back(DefinedEnemies::get(static_cast<Enemies>(pick(gen))).enemy);
+        for (const std::string&attack: enemies.back().getAllAttackName()) {
+            if (uses(gen) && enemies.back().canUse(attack)) {
+                enemies.back().attack(attack);
+            }
+        }
+    }
+    const std::vector<std::string> movements{"RUN", "JUMP", "DASH", "JETPACK", "CLIMB"};
+
+    long ready = 0;
+    const auto polled = measure("canUse + canMove of every capability, 10000 enemies", POLLED_TICKS, [&](long) {
+        for (const Enemy&enemy: enemies) {
+            for (const std::string&attack: enemy.getAllAttackName()) {
+                ready += enemy.canUse(attack);
+            }
+            for (const std::string&movement: movements) {
+                ready += enemy.canMove(movement);
+            }
+        }
+    });
+    report(polled);
+
+    const auto start = std::chrono::steady_clock::now();
+    CooldownTable table(start);
+    for (std::size_t slot = 0; slot < enemies.size(); ++slot) {
+        table.update(slot, enemies[slot], start);
+    }
+    const auto masked = measure("CooldownTable::computeMasks, 10000 enemies", TICKS, [&](const long tick) {
+        table.computeMasks(start + std::chrono::milliseconds(tick * 1000 / 60));
+        ready += table.getMask(static_cast<std::size_t>(tick) % ENEMY_COUNT);
+    });
+    report(masked);
+    std::cout << "checksum " << ready << std::endl;
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file benchEnemyAI.cpp
+ * @brief Measures the ticks per second of the enemy AI against the number of enemies, in one pass or
+ * one enemy at a time, and the decision pass alone across worker threads.
+ */
+#include "Benchmark.hpp"
+#include "EnemyAI.hpp"
+#include "Level.hpp"
+#include <cmath>
+#include <random>
+#include <thread>
+
+namespace {
+    constexpr int ENEMY_COUNTS[] = {1000, 10000, 100000}; ///< Numbers of enemies of the levels.
+    constexpr std::size_t DECISION_COUNT = 4000000; ///< Number of enemies of the decision pass alone.
+    constexpr long TICKS = 60; ///< One simulated second at 60 ticks per second.
+
+    /**
+     * @brief Builds a level with one ready spawn point per enemy.
+     * @param enemyCount The number of enemies.
+     * @return The loaded level.
+     */
+    Level buildLevel(const int enemyCount) {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = enemyCount / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {0, areas};
+    }
+
+    /**
+     * @brief Runs both AI loops on a level.
+     * @param enemyCount The number of enemies of the level.
+     * @param target The position of the player.
+     * @param checksum Accumulates the attacks and run inputs, so that the work is not optimized away.
+     */
+    void benchLevel(const int enemyCount, const Vector2D&target, double&checksum) {
+        Level level = buildLevel(enemyCount);
+        const auto ids = level.spawnReady(std::chrono::steady_clock::now(), enemyCount, 1.0);
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<> offset(-30.0, 30.0);
+        for (const int id: ids) {
+            level.setEnemyPosition(id, {target.x + offset(gen), target.y + offset(gen) / 10});
+        }
+        const std::string count = std::to_string(ids.size());
+
+        EnemyAI ai(std::max(1u, std::thread::hardware_concurrency()));
+        EnemyPerception perception;
+        EnemyCommands commands;
+        const auto batched = measure("AI tick in one pass, " + count + " enemies", TICKS, [&](long) {
+            level.updateReadiness(std::chrono::steady_clock::now());
+            perception.clear();
+            level.gatherEnemyPerception(perception, std::span(&target, 1), [](int) { return false; });
+            ai.decide(perception, target, commands);
+            level.applyEnemyRunInputs(perception, commands);
+            for (std::size_t i = 0; i < perception.size(); ++i) {
+                if (commands.attacks[i] >= 0) {
+                    checksum += level.attackEnemy(perception.ids[i], DefinedAttacks::getAttackName(commands.attacks[i]));
+                }
+            }
+        });
+        report(batched);
+
+        // The calls an engine makes through the C API: the ranges and the readiness of each enemy, then its command.
+        const auto perEnemy = measure("AI tick one enemy at a time, " + count + " enemies", TICKS, [&](long) {
+            for (const int id: level.getEnemyIds()) {
+                if (!level.isAValidEnemyId(id)) {
+                    continue;
+                }
+                const Enemy enemy = level.getEnemy(id);
+                const double distance = std::sqrt(enemy.getPosition().squaredDistanceTo(target));
+                if (distance <= enemy.getAttackRange()) {
+                    level.setEnemyRunInput(id, 0.0);
+                    for (const std::string&attack: enemy.getAllAttackName()) {
+                        if (level.getEnemy(id).canUse(attack)) {
+                            checksum += level.attackEnemy(id, attack);
+                            break;
+                        }
+                    }
+                }
+                else if (distance <= enemy.getFollowRange()) {
+                    level.setEnemyRunInput(id, target.x >= enemy.getPosition().x ? 1.0 : -1.0);
+                }
+                else {
+                    level.setEnemyRunInput(id, 0.0);
+                }
+            }
+        });
+        report(perEnemy);
+    }
+}
+
+int main() {
+    const Vector2D target{Level::AREA_SIZE * 1.5, Level::AREA_SIZE * 1.5};
+    double checksum = 0.0;
+    for (const int enemyCount: ENEMY_COUNTS) {
+        benchLevel(enemyCount, target, checksum);
+    }
+
+    // The decision pass alone, whose rows are independent, on one thread then on every hardware thread.
+    EnemyPerception perception;
+    perception.reserve(DECISION_COUNT);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> offset(-30.0, 30.0);
+    for (std::size_t i = 0; i < DECISION_COUNT; ++i) {
+        perception.add(static_cast<int>(i), {target.x + offset(gen), target.y + offset(gen)}, 20.0, 2.0,
+                       static_cast<int>(i % 2) - 1);
+    }
+    EnemyCommands commands;
+    const std::string count = std::to_string(DECISION_COUNT);
+    for (const unsigned workers: {1u, std::max(1u, std::thread::hardware_concurrency())}) {
+        const EnemyAI ai(workers);
+        const auto result = measure("EnemyAI::decide, " + count + " enemies, " + std::to_string(workers) + " threads",
+                                    TICKS, [&](const long tick) {
+                                        ai.decide(perception, target, commands);
+                                        checksum += commands.runInputs[static_cast<std::size_t>(tick)];
+                                    });
+        report(result);
+    }
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
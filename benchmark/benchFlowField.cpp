@@ -0,0 +1,93 @@
+/**
+ * @file benchFlowField.cpp
+ * @brief Measures 5,000 enemies chasing one player through a level of 64 by 64 areas.
+ */
+#include "Benchmark.hpp"
+#include "Level.hpp"
+#include <random>
+
+namespace {
+    constexpr int AREAS = 64; ///< Number of areas along each axis.
+    constexpr int ENEMY_COUNT = 5000; ///< Number of enemies chasing the player.
+    constexpr double FILL_PROBABILITY = 0.1; ///< Probability of an area being filled, so that paths wind.
+    constexpr long TICKS = 60 * 60; ///< One simulated minute at 60 ticks per second.
+    constexpr double PLAYER_SPEED = 0.5; ///< Distance walked by the player per tick, crossing an area every second.
+
+    /**
+     * @brief Builds a large grid of crossroad areas, some of them filled, with spawn points for the enemies.
+     * @return The areas, indexed by x then y.
+     */
+    std::vector<std::vector<Area>> buildAreas() {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<> fill(0.0, 1.0);
+        const int spawnsPerArea = ENEMY_COUNT / (AREAS * AREAS) + 1;
+        std::vector<Spawn> spawns;
+        for (int id = 1; id <= spawnsPerArea; ++id) {
+            spawns.emplace_back(id, 1, 10);
+        }
+        std::vector<std::vector<Area>> areas(AREAS);
+        for (int x = 0; x < AREAS; ++x) {
+            for (int y = 0; y < AREAS; ++y) {
+                if (fill(gen) < FILL_PROBABILITY && (x > 0 || y > 0)) {
+                    areas[x].emplace_back(0, 1, std::set<Direction2D>{});
+                }
+                else {
+                    areas[x].emplace_back(40, 1, std::set<Direction2D>{
+                                              Direction::UP, Direction::RIGHT, Direction::DOWN, Direction::LEFT
+                                          }, spawns);
+                }
+            }
+        }
+        return areas;
+    }
+}
+
+int main() {
+    const auto areas = buildAreas();
+    NavigationGraph navigation(areas);
+    const TileMap map(areas, Level::AREA_TILES);
+    const double worldSize = map.getWidth();
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> coordinate(0.0, worldSize);
+    std::vector<Vector2D> positions;
+    positions.reserve(ENEMY_COUNT);
+    for (int i = 0; i < ENEMY_COUNT; ++i) {
+        positions.push_back({coordinate(gen), coordinate(gen)});
+    }
+
+    FlowField field;
+    std::vector<Vector2D> directions;
+    double sum = 0.0;
+    const auto chase = measure("FlowField update + 5000 directions, player crossing an area per second", TICKS,
+                               [&](const long tick) {
+                                   const Vector2D player{3.0 + PLAYER_SPEED * static_cast<double>(tick), 3.0};
+                                   field.update(navigation, map, player);
+                                   field.getDirections(positions, directions);
+                                   sum += directions.front().x;
+                               });
+    report(chase);
+    std::cout << field.getRebuildCount() << " rebuilds over " << TICKS << " ticks" << std::endl;
+
+    std::uniform_int_distribution<> area(0, AREAS - 1);
+    const auto rebuild = measure("FlowField rebuild toward a random area, 64x64 areas", 500, [&](long) {
+        const Vector2D player{(area(gen) + 0.5) * Level::AREA_SIZE, (area(gen) + 0.5) * Level::AREA_SIZE};
+        field.update(navigation, map, player);
+    });
+    report(rebuild);
+
+    Level level(0, areas);
+    const auto ids = level.spawnReady(std::chrono::steady_clock::now(), ENEMY_COUNT, 1.0);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        level.setEnemyPosition(ids[i], positions[i]);
+    }
+    std::vector<int> chasers;
+    long found = 0;
+    const auto inRange = measure("Level::getChaseDirections, 5000 enemies", TICKS, [&](const long tick) {
+        const Vector2D player{3.0 + PLAYER_SPEED * static_cast<double>(tick), worldSize / 2};
+        level.getChaseDirections(player, chasers, directions);
+        found += static_cast<long>(chasers.size());
+    });
+    report(inRange);
+    std::cout << "found " << found << " chasers, checksum " << sum << std::endl;
+    return 0;
+}
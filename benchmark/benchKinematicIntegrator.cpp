@@ -0,0 +1,63 @@
+/**
+ * @file benchKinematicIntegrator.cpp
+ * @brief Measures the fixed-step integration of 10,000 characters.
+ */
+#include "Benchmark.hpp"
+#include "KinematicIntegrator.hpp"
+#include "Level.hpp"
+#include <random>
+
+namespace {
+    constexpr int BODY_COUNT = 10000; ///< Number of integrated characters.
+    constexpr long TICKS = 60 * 60; ///< One simulated minute at 60 ticks per second.
+
+    /**
+     * @brief Builds a level with one ready spawn point per character.
+     * @return The loaded level.
+     */
+    Level buildLevel() {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = BODY_COUNT / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {0, areas};
+    }
+}
+
+int main() {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> height(0.0, 20.0);
+    std::uniform_real_distribution<> speed(-4.0, 4.0);
+    KinematicIntegrator integrator;
+    KinematicBodies bodies;
+    bodies.reserve(BODY_COUNT);
+    for (int id = 0; id < BODY_COUNT; ++id) {
+        bodies.add(id, {0.0, height(gen)}, {speed(gen), speed(gen)}, {0.0, id % 4 == 0 ? 5.0 : 0.0}, 1.0, 0.0);
+    }
+    report(measure("KinematicIntegrator::step, 10000 bodies", TICKS, [&](long) {
+        integrator.step(bodies);
+    }));
+
+    Level level = buildLevel();
+    const auto ids = level.spawnReady(std::chrono::steady_clock::now(), BODY_COUNT, 1.0);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        level.setEnemyRunInput(ids[i], i % 2 == 0 ? 1.0 : -1.0);
+    }
+    KinematicBodies enemies;
+    report(measure("Level gather + step + scatter, 10000 enemies", TICKS / 10, [&](long) {
+        enemies.clear();
+        level.gatherEnemyBodies(enemies, std::chrono::steady_clock::now());
+        integrator.step(enemies);
+        level.scatterEnemyBodies(enemies, 0);
+    }));
+    std::cout << "integrated " << bodies.size() << " bodies and " << ids.size() << " enemies" << std::endl;
+    return 0;
+}
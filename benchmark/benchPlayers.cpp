@@ -0,0 +1,62 @@
+/**
+ * @file benchPlayers.cpp
+ * @brief Measures the cost of a physics tick of a game against its number of players, the enemy AI
+ * choosing its target among them.
+ */
+#include "Benchmark.hpp"
+#include "Game.hpp"
+#include <random>
+
+namespace {
+    constexpr std::size_t PLAYER_COUNTS[] = {1, 2, 4, 8, 16}; ///< Numbers of players of the sessions.
+    constexpr long TICKS = 600; ///< Ten simulated seconds at 60 ticks per second.
+    constexpr double TICK_SECONDS = 1.0 / 60.0; ///< Duration of a tick.
+
+    /**
+     * @brief Spawns every enemy the level of a game allows right now.
+     * @param game The game.
+     * @return The IDs of the enemies.
+     */
+    std::vector<int> spawnEnemies(Game&game) {
+        std::vector<int> ids;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                for (int spawn = 0; spawn < 16; ++spawn) {
+                    if (const int id = game.ifCanSpawnCurrentLevelSpawnAt(x, y, spawn); id >= 0) {
+                        ids.push_back(id);
+                    }
+                }
+            }
+        }
+        return ids;
+    }
+}
+
+int main() {
+    double checksum = 0.0;
+    for (const std::size_t playerCount: PLAYER_COUNTS) {
+        Game game;
+        for (std::size_t i = 1; i < playerCount; ++i) {
+            game.addPlayer(0, 1, 2);
+        }
+        // The players spread over the level, each one drawing the enemies around it.
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<> x(0.0, Level::LENGTH * Level::AREA_SIZE);
+        std::uniform_real_distribution<> y(0.0, Level::HEIGHT * Level::AREA_SIZE);
+        for (const int id: game.getPlayerIds()) {
+            game.setCharacterPosition(id, {x(gen), y(gen)});
+        }
+        const std::vector<int> enemies = spawnEnemies(game);
+        for (const int id: enemies) {
+            game.setCharacterPosition(id, {x(gen), y(gen)});
+        }
+        game.setEnemyAI(true);
+        const auto result = measure("stepPhysics, " + std::to_string(playerCount) + " players, " +
+                                    std::to_string(enemies.size()) + " enemies", TICKS, [&](long) {
+                                        checksum += game.stepPhysics(TICK_SECONDS);
+                                    });
+        report(result);
+    }
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file benchProjectiles.cpp
+ * @brief Measures a tick of 10,000 projectiles in flight among 1,000 enemies.
+ */
+#include "Benchmark.hpp"
+#include "Level.hpp"
+#include <cmath>
+#include <numbers>
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNT = 1000; ///< Number of enemies within the level.
+    constexpr int PROJECTILE_COUNT = 10000; ///< Number of projectiles kept in flight.
+    constexpr long TICKS = 600; ///< Number of ticks run, ten seconds at 60 ticks per second.
+    constexpr double TICK = 1.0 / 60.0; ///< Duration of a tick.
+    constexpr double SPEED = 12.0; ///< Speed of the projectiles, that of ATTACK_SPECTRUM.
+    constexpr int DAMAGE = 0; ///< Damage of the projectiles, none so that every enemy stays alive.
+
+    /**
+     * @brief Builds a level with one ready spawn point per enemy.
+     * @return The loaded level.
+     */
+    Level buildLevel() {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = ENEMY_COUNT / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {0, areas};
+    }
+}
+
+int main() {
+    Level level = buildLevel();
+    const auto ids = level.spawnReady(std::chrono::steady_clock::now(), ENEMY_COUNT, 1.0);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> coordinate(1.0, Level::AREA_SIZE * Level::LENGTH - 1.0);
+    std::uniform_real_distribution<> angle(0.0, 2 * std::numbers::pi);
+    for (const int id: ids) {
+        level.setEnemyPosition(id, {coordinate(gen), coordinate(gen)});
+    }
+    const Vector2D playerPosition{Level::AREA_SIZE * 1.5, Level::AREA_SIZE * 1.5};
+    const int playerId = 1;
+
+    // Spent projectiles are replaced every tick, so that the pool stays full.
+    const auto refill = [&] {
+        while (level.getProjectiles().size() < PROJECTILE_COUNT) {
+            const double a = angle(gen);
+            level.fireProjectile(0, level.getProjectiles().size() % 2 == 0, {coordinate(gen), coordinate(gen)},
+                                 {SPEED * std::cos(a), SPEED * std::sin(a)}, DAMAGE, 2.0);
+        }
+    };
+    long hit = 0;
+    long fired = 0;
+    std::vector<DamageHit> hits;
+    const auto result = measure("Projectile tick, 10000 projectiles and 1000 enemies", TICKS, [&](long) {
+        const std::size_t before = level.getProjectiles().size();
+        refill();
+        fired += static_cast<long>(level.getProjectiles().size() - before);
+        hits.clear();
+        level.stepProjectiles(TICK, std::span(&playerId, 1), std::span(&playerPosition, 1), hits);
+        hit += static_cast<long>(hits.size());
+    });
+    report(result);
+    std::cout << "fired " << fired << " projectiles, " << hit << " hits" << std::endl;
+    return 0;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file benchRaycast.cpp
+ * @brief Measures raycasts through the tile map of a level of 32 by 32 areas.
+ */
+#include "Benchmark.hpp"
+#include "Areas.hpp"
+#include "Level.hpp"
+#include <algorithm>
+#include <random>
+
+namespace {
+    constexpr int AREAS = 32; ///< Number of areas along each axis.
+    constexpr int RAYS = 100000; ///< Number of rays cast per iteration.
+    constexpr double MAX_RAY_LENGTH = 48.0; ///< Longest ray, about one and a half areas.
+    constexpr long ITERATIONS = 10; ///< Number of batches measured.
+
+    /**
+     * @brief Builds a large grid of crossroad areas.
+     * @return The areas, indexed by x then y.
+     */
+    std::vector<std::vector<Area>> buildAreas() {
+        const Area crossroad = DefinedAreas::get(A4URDL).area;
+        return {AREAS, std::vector<Area>(AREAS, crossroad)};
+    }
+}
+
+int main() {
+    const TileMap map(buildAreas(), Level::AREA_TILES);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> coordinate(0.0, map.getWidth());
+    std::uniform_real_distribution<> offset(-MAX_RAY_LENGTH, MAX_RAY_LENGTH);
+    std::vector<RaySegment> rays;
+    rays.reserve(RAYS);
+    for (int i = 0; i < RAYS; ++i) {
+        const Vector2D from{coordinate(gen), coordinate(gen)};
+        rays.push_back({from, {from.x + offset(gen), from.y + offset(gen)}});
+    }
+
+    std::vector<std::uint8_t> visible;
+    long clear = 0;
+    const auto result = measure("TileMap::hasLineOfSight, batches of 100000 rays", ITERATIONS, [&](long) {
+        map.hasLineOfSight(rays, visible);
+        clear += std::count(visible.begin(), visible.end(), 1);
+    });
+    report(result);
+    std::cout << static_cast<double>(RAYS) * ITERATIONS / result.seconds << " rays/s, " << clear << " clear rays, "
+            << map.getRunCount() << " runs, " << map.getMemoryUsage() << " bytes" << std::endl;
+    return 0;
+}
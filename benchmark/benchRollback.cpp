@@ -0,0 +1,84 @@
+/**
+ * @file benchRollback.cpp
+ * @brief Measures the cost of taking and restoring the in-memory state of a game, as rollback netcode does
+ * every tick, for a typical level of 30 enemies and a crowded one of 1,000.
+ */
+#include "Benchmark.hpp"
+#include "Game.hpp"
+#include "GameState.hpp"
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNTS[] = {30, 1000}; ///< Numbers of enemies of the level.
+    constexpr long ROLLBACKS = 10000; ///< Number of states taken and restored.
+
+    /**
+     * @brief Builds the level following the first one, with one ready spawn point per enemy.
+     * @param enemyCount The number of enemies.
+     * @return The loaded level.
+     */
+    Level buildLevel(const int enemyCount) {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = enemyCount / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {1, areas};
+    }
+}
+
+int main() {
+    double checksum = 0.0;
+    for (const int enemyCount: ENEMY_COUNTS) {
+        Game game;
+        Level level = buildLevel(enemyCount);
+        const auto ids = level.spawnReady(std::chrono::steady_clock::now(), enemyCount, 1.0);
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<> x(0.0, Level::LENGTH * Level::AREA_SIZE);
+        std::uniform_real_distribution<> y(0.0, Level::HEIGHT * Level::AREA_SIZE);
+        for (const int id: ids) {
+            level.setEnemyPosition(id, {x(gen), y(gen)});
+        }
+        game.enterLevel(level);
+        const std::string count = std::to_string(ids.size()) + " enemies";
+
+        GameState state;
+        report(measure("saveState, " + count, ROLLBACKS, [&](long) {
+            game.saveState(state);
+            checksum += static_cast<double>(state.characters.size());
+        }));
+        report(measure("restoreState, unchanged, " + count, ROLLBACKS, [&](long) {
+            checksum += game.restoreState(state);
+        }));
+
+        // A rolled back tick: every character moved since the state was taken.
+        const auto mutate = [&](const long tick) {
+            const double offset = static_cast<double>(tick % 2 + 1) * 0.25;
+            for (std::size_t i = 0; i < state.characters.size(); ++i) {
+                const CharacterFrame&frame = state.characters[i];
+                game.setCharacterPosition(frame.id, {frame.position.x + offset, frame.position.y});
+            }
+        };
+        const auto mutated = measure("move every character, " + count, ROLLBACKS, mutate);
+        game.restoreState(state);
+        report(mutated);
+        const auto rolledBack = measure("move every character then restoreState, " + count, ROLLBACKS,
+                                        [&](const long tick) {
+                                            mutate(tick);
+                                            checksum += game.restoreState(state);
+                                        });
+        report(rolledBack);
+        std::cout << "restoreState after a tick, " << count << ": "
+                << rolledBack.microsecondsPerIteration() - mutated.microsecondsPerIteration() << " us/iteration"
+                << std::endl;
+    }
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
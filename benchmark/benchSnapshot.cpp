@@ -0,0 +1,77 @@
+/**
+ * @file benchSnapshot.cpp
+ * @brief Measures the size of the snapshot of a game whose level holds 1,000 enemies, and the cost of
+ * saving and loading it, in memory and through a file.
+ */
+#include "Benchmark.hpp"
+#include "Game.hpp"
+#include "Snapshot.hpp"
+#include <filesystem>
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNT = 1000; ///< Number of enemies of the level.
+    constexpr long SAVES = 200; ///< Number of snapshots saved and loaded.
+
+    /**
+     * @brief Builds the level following the first one, with one ready spawn point per enemy.
+     * @param enemyCount The number of enemies.
+     * @return The loaded level.
+     */
+    Level buildLevel(const int enemyCount) {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = enemyCount / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {1, areas};
+    }
+}
+
+int main() {
+    Game game;
+    Level level = buildLevel(ENEMY_COUNT);
+    const auto ids = level.spawnReady(std::chrono::steady_clock::now(), ENEMY_COUNT, 1.0);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> x(0.0, Level::LENGTH * Level::AREA_SIZE);
+    std::uniform_real_distribution<> y(0.0, Level::HEIGHT * Level::AREA_SIZE);
+    for (const int id: ids) {
+        level.setEnemyPosition(id, {x(gen), y(gen)});
+    }
+    game.enterLevel(level);
+
+    std::vector<std::byte> bytes;
+    Snapshot::save(game, bytes);
+    std::cout << "snapshot of " << ids.size() << " enemies: " << bytes.size() << " bytes, "
+            << bytes.size() / ids.size() << " bytes per enemy" << std::endl;
+
+    double checksum = 0.0;
+    report(measure("save in memory, " + std::to_string(ids.size()) + " enemies", SAVES, [&](long) {
+        Snapshot::save(game, bytes);
+        checksum += static_cast<double>(bytes.size());
+    }));
+    Game restored;
+    report(measure("load from memory, " + std::to_string(ids.size()) + " enemies", SAVES, [&](long) {
+        Snapshot::load(restored, bytes);
+        checksum += static_cast<double>(restored.getEnemyIds().size());
+    }));
+
+    const std::string path = (std::filesystem::temp_directory_path() / "benchSnapshot.ror").string();
+    report(measure("save to file, " + std::to_string(ids.size()) + " enemies", SAVES, [&](long) {
+        game.saveSnapshot(path);
+    }));
+    report(measure("load from mapped file, " + std::to_string(ids.size()) + " enemies", SAVES, [&](long) {
+        restored.loadSnapshot(path);
+        checksum += static_cast<double>(restored.getEnemyIds().size());
+    }));
+    std::filesystem::remove(path);
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
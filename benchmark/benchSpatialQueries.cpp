@@ -0,0 +1,68 @@
+/**
+ * @file benchSpatialQueries.cpp
+ * @brief Measures the range queries of a level holding 5,000 moving enemies.
+ */
+#include "Benchmark.hpp"
+#include "Level.hpp"
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNT = 5000; ///< Number of enemies in the level.
+    constexpr long TICKS = 60 * 60; ///< One simulated minute at 60 ticks per second.
+    constexpr double WORLD_SIZE = Level::LENGTH * Level::AREA_SIZE; ///< Side length of the level, in world units.
+
+    /**
+     * @brief Builds a level with one ready spawn point per enemy.
+     * @return The loaded level.
+     */
+    Level buildLevel() {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = ENEMY_COUNT / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {0, areas};
+    }
+}
+
+int main() {
+    Level level = buildLevel();
+    const auto ids = level.spawnReady(std::chrono::steady_clock::now(), ENEMY_COUNT, 1.0);
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> coordinate(0.0, WORLD_SIZE);
+    std::uniform_real_distribution<> step(-0.1, 0.1);
+    std::vector<Vector2D> positions;
+    positions.reserve(ids.size());
+    for (const int id: ids) {
+        positions.push_back({coordinate(gen), coordinate(gen)});
+        level.setEnemyPosition(id, positions.back());
+    }
+
+    long found = 0;
+    const auto result = measure("Level move + range queries, 5000 enemies", TICKS, [&](const long tick) {
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            positions[i].x += step(gen);
+            positions[i].y += step(gen);
+            level.setEnemyPosition(ids[i], positions[i]);
+        }
+        const Vector2D player{static_cast<double>(tick % 96), WORLD_SIZE / 2};
+        found += static_cast<long>(level.getEnemiesInFollowRange(player).size());
+        found += static_cast<long>(level.getEnemiesInAttackRange(player).size());
+    });
+    report(result);
+
+    const Vector2D player{WORLD_SIZE / 2, WORLD_SIZE / 2};
+    const auto queries = measure("Level follow range query only, 5000 enemies", TICKS, [&](long) {
+        found += static_cast<long>(level.getEnemiesInFollowRange(player).size());
+    });
+    report(queries);
+    std::cout << "found " << found << " enemies in range over " << ids.size() << " enemies" << std::endl;
+    return 0;
+}
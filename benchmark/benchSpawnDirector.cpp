@@ -0,0 +1,47 @@
+/**
+ * @file benchSpawnDirector.cpp
+ * @brief Measures the cost of the spawn director on a level with 10,000 active spawn points.
+ */
+#include "Benchmark.hpp"
+#include "Level.hpp"
+#include "SpawnDirector.hpp"
+
+namespace {
+    constexpr int SPAWN_COUNT = 10000; ///< Number of spawn points in the level.
+    constexpr long TICKS = 60 * 60 * 5; ///< Five simulated minutes at 60 ticks per second.
+    constexpr auto TICK = std::chrono::microseconds(16667); ///< Simulated duration of a tick.
+
+    /**
+     * @brief Builds a level whose spawn points are spread over every area of the grid.
+     * @return The loaded level.
+     */
+    Level buildLevel() {
+        std::vector<std::vector<Area>> areas(Level::LENGTH);
+        const int spawnsPerArea = SPAWN_COUNT / (Level::LENGTH * Level::HEIGHT) + 1;
+        for (int x = 0; x < Level::LENGTH; ++x) {
+            for (int y = 0; y < Level::HEIGHT; ++y) {
+                std::vector<Spawn> spawns;
+                spawns.reserve(spawnsPerArea);
+                for (int id = 1; id <= spawnsPerArea; ++id) {
+                    spawns.emplace_back(id, 1, 10);
+                }
+                areas[x].emplace_back(40, 1, std::set<Direction2D>{}, spawns);
+            }
+        }
+        return {0, areas};
+    }
+}
+
+int main() {
+    Level level = buildLevel();
+    SpawnDirector director(4.0, SpawnDirector::DEF_WAVE_SIZE, SpawnDirector::DEF_MAX_SPAWNS_PER_TICK);
+    auto now = std::chrono::steady_clock::now();
+    long spawned = 0;
+    const auto result = measure("SpawnDirector::update, 10000 spawn points", TICKS, [&](long) {
+        now += TICK;
+        spawned += static_cast<long>(director.update(level, now, 2.0, SpawnDirector::DEF_MAX_SPAWNS_PER_TICK).size());
+    });
+    report(result);
+    std::cout << "spawned " << spawned << " enemies, " << level.getEnemyCount() << " in the level" << std::endl;
+    return 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * @file benchThreat.cpp
+ * @brief Measures the cost of feeding the hits of a tick to the threat table and of querying the
+ * target of every enemy, against the number of enemies.
+ */
+#include "Benchmark.hpp"
+#include "ThreatTable.hpp"
+#include <algorithm>
+#include <random>
+
+namespace {
+    constexpr int ENEMY_COUNTS[] = {1000, 10000, 100000}; ///< Numbers of enemies hit.
+    constexpr int HITS_PER_ENEMY = 2; ///< Hits taken by each enemy per tick, 120 per second at 60 ticks per second.
+    constexpr int PLAYERS = 16; ///< Number of players dealing the hits.
+    constexpr long TICKS = 600; ///< Ten simulated seconds at 60 ticks per second.
+}
+
+int main() {
+    double checksum = 0.0;
+    for (const int enemyCount: ENEMY_COUNTS) {
+        auto now = std::chrono::steady_clock::now();
+        ThreatTable table(ThreatTable::DEF_HALF_LIFE, now);
+        for (int player = 0; player < PLAYERS; ++player) {
+            table.addPlayer(player);
+        }
+        // The hits of a tick, grouped by target as the damage buffer hands them over.
+        std::mt19937 gen(42);
+        std::uniform_int_distribution<> attacker(0, PLAYERS - 1);
+        std::uniform_int_distribution<> damage(1, 50);
+        std::vector<DamageHit> hits;
+        hits.reserve(static_cast<std::size_t>(enemyCount) * HITS_PER_ENEMY);
+        std::vector<DamageResult> results;
+        results.reserve(enemyCount);
+        std::vector<int> enemyIds;
+        for (int enemy = 0; enemy < enemyCount; ++enemy) {
+            enemyIds.push_back(PLAYERS + enemy);
+            int dealt = 0;
+            for (int hit = 0; hit < HITS_PER_ENEMY; ++hit) {
+                hits.push_back({attacker(gen), PLAYERS + enemy, damage(gen)});
+                dealt += hits.back().damage;
+            }
+            results.push_back({PLAYERS + enemy, dealt, -1, false});
+        }
+        const std::string count = std::to_string(enemyCount);
+        const auto fed = measure("addDamage, " + count + " enemies, " + std::to_string(hits.size()) + " hits",
+                                 TICKS, [&](long) {
+                                     now += std::chrono::milliseconds(16);
+                                     table.advance(now);
+                                     table.addDamage(hits, results);
+                                 });
+        report(fed);
+
+        std::vector<int> targets;
+        const auto queried = measure("getTargets, " + count + " enemies", TICKS, [&](const long tick) {
+            table.getTargets(enemyIds, targets);
+            checksum += targets[static_cast<std::size_t>(tick) % targets.size()];
+        });
+        report(queried);
+    }
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
@@ -18,6 +18,8 @@
  * @brief Manages a timed animation state.
  */
 class Animation {
+    friend class Snapshot;
+
     double duration; ///< The duration of the animation in seconds.
     std::chrono::time_point<std::chrono::steady_clock> lastUsage; ///< The time point when the animation was last started.
 
@@ -44,5 +46,18 @@ public:
      * @return The duration of the animation in seconds.
      */
     [[nodiscard]] double getDuration() const;
+
+    /**
+     * @brief Retrieves the time at which the last started animation ends.
+     * @return The end time.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getEndTime() const;
+
+    /**
+     * @brief Computes the time left before the animation ends.
+     * @param now The current time.
+     * @return The remaining time in seconds, 0 if the animation is not playing.
+     */
+    [[nodiscard]] double getRemainingTime(std::chrono::time_point<std::chrono::steady_clock> now) const;
 };
 #endif //ANIMATION_HPP
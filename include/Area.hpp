@@ -15,12 +15,15 @@
 #include "Direction.hpp"
 #include "Spawn.hpp"
 #include <set>
+#include <vector>
 
 /**
  * @class Area
  * @brief Represents a region within the game world with specific properties and spawns.
  */
 class Area {
+    friend class Snapshot;
+
     static constexpr int FILLED_ID = 0; ///< Constant representing a filled area ID.
     int type; ///< The type of the area.
     int id; ///< The unique identifier of the area.
@@ -112,15 +115,25 @@ public:
     /**
      * @brief Checks if a specific spawn is available.
      * @param spawd_id The ID of the spawn to check.
+     * @param now The current time.
      * @return True if the spawn is available, otherwise false.
      */
-    bool can_spawn(int spawd_id);
+    bool can_spawn(int spawd_id, std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now());
 
     /**
      * @brief Activates a spawn in the area.
      * @param spawd_id The ID of the spawn to activate.
+     * @param now The current time.
+     */
+    void spawn(int spawd_id, std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Retrieves the time at which a spawn of the area will be ready again.
+     * @param spawn_id The ID of the spawn.
+     * @return The ready time of the spawn.
+     * @throws std::invalid_argument If the area has no spawn with this ID.
      */
-    void spawn(int spawd_id);
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> get_next_spawn_time(int spawn_id) const;
 
     /**
      * @brief Retrieves the IDs of all spawns in the area.
@@ -128,6 +141,12 @@ public:
      */
     [[nodiscard]] std::vector<int> get_spawn_ids() const;
 
+    /**
+     * @brief Retrieves the IDs of all chests in the area.
+     * @return A vector containing all chest IDs.
+     */
+    [[nodiscard]] std::vector<int> get_chest_ids() const;
+
     /**
      * @brief Open a chest to retrieve the item inside
      * @param chest_id The chest to open
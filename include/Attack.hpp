@@ -6,26 +6,59 @@
  * @brief Defines the Attack class for handling character attacks.
  *
  * The Attack class manages all properties and logic for executing and controlling character attacks,
- * including damage, cooldowns, and animation times.
+ * including damage, cooldowns, and animation times. A used attack goes through its phases in order:
+ * it winds up for its charge time, strikes during the first part of its animation, recovers during
+ * the rest of it, then cools down. The deadline of each phase is computed once when the attack is used, so querying the
+ * phase only compares the current time against them.
+ *
+ * The phases pace the animation and the availability of the attack only: its damage is dealt at
+ * once, when use() is called, so the wind-up is not a charge that can be interrupted, and its end is
+ * merely notified (TimerEvents::ATTACK_CHARGED).
  */
 #ifndef ATTACK_HPP
 #define ATTACK_HPP
 #include <string>
 #include <chrono>
 
+/**
+ * @enum AttackPhases
+ * @brief Represents the phase an attack is in.
+ */
+enum AttackPhases {
+    IDLE,       ///< The attack was never used, or its cooldown elapsed.
+    WINDUP,     ///< The animation leads up to the strike; the damage was already dealt when the attack was used.
+    ACTIVE,     ///< The first part of the animation, the strike itself.
+    RECOVERING, ///< The rest of the animation, after the strike.
+    COOLDOWN    ///< The animation ended, the attack cannot be used again yet.
+};
+
+
 /**
  * @class Attack
  * @brief Represents an attack with configurable damage, cooldown, and animation timings.
  */
 class Attack {
+    friend class Snapshot;
+
     std::string name; ///< The name of the attack.
     int damage; ///< The amount of damage dealt by the attack.
     double cooldown; ///< The cooldown time in seconds before the attack can be used again.
     double chargeTime; ///< The time required to charge the attack.
     double animationTime; ///< The duration of the attack's animation.
+    double activeFraction; ///< Fraction of the animation spent ACTIVE, the rest RECOVERING.
     std::chrono::time_point<std::chrono::steady_clock> lastUsageTime; ///< The last time the attack was used.
+    std::chrono::time_point<std::chrono::steady_clock> chargedTime; ///< The time the charge of the last usage ends.
+    std::chrono::time_point<std::chrono::steady_clock> recoveryTime; ///< The time the active part of the last usage ends.
+    std::chrono::time_point<std::chrono::steady_clock> endTime; ///< The time the animation of the last usage ends.
+    std::chrono::time_point<std::chrono::steady_clock> readyTime; ///< The time the cooldown of the last usage elapses.
 
 public:
+    /**
+     * Default fraction of the animation spent ACTIVE: the strike of the animations of the defined
+     * attacks takes their first quarter, their follow-through the rest.
+     */
+    static constexpr double DEF_ACTIVE_FRACTION = 0.25;
+
     /**
      * @brief Constructs an Attack object with specified parameters.
      * @param name The name of the attack.
@@ -33,11 +66,14 @@ public:
      * @param cooldown The cooldown time in seconds.
      * @param chargeTime The time required to charge the attack.
      * @param animationTime The duration of the attack's animation.
+     * @param activeFraction The fraction of the animation spent ACTIVE, the rest being spent RECOVERING.
+     * @throws std::invalid_argument If the active fraction is not between 0 and 1.
      */
-    Attack(std::string name, int damage, double cooldown, double chargeTime, double animationTime);
+    Attack(std::string name, int damage, double cooldown, double chargeTime, double animationTime,
+           double activeFraction = DEF_ACTIVE_FRACTION);
 
     /**
-     * @brief Executes the attack and returns the damage dealt.
+     * @brief Executes the attack, computing the deadlines of its phases, and returns the damage dealt.
      * @throws std::runtime_error If the attack cannot be used.
      * @return The damage dealt by the attack.
      */
@@ -54,6 +90,18 @@ public:
      * @return True if the attack can be used, otherwise false.
      */
     [[nodiscard]] bool canUse() const;
+    /**
+     * @brief Retrieves the phase of the attack.
+     * @param now The current time.
+     * @return The phase of the attack.
+     */
+    [[nodiscard]] AttackPhases getPhase(std::chrono::time_point<std::chrono::steady_clock> now) const;
+    /**
+     * @brief Computes how far the attack is through its current phase.
+     * @param now The current time.
+     * @return The elapsed fraction of the phase, between 0 and 1; 0 when IDLE.
+     */
+    [[nodiscard]] double getPhaseProgress(std::chrono::time_point<std::chrono::steady_clock> now) const;
 
     /**
      * @brief Retrieves the damage dealt by the attack.
@@ -85,12 +133,42 @@ public:
      */
     [[nodiscard]] double getAnimationTime() const;
 
+    /**
+     * @brief Retrieves the fraction of the animation spent ACTIVE.
+     * @return The fraction, between 0 and 1.
+     */
+    [[nodiscard]] double getActiveFraction() const;
+
     /**
     * @brief Retrieves the last usage time of the attack.
     * @return A time_point representing the last usage time.
     */
     [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getLastUsageTime() const;
 
+    /**
+     * @brief Retrieves the time at which the charge of the last usage ends, when the attack strikes.
+     * @return The charged time, meaningless if the attack was never used.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getChargedTime() const;
+    /**
+     * @brief Retrieves the time at which the charge and animation of the last usage end.
+     * @return The end time, meaningless if the attack was never used.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getEndTime() const;
+
+    /**
+     * @brief Retrieves the time at which the cooldown of the last usage elapses.
+     * @return The ready time, meaningless if the attack was never used.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getReadyTime() const;
+
+    /**
+     * @brief Computes the time left before the attack can be used again.
+     * @param now The current time.
+     * @return The remaining time in seconds, 0 if the attack is ready.
+     */
+    [[nodiscard]] double getRemainingTime(std::chrono::time_point<std::chrono::steady_clock> now) const;
+
     /**
      * @brief Compares two Attack objects based on their names.
      * @param rhs The other Attack object to compare with.
@@ -101,10 +179,10 @@ public:
     }
 
     /**
-     * @brief Increases the damage dealt by the attack by a specified amount.
-     * @param amount The amount by which to increase the damage.
+     * @brief Sets the damage dealt by the attack.
+     * @param amount The new damage.
      * @throws std::invalid_argument If the amount is negative.
      */
-    void increaseDamage(double amount);
+    void setDamage(int amount);
 };
 #endif //ATTACK_HPP
@@ -6,13 +6,18 @@
  * @brief Defines the Attacks enum and the DefinedAttacks struct for managing predefined attacks.
  *
  * The Attacks enum lists predefined attack configurations, while the DefinedAttacks struct provides
- * functionality to retrieve specific Attack objects and perform operations on them.
+ * functionality to retrieve specific Attack objects and perform operations on them. Some attacks
+ * hit every character within an area, described by their AreaOfEffect, and some fire a projectile,
+ * described by their RangedProfile.
  */
 #ifndef ATTACKS_HPP
 #define ATTACKS_HPP
 #include "magic_enum/magic_enum.hpp"
 
 #include "Attack.hpp"
+#include "Vector2D.hpp"
+#include <algorithm>
+#include <cmath>
 
 /**
  * @enum Attacks
@@ -29,12 +34,67 @@ enum Attacks {
     ATTACK_DROID      ///< Droid-specific attack with high damage and a short charge time.
 };
 
+/**
+ * @enum AreaShapes
+ * @brief Represents the shape of the area hit by an attack.
+ */
+enum AreaShapes {
+    SINGLE_TARGET, ///< The attack hits a single target.
+    CIRCLE,        ///< The attack hits every character within its radius.
+    CONE           ///< The attack hits every character within its radius, in front of the attacker.
+};
+
+/**
+ * @struct AreaOfEffect
+ * @brief Describes the area hit by an attack and how its damage decreases with the distance.
+ */
+struct AreaOfEffect {
+    AreaShapes shape = SINGLE_TARGET; ///< The shape of the area.
+    double radius = 0.0; ///< The radius of the area, in world units.
+    double falloff = 0.0; ///< The fraction of the damage lost at the edge of the area, decreasing linearly.
+
+    /**
+     * @brief Checks if a character is within the area.
+     * @param offset The position of the character relative to the attacker.
+     * @param facing The horizontal direction the attacker faces, 1 for right and -1 for left.
+     * @return True if the character is hit, otherwise false.
+     */
+    [[nodiscard]] bool contains(const Vector2D&offset, const int facing) const {
+        if (shape == SINGLE_TARGET || offset.x * offset.x + offset.y * offset.y > radius * radius) {
+            return false;
+        }
+        return shape == CIRCLE || offset.x * facing >= 0;
+    }
+
+    /**
+     * @brief Computes the damage dealt to a character within the area.
+     * @param damage The damage of the attack.
+     * @param distance The distance between the attacker and the character.
+     * @return The damage dealt, at least 0.
+     */
+    [[nodiscard]] int damageAt(const int damage, const double distance) const {
+        const double ratio = radius > 0 ? std::clamp(distance / radius, 0.0, 1.0) : 0.0;
+        return std::max(0, static_cast<int>(std::lround(damage * (1.0 - falloff * ratio))));
+    }
+};
+
+/**
+ * @struct RangedProfile
+ * @brief Describes the projectile fired by a ranged attack.
+ */
+struct RangedProfile {
+    double speed = 0.0; ///< The speed of the projectile, in units per second; 0 for a melee attack.
+    double lifetime = 0.0; ///< The flight time of the projectile, in seconds.
+};
+
 /**
  * @struct DefinedAttacks
  * @brief Provides functionality to retrieve predefined Attack objects and perform operations on them.
  */
 struct DefinedAttacks {
     Attack attack;
+    AreaOfEffect area{}; ///< The area hit by the attack, SINGLE_TARGET by default.
+    RangedProfile ranged{}; ///< The projectile fired by the attack, none by default.
 
     /**
      * @brief Retrieves a predefined Attack object based on the specified Attacks enum.
@@ -48,13 +108,13 @@ struct DefinedAttacks {
             case ATTACK2:
                 return DefinedAttacks{Attack("ATTACK2", 50, 0.75, 0.2, 0.4)};
             case ATTACK3:
-                return DefinedAttacks{Attack("ATTACK3", 100, 5.0, 0.4, 1.0)};
+                return DefinedAttacks{Attack("ATTACK3", 100, 5.0, 0.4, 1.0), {CONE, 3.0, 0.5}};
             case ATTACK4:
                 return DefinedAttacks{Attack("ATTACK4", 80, 2.0, 0.3, 0.6)};
             case ATTACK5:
-                return DefinedAttacks{Attack("ATTACK5", 160, 5.0, 0.6, 1.5)};
+                return DefinedAttacks{Attack("ATTACK5", 160, 5.0, 0.6, 1.5), {CIRCLE, 4.0, 0.5}};
             case ATTACK_SPECTRUM:
-                return DefinedAttacks{Attack("ATTACK_SPECTRUM", 75, 4.0, 1.0, 2.1)};
+                return DefinedAttacks{Attack("ATTACK_SPECTRUM", 75, 4.0, 1.0, 2.1), {}, {12.0, 1.5}};
             case ATTACK_MONSTER:
                 return DefinedAttacks{Attack("ATTACK_MONSTER", 25, 1.0, 0.3, 0.8)};
             case ATTACK_DROID:
@@ -121,7 +181,27 @@ struct DefinedAttacks {
         }
         throw std::invalid_argument("Invalid attack name");
     }
-    
+
+    /**
+     * @brief Retrieves the area hit by an attack.
+     * @param attackName The name of the attack.
+     * @return The area of the attack, whose shape is SINGLE_TARGET for a single-target attack.
+     * @throws std::invalid_argument If the attack name is invalid.
+     */
+    static AreaOfEffect getAreaOfEffect(const std::string&attackName) {
+        return get(static_cast<Attacks>(getAttackValue(attackName))).area;
+    }
+
+    /**
+     * @brief Retrieves the projectile fired by an attack.
+     * @param attackName The name of the attack.
+     * @return The projectile of the attack, whose speed is 0 for a melee attack.
+     * @throws std::invalid_argument If the attack name is invalid.
+     */
+    static RangedProfile getRangedProfile(const std::string&attackName) {
+        return get(static_cast<Attacks>(getAttackValue(attackName))).ranged;
+    }
+
     /**
      * @brief Retrieves the number of predefined Attacks.
      * @return The number of elements in the Attacks enum.
@@ -0,0 +1,329 @@
+/**
+ * @file Behaviour.hpp
+ * @brief Defines the Behaviour coroutine type, the scripted behaviours of the enemies and what they await.
+ *
+ * A behaviour is a C++20 coroutine that drives one enemy: it reads the state of the game, acts
+ * through the same calls as the engine, and suspends on what it waits for instead of being polled
+ * every frame:
+ * - a duration of game time, or the end of the attack it just used;
+ * - the player coming within a range, or leaving it.
+ *
+ * The BehaviourScheduler resumes the behaviours once what they wait for happened. The frames of
+ * the coroutines come from the FramePool of the scheduler.
+ */
+#ifndef BEHAVIOUR_HPP
+#define BEHAVIOUR_HPP
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <string>
+#include "ModifierStack.hpp"
+
+class Game;
+class BehaviourScheduler;
+
+/**
+ * @enum Behaviours
+ * @brief Enumerates the scripted behaviours an enemy can run.
+ */
+enum Behaviours {
+    CHASE, ///< Runs toward the player within its follow range and attacks it within its attack range.
+    BOSS   ///< Chases like CHASE, then enrages below half of its health: stronger, faster and with shorter pauses.
+};
+
+/**
+ * @class ConditionAwaiter
+ * @brief A suspension point resumed once a condition on the game holds, checked by the scheduler every tick.
+ */
+class ConditionAwaiter {
+public:
+    /**
+     * @brief Default destructor.
+     */
+    virtual ~ConditionAwaiter() = default;
+
+    /**
+     * @brief Checks if the awaiting behaviour can be resumed.
+     * @return True if the condition holds, otherwise false.
+     */
+    [[nodiscard]] virtual bool isReady() const = 0;
+};
+
+/**
+ * @struct BehaviourContext
+ * @brief The enemy driven by a behaviour, and the actions and waits available to it.
+ *
+ * The context is copied into the frame of the behaviour. The characteristics of the enemy that do
+ * not change are read once when the behaviour starts.
+ */
+struct BehaviourContext {
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock of the game.
+
+    Game* game; ///< The game the enemy belongs to.
+    BehaviourScheduler* scheduler; ///< The scheduler running the behaviour.
+    int id; ///< The ID of the enemy.
+    std::string attackName; ///< The name of the attack of the enemy.
+    double followRange; ///< The follow range of the enemy.
+    double attackRange; ///< The attack range of the enemy.
+
+    /**
+     * @struct Sleep
+     * @brief Suspends the behaviour until a time of the game clock.
+     */
+    struct Sleep {
+        BehaviourScheduler* scheduler; ///< The scheduler running the behaviour.
+        TimePoint due; ///< The time the behaviour is resumed.
+
+        /**
+         * @brief Checks if the time already passed.
+         * @return True if the behaviour goes on without suspending, otherwise false.
+         */
+        [[nodiscard]] bool await_ready() const noexcept;
+
+        /**
+         * @brief Registers the behaviour with the scheduler.
+         */
+        void await_suspend(std::coroutine_handle<>) const;
+
+        /**
+         * @brief Resumes the behaviour.
+         */
+        void await_resume() const noexcept {
+        }
+    };
+
+    /**
+     * @struct Range
+     * @brief Suspends the behaviour until the player is within, or beyond, a distance of the enemy.
+     *
+     * The behaviour is also resumed if the enemy dies, so that it can end.
+     */
+    struct Range final : ConditionAwaiter {
+        const BehaviourContext* context; ///< The context of the behaviour.
+        double distance; ///< The distance.
+        bool within; ///< True to wait for the player to come within the distance, false to wait for it to leave.
+
+        /**
+         * @brief Constructs a Range condition.
+         * @param context The context of the behaviour.
+         * @param distance The distance.
+         * @param within True to wait for the player to come within the distance, false to wait for it to leave.
+         */
+        Range(const BehaviourContext* context, double distance, bool within);
+
+        [[nodiscard]] bool isReady() const override;
+
+        /**
+         * @brief Checks if the condition already holds.
+         * @return True if the behaviour goes on without suspending, otherwise false.
+         */
+        [[nodiscard]] bool await_ready() const;
+
+        /**
+         * @brief Registers the condition with the scheduler.
+         */
+        void await_suspend(std::coroutine_handle<>) const;
+
+        /**
+         * @brief Resumes the behaviour.
+         */
+        void await_resume() const noexcept {
+        }
+    };
+
+    /**
+     * @brief Checks if the enemy still exists and is alive.
+     * @return True if the enemy can act, otherwise false.
+     */
+    [[nodiscard]] bool isAlive() const;
+
+    /**
+     * @brief Retrieves the player the enemy targets, as chosen by Game::getEnemyTarget.
+     * @return The ID of the player, the host if every player is dead.
+     */
+    [[nodiscard]] int getTarget() const;
+
+    /**
+     * @brief Computes the distance between the enemy and the player.
+     * @return The distance.
+     */
+    [[nodiscard]] double distanceToPlayer() const;
+
+    /**
+     * @brief Computes the fraction of its maximum health the enemy has left.
+     * @return The fraction, between 0 and 1.
+     */
+    [[nodiscard]] double getHealthRatio() const;
+
+    /**
+     * @brief Checks if the player is within the attack range of the enemy and in its line of sight.
+     * @return True if the enemy can hit the player, otherwise false.
+     * @see Game::canCharacterReach
+     */
+    [[nodiscard]] bool canReachPlayer() const;
+
+    /**
+     * @brief Attacks the player if the attack of the enemy can be used and the player is within its reach.
+     * @return True if the enemy attacked, otherwise false.
+     */
+    bool attack() const;
+
+    /**
+     * @brief Sets the run input of the enemy toward the player.
+     */
+    void runTowardPlayer() const;
+
+    /**
+     * @brief Stops the run of the enemy.
+     */
+    void stop() const;
+
+    /**
+     * @brief Multiplies a stat of the enemy for a duration.
+     * @param stat The stat.
+     * @param multiplier The multiplier.
+     * @param seconds The duration of the buff.
+     */
+    void buff(Stats stat, double multiplier, double seconds) const;
+
+    /**
+     * @brief Waits for a duration of game time.
+     * @param seconds The duration.
+     * @return The suspension point.
+     */
+    [[nodiscard]] Sleep wait(double seconds) const;
+
+    /**
+     * @brief Waits until the attack of the enemy can be used again.
+     * @return The suspension point, ready at once if the attack is ready.
+     */
+    [[nodiscard]] Sleep untilAttackReady() const;
+
+    /**
+     * @brief Waits until the animation of the attack of the enemy ended.
+     * @return The suspension point, ready at once if the enemy is not attacking.
+     */
+    [[nodiscard]] Sleep untilAttackEnds() const;
+
+    /**
+     * @brief Waits until the player is within a distance of the enemy.
+     * @param distance The distance.
+     * @return The suspension point.
+     */
+    [[nodiscard]] Range untilWithin(double distance) const;
+
+    /**
+     * @brief Waits until the player is beyond a distance of the enemy.
+     * @param distance The distance.
+     * @return The suspension point.
+     */
+    [[nodiscard]] Range untilBeyond(double distance) const;
+};
+
+/**
+ * @class Behaviour
+ * @brief Owning handle of a behaviour coroutine.
+ *
+ * The coroutine starts suspended and suspends again when it ends, so that the scheduler starts it
+ * and destroys it. An exception escaping the coroutine is kept and rethrown by the scheduler.
+ */
+class Behaviour {
+public:
+    /**
+     * @struct promise_type
+     * @brief The promise of a behaviour coroutine, whose frame is allocated from the pool of the scheduler.
+     */
+    struct promise_type {
+        std::exception_ptr exception; ///< The exception that escaped the coroutine, if any.
+        int script = -1; ///< The script run by the coroutine (Behaviours), set by create.
+
+        /**
+         * @brief Allocates the frame of a behaviour from the pool of its scheduler.
+         * @param size The size of the frame.
+         * @param context The context of the behaviour, its first parameter.
+         * @return The frame.
+         */
+        static void* operator new(std::size_t size, const BehaviourContext&context);
+
+        /**
+         * @brief Releases the frame of a behaviour.
+         * @param frame The frame.
+         * @param size The size of the frame.
+         */
+        static void operator delete(void* frame, std::size_t size);
+
+        Behaviour get_return_object();
+
+        std::suspend_always initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() noexcept {
+        }
+
+        void unhandled_exception() {
+            exception = std::current_exception();
+        }
+    };
+
+private:
+    std::coroutine_handle<promise_type> handle; ///< The coroutine, null once moved from.
+
+public:
+    /**
+     * @brief Constructs an empty Behaviour.
+     */
+    Behaviour() = default;
+
+    /**
+     * @brief Takes ownership of a coroutine.
+     * @param handle The coroutine.
+     */
+    explicit Behaviour(std::coroutine_handle<promise_type> handle);
+
+    Behaviour(Behaviour&&other) noexcept;
+    Behaviour& operator=(Behaviour&&other) noexcept;
+    Behaviour(const Behaviour&) = delete;
+    Behaviour& operator=(const Behaviour&) = delete;
+
+    /**
+     * @brief Destroys the coroutine, releasing its frame.
+     */
+    ~Behaviour();
+
+    /**
+     * @brief Runs the coroutine until its next suspension point.
+     */
+    void resume() const;
+
+    /**
+     * @brief Checks if the coroutine ended.
+     * @return True if the coroutine ended or is empty, otherwise false.
+     */
+    [[nodiscard]] bool done() const;
+
+    /**
+     * @brief Retrieves the exception that escaped the coroutine.
+     * @return The exception, null if none did.
+     */
+    [[nodiscard]] std::exception_ptr getException() const;
+
+    /**
+     * @brief Retrieves the script run by the coroutine.
+     * @return The script (Behaviours), -1 if the behaviour is empty.
+     */
+    [[nodiscard]] int getScript() const;
+
+    /**
+     * @brief Creates a behaviour.
+     * @param behaviour The behaviour.
+     * @param context The enemy driven by the behaviour.
+     * @return The behaviour, suspended before its first statement.
+     */
+    static Behaviour create(Behaviours behaviour, const BehaviourContext&context);
+};
+#endif //BEHAVIOUR_HPP
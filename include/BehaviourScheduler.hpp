@@ -0,0 +1,175 @@
+/**
+ * @file BehaviourScheduler.hpp
+ * @brief Defines the BehaviourScheduler class, which resumes the suspended behaviours of the enemies.
+ *
+ * The behaviours waiting for a time sit in a min-heap ordered by that time, so that a tick only
+ * visits the ones that fell due. The behaviours waiting for a condition are checked every tick, the
+ * condition being a cheap test on the state of the game. A behaviour is referred to by its slot and
+ * the generation of the slot, so that stopping it leaves stale entries behind instead of searching
+ * the queues; they are dropped when reached.
+ *
+ * The frames of the behaviours come from the FramePool of the scheduler, which keeps its blocks
+ * from one level to the next.
+ */
+#ifndef BEHAVIOURSCHEDULER_HPP
+#define BEHAVIOURSCHEDULER_HPP
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Behaviour.hpp"
+#include "FramePool.hpp"
+
+/**
+ * @class BehaviourScheduler
+ * @brief Runs the behaviours of the enemies from the game clock.
+ */
+class BehaviourScheduler {
+public:
+    using TimePoint = BehaviourContext::TimePoint; ///< Clock of the game.
+
+private:
+    /**
+     * @struct Slot
+     * @brief A running behaviour.
+     */
+    struct Slot {
+        Behaviour behaviour; ///< The coroutine, empty if the slot is free.
+        int characterId = -1; ///< The ID of the enemy driven by the behaviour.
+        std::uint32_t generation = 0; ///< Incremented each time the slot is freed.
+    };
+
+    /**
+     * @struct Waiting
+     * @brief A reference to a suspended behaviour.
+     */
+    struct Waiting {
+        std::uint32_t slot; ///< The slot of the behaviour.
+        std::uint32_t generation; ///< The generation of the slot when the behaviour suspended.
+    };
+
+    /**
+     * @struct Sleeper
+     * @brief A behaviour waiting for a time.
+     */
+    struct Sleeper {
+        TimePoint due; ///< The time the behaviour is resumed.
+        Waiting waiting; ///< The behaviour.
+    };
+
+    /**
+     * @struct Watcher
+     * @brief A behaviour waiting for a condition.
+     */
+    struct Watcher {
+        const ConditionAwaiter* condition; ///< The condition, living in the frame of the behaviour.
+        Waiting waiting; ///< The behaviour.
+    };
+
+    static constexpr std::uint32_t NONE = UINT32_MAX; ///< No behaviour is running.
+
+    FramePool frames; ///< The frames of the behaviours, declared first so that it outlives them.
+    std::vector<Slot> slots; ///< The behaviours, indexed by slot.
+    std::vector<std::uint32_t> freeSlots; ///< The free slots.
+    std::unordered_map<int, std::uint32_t> slotOf; ///< The slot of the behaviour of each enemy.
+    std::vector<Sleeper> sleepers; ///< The behaviours waiting for a time, as a min-heap of the due times.
+    std::vector<Watcher> watchers; ///< The behaviours waiting for a condition.
+    std::vector<Waiting> ready; ///< The behaviours to resume at the next tick.
+    std::vector<Waiting> resuming; ///< The behaviours resumed by the current tick.
+    TimePoint now{}; ///< The time of the last tick.
+    std::uint32_t current = NONE; ///< The slot of the behaviour running, NONE between two resumptions.
+
+    /**
+     * @brief Checks if a reference to a behaviour is still valid.
+     * @param waiting The reference.
+     * @return True if the slot still holds the same behaviour, otherwise false.
+     */
+    [[nodiscard]] bool isFresh(const Waiting&waiting) const;
+
+    /**
+     * @brief Destroys a behaviour and frees its slot.
+     * @param slot The slot of the behaviour.
+     */
+    void release(std::uint32_t slot);
+
+public:
+    /**
+     * @brief Constructs an empty BehaviourScheduler.
+     */
+    BehaviourScheduler() = default;
+
+    BehaviourScheduler(const BehaviourScheduler&) = delete;
+    BehaviourScheduler& operator=(const BehaviourScheduler&) = delete;
+
+    /**
+     * @brief Retrieves the pool the frames of the behaviours are allocated from.
+     * @return The pool.
+     */
+    FramePool& getFrames();
+
+    /**
+     * @brief Starts a behaviour at the next tick, replacing the behaviour the enemy was running.
+     * @param characterId The ID of the enemy driven by the behaviour.
+     * @param behaviour The behaviour, suspended before its first statement.
+     */
+    void spawn(int characterId, Behaviour behaviour);
+
+    /**
+     * @brief Resumes the behaviours whose wait is over, then destroys the ones that ended.
+     * @param time The current time of the game clock.
+     * @throws Any exception that escaped a behaviour, once every behaviour due was resumed.
+     */
+    void tick(TimePoint time);
+
+    /**
+     * @brief Suspends the running behaviour until a time.
+     * @param due The time the behaviour is resumed, at the first tick at or after it.
+     * @throws std::logic_error If no behaviour is running.
+     */
+    void sleepUntil(TimePoint due);
+
+    /**
+     * @brief Suspends the running behaviour until a condition holds.
+     * @param condition The condition, which must live until the behaviour is resumed.
+     * @throws std::logic_error If no behaviour is running.
+     */
+    void watch(const ConditionAwaiter&condition);
+
+    /**
+     * @brief Retrieves the time of the last tick, from which the waits of the behaviours are counted.
+     * @return The time.
+     */
+    [[nodiscard]] TimePoint getTime() const;
+
+    /**
+     * @brief Stops the behaviour of an enemy.
+     * @param characterId The ID of the enemy.
+     * @return True if the enemy was running a behaviour, otherwise false.
+     */
+    bool stop(int characterId);
+
+    /**
+     * @brief Checks if an enemy is running a behaviour.
+     * @param characterId The ID of the enemy.
+     * @return True if the enemy runs a behaviour, otherwise false.
+     */
+    [[nodiscard]] bool isRunning(int characterId) const;
+
+    /**
+     * @brief Retrieves the script of the behaviour of an enemy.
+     * @param characterId The ID of the enemy.
+     * @return The script (Behaviours) the enemy runs, -1 if it runs none.
+     */
+    [[nodiscard]] int getScript(int characterId) const;
+
+    /**
+     * @brief Retrieves the number of behaviours running.
+     * @return The number of behaviours.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Stops every behaviour, keeping the blocks of the pool.
+     */
+    void clear();
+};
+#endif //BEHAVIOURSCHEDULER_HPP
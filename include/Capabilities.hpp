@@ -10,11 +10,13 @@
  */
 #ifndef CAPABILITIES_HPP
 #define CAPABILITIES_HPP
+#include <array>
 #include <set>
 #include <memory>
 #include <map>
 #include <algorithm>
 #include "Attacks.hpp"
+#include "Movements.hpp"
 #include "Attack.hpp"
 #include "Movement.hpp"
 #include "JetPack.hpp"
@@ -24,9 +26,17 @@
  * @brief Represents a collection of abilities (attacks, movements, and tools) for a character.
  */
 class Capabilities {
+    friend class Snapshot;
+
     std::vector<Attack> attacks; ///< Map of attacks identified by their names.
     std::map<std::string, std::shared_ptr<Movement>> movements; ///< Map of movements identified by their names.
     JetPack jetPack; ///< JetPack capability, if available.
+    std::array<Movement*, magic_enum::enum_count<Movements>()> byKind{}; ///< The movements indexed by Movements, nullptr if missing.
+
+    /**
+     * @brief Indexes the movements by kind, once they are all in the map.
+     */
+    void indexMovements();
 
     /**
      * @brief Retrieves an attack by its name.
@@ -43,6 +53,23 @@ public:
      */
     Capabilities(std::vector<Attack> attacks, std::set<std::shared_ptr<Movement>> movements, bool hasJetPack);
 
+    /**
+     * @brief Copies capabilities, cloning their movements so that the copy never shares them.
+     * @param other The capabilities to copy.
+     */
+    Capabilities(const Capabilities&other);
+
+    Capabilities(Capabilities&&) noexcept = default;
+
+    /**
+     * @brief Copies capabilities, cloning their movements so that the copy never shares them.
+     * @param other The capabilities to copy.
+     * @return These capabilities.
+     */
+    Capabilities& operator=(const Capabilities&other);
+
+    Capabilities& operator=(Capabilities&&) noexcept = default;
+
     /**
      * @brief Checks if a capability (attack, movement, or JetPack) can be used.
      * @param name The name of the capability.
@@ -67,6 +94,13 @@ public:
      */
     [[nodiscard]] std::shared_ptr<Movement> getMovement(std::string) const;
 
+    /**
+     * @brief Finds a movement by its kind, without looking up its name.
+     * @param movement The kind of movement.
+     * @return The movement, nullptr if it is missing or is the JetPack.
+     */
+    [[nodiscard]] const Movement* findMovement(Movements movement) const;
+
     /**
      * @brief Retrieves the JetPack capability.
      * @return The JetPack object.
@@ -79,6 +113,12 @@ public:
      */
     [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getLastAttackTime() const;
 
+    /**
+     * @brief Retrieves the attack used most recently.
+     * @return The attack, nullptr if no attack was ever used.
+     */
+    [[nodiscard]] const Attack* getLastUsedAttack() const;
+
     /**
      * @brief Uses a specific capability (attack, movement, or JetPack).
      * @param name The name of the capability to use.
@@ -114,18 +154,11 @@ public:
     bool hasThisMovement(std::string name) const;
 
     /**
-     * @brief Increases the force of a specific movement by a given amount.
-     * @param string The movement to increase the force of.
-     * @param amount The amount to increase the force by.
-     */
-    void increaseMovementForce(const std::string& string, double amount);
-
-    /**
-     * @brief Increases the damage of a specific attack by a given amount.
-     * @param amount The amount to increase the damage by.
-     * @param attacksName The attack to increase the damage of.
+     * @brief Sets the damage of every attack.
+     * @param damages The new damage of each attack, in the order of the attacks.
+     * @throws std::invalid_argument If there is not one damage per attack or if a damage is negative.
      */
-    void increaseAttackDamage(double amount, std::string&attacksName);
+    void setAttackDamages(const std::vector<int>&damages);
 
     /**
      * @brief Retrieves all of character's attacks names.
@@ -17,14 +17,30 @@
 #include "Health.hpp"
 #include "Item.hpp"
 #include "Items.hpp"
+#include "ModifierStack.hpp"
+#include "Movements.hpp"
+#include "Vector2D.hpp"
+#include <span>
 #include <vector>
 #include <memory>
 
+/**
+ * @struct AttackState
+ * @brief The phase of the attack a character used last.
+ */
+struct AttackState {
+    int attack = -1; ///< The index of the attack (Attacks), -1 if the character never attacked.
+    AttackPhases phase = IDLE; ///< The phase of the attack.
+    double progress = 0.0; ///< The elapsed fraction of the phase, between 0 and 1.
+};
+
 /**
  * @class Character
  * @brief Represents a character in the game, with health, capabilities, and items.
  */
 class Character {
+    friend class Snapshot;
+
 protected:
     static int nextId; ///< Static counter to generate unique IDs for characters.
     std::string type; ///< The type or class of the character.
@@ -34,6 +50,23 @@ protected:
     Capabilities capabilities; ///< The capabilities (attacks, movements, jetpack) of the character.
     bool onGround; ///< Indicates whether the character is on the ground.
     Animation hurtAnimation; ///< Animation triggered when the character is hurt.
+    Vector2D position{0.0, 0.0}; ///< The position of the character in world coordinates.
+    Vector2D velocity{0.0, 0.0}; ///< The velocity of the character, in world units per second.
+    double runInput = 0.0; ///< The horizontal run input of the character, between -1 and 1.
+    int facing = 1; ///< The horizontal direction the character faces, 1 for right and -1 for left.
+    ModifierStack modifiers; ///< Modifiers from the items, the difficulty and the buffs.
+    int baseMaxHealth; ///< Maximum health before the modifiers.
+    double baseRunForce = 0.0; ///< Force of the RUN movement before the modifiers.
+    int baseJumpCount = 0; ///< Number of consecutive jumps before the modifiers.
+    std::vector<int> baseAttackDamages; ///< Damage of each attack before the modifiers, in the order of the attacks.
+
+    /**
+     * @brief Recomputes the derived stats from the base stats and the modifiers, and stores them in the
+     * health and the capabilities, where every getter reads them.
+     *
+     * A higher maximum health heals a living character by the gain; a lower one caps the current health.
+     */
+    void applyModifiers();
 
     /**
      * @brief Virtual method to handle character death. Must be implemented by derived classes.
@@ -51,6 +84,10 @@ public:
     static constexpr double DEF_HURT_TIME = 0.5; ///< Default duration of the hurt animation.
     static constexpr double DEF_RUN_FORCE = 4.0; ///< Default force for running movements.
     static constexpr double DEF_JUMP_FORCE = 5.0; ///< Default force for jumping movements.
+    /// Number of remaining times of a character: one per attack (Attacks), one per movement (Movements), then the hurt animation.
+    static constexpr std::size_t REMAINING_TIME_COUNT = magic_enum::enum_count<Attacks>() +
+                                                        magic_enum::enum_count<Movements>() + 1;
+    static constexpr double NO_CAPABILITY = -1.0; ///< Remaining time of a capability the character does not have.
 
     /**
      * @brief Constructs a Character with specified attributes.
@@ -97,6 +134,27 @@ public:
      */
     [[nodiscard]] std::shared_ptr<Movement> getMovement(const std::string&) const;
 
+    /**
+     * @brief Checks if the character has a movement, the JetPack excluded.
+     * @param name The name of the movement.
+     * @return True if the character has this movement, otherwise false.
+     */
+    [[nodiscard]] bool hasMovement(const std::string&name) const;
+
+    /**
+     * @brief Finds a movement of the character by its kind, without looking up its name.
+     * @param movement The kind of movement.
+     * @return The movement, nullptr if the character does not have it.
+     */
+    [[nodiscard]] const Movement* findMovement(Movements movement) const;
+
+    /**
+     * @brief Checks if the character has an attack.
+     * @param name The name of the attack.
+     * @return True if the character has this attack, otherwise false.
+     */
+    [[nodiscard]] bool hasAttack(const std::string&name) const;
+
     /**
      * @brief Retrieves the JetPack assigned to the character.
      * @return The JetPack object.
@@ -125,7 +183,7 @@ public:
     int attack(const std::string& attackName);
 
     /**
-     * @brief Executes a movement by its name.
+     * @brief Executes a movement by its name. A jump gives the character its vertical speed.
      * @param movementName The name of the movement.
      * @throws std::invalid_argument If the movement cannot be used.
      */
@@ -185,6 +243,25 @@ public:
      */
     [[nodiscard]] bool isBusy() const; // TODO The attacks are not involved in this method ?
 
+    /**
+     * @brief Computes the time left before each capability of the character is available.
+     *
+     * A capability is available once its own cooldown elapsed and the character is no longer busy.
+     * @param now The current time.
+     * @param times Receives REMAINING_TIME_COUNT times in seconds: 0 when available, NO_CAPABILITY when the
+     * character does not have it, infinity for the jumps given back on landing. The last one is the time
+     * left in the hurt animation.
+     */
+    void getRemainingTimes(std::chrono::time_point<std::chrono::steady_clock> now, std::span<double> times) const;
+
+    /**
+     * @brief Retrieves the phase of the attack the character used last.
+     * @param now The current time.
+     * @return The state of the attack, IDLE with no attack if the character never attacked.
+     * @see Attack::getPhase
+     */
+    [[nodiscard]] AttackState getAttackState(std::chrono::time_point<std::chrono::steady_clock> now) const;
+
     /**
      * @brief Applies damage to the character.
      * @param damage The amount of damage to apply.
@@ -192,6 +269,13 @@ public:
      */
     void hurt(int damage);
 
+    /**
+     * @brief Takes health from the character without the hurt animation, as damage over time does.
+     * @param damage The amount of health to take.
+     * @throws std::invalid_argument If the damage is negative.
+     */
+    void loseHealth(int damage);
+
     /**
      * @brief Retrieves the type of the character.
      * @return The type as a string.
@@ -222,26 +306,43 @@ public:
     void stopMoving(const std::string& movementName);
 
     /**
-     * @brief Increases the character's Maximum health
-     * by a specified amount and sets the current health to the new maximum.
-     * @param amount The amount to increase the health by.
-     * @throws std::invalid_argument If the amount is negative.
+     * @brief Adds a modifier to the stats of the character and recomputes its derived stats.
+     *
+     * An item raising the maximum health also fully heals a living character.
+     * @param modifier The modifier.
+     * @throws std::invalid_argument If the multiplier is negative.
+     */
+    void addModifier(const Modifier&modifier);
+
+    /**
+     * @brief Extends the expiry of a modifier the character already has, or adds it.
+     * @param modifier The modifier.
+     * @return True if the modifier was added, false if it was extended.
+     * @throws std::invalid_argument If the multiplier is negative.
+     * @see ModifierStack::refresh
+     */
+    bool refreshModifier(const Modifier&modifier);
+
+    /**
+     * @brief Removes the modifiers that expired and recomputes the derived stats if any was removed.
+     *
+     * Costs a single comparison while no modifier is due.
+     * @param now The current time.
+     * @return True if a modifier was removed, otherwise false.
      */
-    void increaseMaxHealth(int amount);
+    bool expireModifiers(ModifierStack::TimePoint now);
 
     /**
-     * @brief Increases a character's movement force by a specified amount.
-     * @param movementName The movement to increase the force of.
-     * @param amount The amount to increase the force by.
+     * @brief Retrieves the factor applied to the damage of the hits the character takes.
+     * @return The DAMAGE_TAKEN stat, 1 without modifiers, at least 0.
      */
-    void increaseMovementForce(const std::string&movementName, double amount);
+    [[nodiscard]] double getDamageTakenFactor() const;
 
     /**
-     * @brief Increases the damage of a character's attacks by a specified amount.
-     * @param amount The amount to increase the damage by.
-     * @param attackName The list of the character's attacks to increase the damage of.
+     * @brief Retrieves the modifiers of the character.
+     * @return The modifier stack.
      */
-    void increaseAttackDamage(double amount, const std::vector<std::string>& attackName);
+    [[nodiscard]] const ModifierStack& getModifiers() const;
 
     /**
      * @brief Retrieves the names of all character attacks.
@@ -255,5 +356,56 @@ public:
      * @return The amount of the item in the inventory.
      */
     int getNumberOfItem(int item_id) const;
+
+    /**
+     * @brief Retrieves the position of the character.
+     * @return The position in world coordinates.
+     */
+    [[nodiscard]] Vector2D getPosition() const;
+
+    /**
+     * @brief Sets the position of the character.
+     * @param newPosition The new position in world coordinates.
+     */
+    void setPosition(const Vector2D&newPosition);
+
+    /**
+     * @brief Retrieves the velocity of the character.
+     * @return The velocity, in world units per second.
+     */
+    [[nodiscard]] Vector2D getVelocity() const;
+
+    /**
+     * @brief Sets the velocity of the character.
+     * @param newVelocity The new velocity, in world units per second.
+     */
+    void setVelocity(const Vector2D&newVelocity);
+
+    /**
+     * @brief Retrieves the horizontal run input of the character.
+     * @return The run input, between -1 (left) and 1 (right).
+     */
+    [[nodiscard]] double getRunInput() const;
+
+    /**
+     * @brief Sets the horizontal run input of the character, which also turns it when not null.
+     * @param input The run input, clamped between -1 (left) and 1 (right).
+     */
+    void setRunInput(double input);
+
+    /**
+     * @brief Retrieves the horizontal direction the character faces.
+     * @return 1 if the character faces right, -1 if it faces left.
+     */
+    [[nodiscard]] int getFacing() const;
+
+    /**
+     * @brief Checks if the character is currently using a movement, the JetPack included.
+     * @param movementName The name of the movement.
+     * @param now The current time.
+     * @return True if the character has the movement and is using it, otherwise false.
+     */
+    [[nodiscard]] bool isUsingMovement(const std::string&movementName,
+                                       std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now()) const;
 };
 #endif //CHARACTER_HPP
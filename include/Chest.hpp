@@ -16,6 +16,8 @@
  * @brief Represents a chest object that can be opened to reveal an item.
  */
 class Chest {
+    friend class Snapshot;
+
     int id; ///< The unique identifier of the chest.
     Item item; ///< The item contained in the chest.
     bool empty; ///< Indicates whether the chest is empty.
@@ -14,6 +14,8 @@
  * @brief Represents the climbing movement
  */
 class Climb : public Movement {
+    friend class Snapshot;
+
     bool climbing = false; ///< Indicates whether the character is climbing
 public:
     /**
@@ -35,9 +37,10 @@ public:
 
     /**
      * @brief Checks if the character is climbing
+     * @param now Unused, climbing lasts until stopped.
      * @return climbing status
      */
-    bool isUsing() const override;
+    bool isUsing(std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now()) const override;
 
     /**
      * @brief Checks if the climbing movement is available
@@ -45,5 +48,11 @@ public:
      * @return true
      */
     bool canUse() const override;
+
+    /**
+     * @brief Copies the climb, whether the character climbs included with its state.
+     * @return The copy, owned by nobody else.
+     */
+    [[nodiscard]] std::shared_ptr<Movement> clone() const override;
 };
 #endif //CLIMB_HPP
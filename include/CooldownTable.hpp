@@ -0,0 +1,123 @@
+/**
+ * @file CooldownTable.hpp
+ * @brief Defines the CooldownTable class, the readiness of the capabilities of many characters as bitmasks.
+ *
+ * Asking each Attack or Movement whether it can be used sums durations and reads the clock, one
+ * object at a time. The table instead stores, for each capability of each character, the tick at
+ * which it becomes available, as a structure of arrays: one contiguous array of ticks per capability.
+ * The rows are only refreshed when a character uses a capability, is hurt or lands; once per tick,
+ * a single pass compares every array against the current tick and packs the results into one
+ * readiness bitmask per character. The pass is branch-free over contiguous integers, so the
+ * compiler vectorizes it.
+ *
+ * Only the enemies of a Level have a row: the table pays off for the hundreds of enemies the AI
+ * polls every tick, whereas the players, Game::MAX_PLAYERS at most, are asked for their readiness
+ * directly, through Game::getCharacterRemainingTimes or the expiry events of Game::drainTimerEvents.
+ */
+#ifndef COOLDOWNTABLE_HPP
+#define COOLDOWNTABLE_HPP
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "Character.hpp"
+
+/**
+ * @class CooldownTable
+ * @brief Ready-at ticks of the capabilities of a set of characters, and their readiness bitmasks.
+ *
+ * Bit i of a mask stands for the capability at index i of Character::getRemainingTimes: the attacks
+ * (Attacks), then the movements (Movements). The characters are identified by their slot, that is
+ * their index in their owner.
+ */
+class CooldownTable {
+public:
+    using Mask = std::uint16_t; ///< Readiness bitmask of a character.
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    static constexpr std::size_t CAPABILITIES = Character::REMAINING_TIME_COUNT - 1; ///< Attacks and movements.
+    static constexpr std::int64_t NEVER = std::numeric_limits<std::int64_t>::max(); ///< Tick of a missing capability.
+    static_assert(CAPABILITIES <= sizeof(Mask) * 8, "A mask must hold a bit per capability");
+
+private:
+    TimePoint origin; ///< The time of tick 0.
+    std::array<std::vector<std::int64_t>, CAPABILITIES> readyAt; ///< Ready-at tick of each capability, per slot.
+    std::vector<Mask> masks; ///< Readiness bitmask of each slot, as of the last pass.
+
+    /**
+     * @brief Converts a time to a tick, in milliseconds since the origin.
+     * @param time The time.
+     * @return The tick.
+     */
+    [[nodiscard]] std::int64_t toTick(TimePoint time) const;
+
+public:
+    /**
+     * @brief Constructs an empty table.
+     * @param origin The time of tick 0.
+     */
+    explicit CooldownTable(TimePoint origin = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Recomputes the row of a character from its capabilities.
+     *
+     * Jumps are given back on landing rather than after a delay: an exhausted jump is never ready
+     * until the row is refreshed after the character lands.
+     * @param slot The slot of the character, at most the number of rows to append a row.
+     * @param character The character.
+     * @param now The current time.
+     * @throws std::out_of_range If the slot is beyond the number of rows.
+     */
+    void update(std::size_t slot, const Character&character, TimePoint now);
+
+    /**
+     * @brief Computes the readiness bitmask of every row in one pass.
+     * @param now The current time.
+     */
+    void computeMasks(TimePoint now);
+
+    /**
+     * @brief Removes the last rows, keeping the first ones.
+     * @param count The number of rows kept.
+     */
+    void truncate(std::size_t count);
+
+    /**
+     * @brief Retrieves the readiness bitmask of a row, as of the last pass.
+     * @param slot The slot of the character.
+     * @return The bitmask.
+     * @throws std::out_of_range If the slot is invalid.
+     */
+    [[nodiscard]] Mask getMask(std::size_t slot) const;
+
+    /**
+     * @brief Retrieves the readiness bitmasks of every row, as of the last pass.
+     * @return The bitmasks, indexed by slot.
+     */
+    [[nodiscard]] const std::vector<Mask>& getMasks() const;
+
+    /**
+     * @brief Retrieves the bit of a capability.
+     * @param capability The index of the capability: an attack (Attacks), or DefinedAttacks::size() plus a movement.
+     * @return The bit.
+     */
+    static constexpr Mask bit(const std::size_t capability) {
+        return static_cast<Mask>(1u << capability);
+    }
+
+    /**
+     * @brief Retrieves the bits of every attack.
+     * @return The bits.
+     */
+    static constexpr Mask attackBits() {
+        return static_cast<Mask>((1u << magic_enum::enum_count<Attacks>()) - 1);
+    }
+
+    /**
+     * @brief Retrieves the number of rows.
+     * @return The number of rows.
+     */
+    [[nodiscard]] std::size_t size() const;
+};
+#endif //COOLDOWNTABLE_HPP
@@ -0,0 +1,103 @@
+/**
+ * @file DamageBuffer.hpp
+ * @brief Defines the DamageBuffer class, the hits of a tick waiting to be resolved together.
+ *
+ * Instead of hurting a character as soon as an attack lands, the hits are pushed into a buffer and
+ * resolved in one pass: grouped by target, scaled by the damage-taken modifiers of the target,
+ * summed, then applied once per target, which clamps its health and starts its hurt animation at
+ * most once. The hits of a target are summed in the order they were pushed, so that simultaneous
+ * hits resolve the same way whatever the order of the targets, and the hit that brings the health
+ * of a target to zero is credited with the kill.
+ */
+#ifndef DAMAGEBUFFER_HPP
+#define DAMAGEBUFFER_HPP
+#include <span>
+#include <vector>
+#include "Character.hpp"
+
+/**
+ * @struct DamageHit
+ * @brief A hit waiting to be resolved.
+ */
+struct DamageHit {
+    int sourceId; ///< The ID of the attacking character.
+    int targetId; ///< The ID of the character hit.
+    int damage; ///< The damage of the hit, before the modifiers of the target.
+};
+
+/**
+ * @struct DamageResult
+ * @brief The outcome of the hits of a tick on a target.
+ */
+struct DamageResult {
+    int targetId; ///< The ID of the character hit.
+    int damage; ///< The total damage dealt, after the modifiers of the target.
+    int killerId; ///< The ID of the character whose hit brought the health to zero, -1 if none did.
+    bool hurtStarted; ///< True if the hits started the hurt animation of the target.
+};
+
+/**
+ * @struct DeathEvent
+ * @brief A character killed by a hit.
+ */
+struct DeathEvent {
+    int victimId; ///< The ID of the character killed.
+    int killerId; ///< The ID of the character credited with the kill.
+};
+
+/**
+ * @class DamageBuffer
+ * @brief Hits collected during a tick.
+ */
+class DamageBuffer {
+    std::vector<DamageHit> hits; ///< The hits, in the order they were pushed until sorted.
+
+public:
+    /**
+     * @brief Adds a hit to the buffer.
+     * @param hit The hit.
+     * @throws std::invalid_argument If the damage is negative.
+     */
+    void push(const DamageHit&hit);
+
+    /**
+     * @brief Groups the hits by target, keeping the order in which the hits of a target were pushed.
+     * @return The hits, sorted by target ID; valid until the buffer is modified.
+     */
+    std::span<const DamageHit> sortByTarget();
+
+    /**
+     * @brief Checks if the buffer holds no hit.
+     * @return True if there is no hit, otherwise false.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Retrieves the number of hits.
+     * @return The number of hits.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Removes every hit.
+     */
+    void clear();
+
+    /**
+     * @brief Finds the end of the hits of a target.
+     * @param hits Hits grouped by target.
+     * @param first The index of the first hit of the target.
+     * @return The index following the last hit of the target.
+     */
+    static std::size_t endOfTarget(std::span<const DamageHit> hits, std::size_t first);
+
+    /**
+     * @brief Sums the hits of a target, without applying them.
+     * @param target The character hit.
+     * @param hits The hits of the character, in the order they were pushed.
+     * @return The outcome of the hits; the killer is the source of the hit that brings the current
+     * health of the target to zero, -1 if the target survives or was already dead.
+     */
+    static DamageResult total(const Character&target, std::span<const DamageHit> hits);
+};
+#endif //DAMAGEBUFFER_HPP
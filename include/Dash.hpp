@@ -39,5 +39,11 @@ public:
      * @param cooldown The cooldown time in seconds before the dash can be used again.
      */
     Dash(double force, double animationTime, double cooldown);
+
+    /**
+     * @brief Copies the dash with its state.
+     * @return The copy, owned by nobody else.
+     */
+    [[nodiscard]] std::shared_ptr<Movement> clone() const override;
 };
 #endif //DASH_HPP
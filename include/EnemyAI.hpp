@@ -0,0 +1,157 @@
+/**
+ * @file EnemyAI.hpp
+ * @brief Defines the EnemyPerception, EnemyCommands and EnemyAI classes, deciding what every enemy does in one pass.
+ *
+ * Driving the enemies from the engine takes several calls per enemy and per frame: its follow and
+ * attack ranges, whether its attack is ready, then the run input or the attack. The state the
+ * decision needs is instead gathered into a structure of arrays, one pass decides for every enemy
+ * from these arrays alone, and the commands are applied through the same calls as the actions of
+ * the player. The pass reads and writes contiguous arrays and each enemy only depends on its own
+ * row, so it is split across worker threads when there are enough enemies.
+ *
+ * Every enemy chooses its preferred target, the player with the most threat on it, or else the
+ * nearest of the targets, the players, then follows a rule:
+ * - within its attack range and in its line of sight, it stops and uses its first ready attack;
+ * - within its follow range, it runs toward the target, around the wall hiding it if need be;
+ * - beyond it, it stops.
+ */
+#ifndef ENEMYAI_HPP
+#define ENEMYAI_HPP
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "Vector2D.hpp"
+
+/**
+ * @struct EnemyPerception
+ * @brief Structure of arrays holding what a batch of enemies knows when deciding.
+ */
+struct EnemyPerception {
+    std::vector<int> ids; ///< The IDs of the enemies.
+    std::vector<double> x; ///< The horizontal positions.
+    std::vector<double> y; ///< The vertical positions.
+    std::vector<double> followRange; ///< The follow ranges.
+    std::vector<double> attackRange; ///< The attack ranges.
+    std::vector<std::int8_t> readyAttack; ///< The first ready attack (Attacks) of each enemy, -1 if none is.
+    std::vector<std::int8_t> preferredTarget; ///< The index of the target each enemy prefers, -1 for the nearest.
+    std::vector<std::uint32_t> targetsInSight; ///< One bit per target within the attack range of each enemy and in its line of sight.
+
+    static constexpr std::size_t MAX_TARGETS_IN_SIGHT = 32; ///< Number of targets with a bit in targetsInSight; the others are never seen.
+    static constexpr std::uint32_t ALL_IN_SIGHT = UINT32_MAX; ///< Sight of an enemy no tile hides any target from.
+
+    /**
+     * @brief Appends an enemy.
+     * @param id The ID of the enemy.
+     * @param position The position of the enemy.
+     * @param follow The follow range of the enemy.
+     * @param attack The attack range of the enemy.
+     * @param ready The first ready attack of the enemy, -1 if none is.
+     * @param preferred The index of the target the enemy prefers, -1 for the nearest.
+     * @param inSight One bit per target in the line of sight of the enemy.
+     */
+    void add(int id, const Vector2D&position, double follow, double attack, int ready, int preferred = -1,
+             std::uint32_t inSight = ALL_IN_SIGHT);
+
+    /**
+     * @brief Reserves storage for a number of enemies.
+     * @param capacity The number of enemies.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Retrieves the number of enemies.
+     * @return The number of enemies.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Removes every enemy, keeping the storage.
+     */
+    void clear();
+};
+
+/**
+ * @struct EnemyCommands
+ * @brief Structure of arrays holding the decision of each enemy of an EnemyPerception, in the same order.
+ */
+struct EnemyCommands {
+    std::vector<double> runInputs; ///< The run input of each enemy, -1, 0 or 1.
+    std::vector<std::int8_t> attacks; ///< The attack (Attacks) each enemy uses, -1 for none.
+    std::vector<int> targets; ///< The index of the target each enemy engages, -1 if none is within its follow range.
+
+    /**
+     * @brief Resizes the commands to a number of enemies.
+     * @param count The number of enemies.
+     */
+    void resize(std::size_t count);
+
+    /**
+     * @brief Retrieves the number of enemies.
+     * @return The number of enemies.
+     */
+    [[nodiscard]] std::size_t size() const;
+};
+
+/**
+ * @class EnemyAI
+ * @brief Decides the commands of a batch of enemies, on worker threads for large batches.
+ */
+class EnemyAI {
+    unsigned workers; ///< The maximum number of threads of a pass, the calling one included.
+    std::size_t minBatch; ///< The minimum number of enemies per thread.
+
+public:
+    static constexpr std::size_t DEF_MIN_BATCH = 16384; ///< Default enemies per thread, below which starting one costs more than it saves.
+
+    /**
+     * @brief Constructs an EnemyAI.
+     * @param workers The maximum number of threads of a pass, the calling one included.
+     * @param minBatch The minimum number of enemies per thread.
+     * @throws std::invalid_argument If a parameter is 0.
+     */
+    explicit EnemyAI(unsigned workers = 1, std::size_t minBatch = DEF_MIN_BATCH);
+
+    /**
+     * @brief Sets the maximum number of threads of a pass.
+     * @param count The number of threads, the calling one included.
+     * @throws std::invalid_argument If the number is 0.
+     */
+    void setWorkers(unsigned count);
+
+    /**
+     * @brief Retrieves the maximum number of threads of a pass.
+     * @return The number of threads, the calling one included.
+     */
+    [[nodiscard]] unsigned getWorkers() const;
+
+    /**
+     * @brief Decides the commands of every enemy of a batch.
+     *
+     * The batch is split into contiguous ranges of at least minBatch enemies, one per thread; the
+     * calling thread takes the first one and waits for the others.
+     * @param perception The enemies.
+     * @param targets The positions of the targets, typically the living players.
+     * @param commands The commands, overwritten.
+     */
+    void decide(const EnemyPerception&perception, std::span<const Vector2D> targets, EnemyCommands&commands) const;
+
+    /**
+     * @brief Decides the commands of every enemy of a batch against a single target.
+     * @param perception The enemies.
+     * @param target The position of the target, typically the player.
+     * @param commands The commands, overwritten.
+     */
+    void decide(const EnemyPerception&perception, const Vector2D&target, EnemyCommands&commands) const;
+
+    /**
+     * @brief Decides the commands of a range of enemies of a batch.
+     * @param perception The enemies.
+     * @param targets The positions of the targets, typically the living players.
+     * @param commands The commands, already sized to the batch; only the range is written.
+     * @param begin The index of the first enemy of the range.
+     * @param end The index past the last enemy of the range.
+     */
+    static void decide(const EnemyPerception&perception, std::span<const Vector2D> targets, EnemyCommands&commands,
+                       std::size_t begin, std::size_t end);
+};
+#endif //ENEMYAI_HPP
@@ -0,0 +1,64 @@
+/**
+ * @file FlowField.hpp
+ * @brief Defines the FlowField class, the chase directions of every area toward a single target.
+ *
+ * Every area of the level stores the point its occupants should head to: the gateway leading
+ * toward the area of the target, or the target itself within its own area. The field is rebuilt
+ * only when the target changes area, reading the cached distance field of the navigation graph,
+ * so that any number of chasers read their direction in O(1).
+ */
+#ifndef FLOWFIELD_HPP
+#define FLOWFIELD_HPP
+#include <cstdint>
+#include <vector>
+#include "NavigationGraph.hpp"
+#include "TileMap.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @class FlowField
+ * @brief Direction field toward a target, shared by all the characters chasing it.
+ */
+class FlowField {
+    int length = 0; ///< Number of areas along the x axis.
+    int height = 0; ///< Number of areas along the y axis.
+    double areaSize = 0.0; ///< Side length of an area, in world units.
+    int targetX = -1; ///< The x-coordinate of the area of the target, -1 before the first update.
+    int targetY = -1; ///< The y-coordinate of the area of the target, -1 before the first update.
+    Vector2D target{0.0, 0.0}; ///< The position of the target.
+    std::vector<Vector2D> waypoints; ///< Point to head to from each area.
+    std::vector<std::uint8_t> guided; ///< 1 for each area with a waypoint, 0 for the areas that cannot reach the target.
+    std::size_t rebuilds = 0; ///< Number of times the waypoints have been rebuilt.
+
+public:
+    /**
+     * @brief Moves the target, rebuilding the waypoints if it changed area.
+     * @param navigation The navigation graph of the level.
+     * @param tileMap The tile map of the level, locating the gateways.
+     * @param position The position of the target; ignored if it is not finite.
+     * @return True if the waypoints have been rebuilt, otherwise false.
+     */
+    bool update(NavigationGraph&navigation, const TileMap&tileMap, const Vector2D&position);
+
+    /**
+     * @brief Retrieves the direction a chaser should follow.
+     * @param position The position of the chaser.
+     * @return The unit direction, or a null vector if the chaser cannot reach the target, stands on it or
+     * has a position that is not finite.
+     */
+    [[nodiscard]] Vector2D getDirection(const Vector2D&position) const;
+
+    /**
+     * @brief Retrieves the direction of a batch of chasers.
+     * @param positions The positions of the chasers.
+     * @param directions Receives the direction of each chaser, in the same order.
+     */
+    void getDirections(const std::vector<Vector2D>&positions, std::vector<Vector2D>&directions) const;
+
+    /**
+     * @brief Retrieves the number of times the waypoints have been rebuilt.
+     * @return The number of rebuilds.
+     */
+    [[nodiscard]] std::size_t getRebuildCount() const;
+};
+#endif //FLOWFIELD_HPP
@@ -0,0 +1,96 @@
+/**
+ * @file FramePool.hpp
+ * @brief Defines the FramePool class, a fixed-block allocator for the frames of the behaviour coroutines.
+ *
+ * Every coroutine allocates a frame holding its locals when it starts. Instead of the heap, the
+ * frames of the behaviours come from blocks of a fixed size carved out of large chunks and recycled
+ * through a free list, so starting and ending a behaviour costs a couple of pointer moves once the
+ * pool has grown to its working size. A frame larger than a block falls back to the heap.
+ *
+ * Each allocation starts with a header pointing back to its pool, so that the frame can be released
+ * from the sized operator delete of the coroutine, which only receives the address and the size.
+ */
+#ifndef FRAMEPOOL_HPP
+#define FRAMEPOOL_HPP
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class FramePool
+ * @brief Pool of fixed-size memory blocks.
+ */
+class FramePool {
+public:
+    static constexpr std::size_t DEF_BLOCK_SIZE = 1024; ///< Default size of a block, header included.
+    static constexpr std::size_t BLOCKS_PER_CHUNK = 64; ///< Number of blocks allocated at once when the pool is empty.
+    static constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t); ///< Size of the header, keeping the frames aligned.
+
+private:
+    std::size_t blockSize = DEF_BLOCK_SIZE; ///< Size of a block, header included.
+    std::vector<std::unique_ptr<std::byte[]>> chunks; ///< The memory of the blocks.
+    void* freeBlocks = nullptr; ///< The first free block, each free block storing the address of the next one.
+    std::size_t capacity = 0; ///< Number of blocks allocated.
+    std::size_t used = 0; ///< Number of blocks handed out.
+    std::size_t overflows = 0; ///< Number of allocations too large for a block, served by the heap.
+
+    /**
+     * @brief Allocates a chunk of blocks and adds them to the free list.
+     */
+    void grow();
+
+public:
+    /**
+     * @brief Constructs a FramePool with the default block size.
+     */
+    FramePool() = default;
+
+    /**
+     * @brief Constructs a FramePool with a specified block size.
+     * @param blockSize The size of a block, header included.
+     * @throws std::invalid_argument If a block cannot hold the header and a pointer.
+     */
+    explicit FramePool(std::size_t blockSize);
+
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /**
+     * @brief Allocates memory for a frame.
+     * @param size The size of the frame.
+     * @return The address of the frame, aligned like std::max_align_t.
+     */
+    void* allocate(std::size_t size);
+
+    /**
+     * @brief Releases a frame allocated by a pool.
+     * @param frame The address of the frame.
+     * @param size The size of the frame, as passed to allocate.
+     */
+    static void deallocate(void* frame, std::size_t size);
+
+    /**
+     * @brief Allocates blocks in advance, so that this many frames are served without growing.
+     * @param blocks The number of blocks.
+     */
+    void reserve(std::size_t blocks);
+
+    /**
+     * @brief Retrieves the number of blocks handed out.
+     * @return The number of blocks in use.
+     */
+    [[nodiscard]] std::size_t getUsedBlocks() const;
+
+    /**
+     * @brief Retrieves the number of blocks allocated.
+     * @return The number of blocks, used or free.
+     */
+    [[nodiscard]] std::size_t getCapacity() const;
+
+    /**
+     * @brief Retrieves the number of frames too large for a block, served by the heap.
+     * @return The number of such allocations since the pool was created.
+     */
+    [[nodiscard]] std::size_t getOverflowCount() const;
+};
+#endif //FRAMEPOOL_HPP
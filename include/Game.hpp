@@ -5,19 +5,33 @@
  * @file Game.hpp
  * @brief Defines the Game class, managing the overall game state, including levels, player, and interactions.
  *
- * The Game class handles the progression of levels, the state of the player, and the interactions
- * between the player and enemies, including movement, attacks, and health management.
+ * The Game class handles the progression of levels, the state of the players, and the interactions
+ * between the players and enemies, including movement, attacks, and health management.
+ *
+ * A game holds one to MAX_PLAYERS players sharing its levels, for co-op sessions. The first one
+ * hosts the session: the methods about "the player" refer to it, while the methods taking an ID
+ * work with any player. The enemies target the nearest living player.
  */
 #ifndef GAME_HPP
 #define GAME_HPP
+#include <unordered_map>
 #include <unordered_set>
 #include <tuple>
 #include "Player.hpp"
 
 #include "Level.hpp"
+#include "SpawnDirector.hpp"
+#include "KinematicIntegrator.hpp"
+#include "TimerWheel.hpp"
+#include "StatusEffectPool.hpp"
+#include "DamageBuffer.hpp"
+#include "BehaviourScheduler.hpp"
+#include "ThreatTable.hpp"
 
 #include <vector>
 
+struct GameState;
+
 /**
  * @class Game
  * @brief Manages the overall game state, levels, player, and interactions.
@@ -26,14 +40,42 @@
  * player and enemy interactions, and game state queries.
  */
 class Game {
+    friend class Snapshot;
+
     int activeLevel; ///< The index of the currently active level.
     std::vector<Level> levels; ///< A list of levels in the game.
-    Player player; ///< The player character.
+    std::vector<Player> players; ///< The players, the host first.
+    std::unordered_map<int, std::size_t> playerIndex; ///< Index of each player in players, keyed by its ID.
+    std::vector<int> targetIds; ///< IDs of the living players, refreshed by gatherTargets.
+    std::vector<Vector2D> targetPositions; ///< Positions of the living players, in the order of targetIds.
+    std::vector<Vector2D> playerPositions; ///< Positions of every player, the foci of the activation of the enemies.
     bool over; ///< Flag indicating if the game is over.
     double difficulty = 1.0; ///< Coefficient to adjust the difficulty of the game.
     std::chrono::time_point<std::chrono::steady_clock> timeSinceDifficultyUpdate; ///< Record of Difficulty Update
+    SpawnDirector spawnDirector; ///< Decides when and where enemies of the active level are spawned.
+    KinematicIntegrator integrator; ///< Fixed-timestep integrator moving the characters.
+    KinematicBodies bodies; ///< Kinematic state of the characters, reused between steps.
+    int activationRadius = InterestManager::UNLIMITED; ///< Gateways around the player within which enemies are simulated.
+    TimerWheel timers; ///< Expiry events of the cooldowns and animations of the characters.
+    std::vector<TimerEvent> dueTimers; ///< Events that fell due but were not drained yet.
+    StatusEffectPool statusEffects; ///< Status effects of the player and the enemies of the active level.
+    std::vector<StatusTick> statusTicks; ///< Damage over time dealt by the last pass, reused between steps.
+    DamageBuffer damageBuffer; ///< Hits waiting to be resolved.
+    bool deferredDamage = false; ///< True to resolve the hits once per physics step rather than after each attack.
+    std::vector<DamageResult> damageResults; ///< Outcome of the last resolution on the enemies, reused between passes.
+    std::vector<DeathEvent> deaths; ///< Characters killed by a hit, not drained yet.
+    std::vector<DamageHit> projectileHits; ///< Hits of the projectiles during the last step, reused between steps.
+    BehaviourScheduler behaviours; ///< Scripted behaviours of the enemies, resumed by stepPhysics and stopped with the level.
+    EnemyAI enemyAI; ///< Decides the commands of the enemies not running a behaviour.
+    EnemyPerception perception; ///< State of the enemies read by the last AI pass, reused between passes.
+    EnemyCommands enemyCommands; ///< Commands decided by the last AI pass, reused between passes.
+    bool enemyAIEnabled = false; ///< True to run the AI pass at each physics step.
+    ThreatTable threat; ///< Threat of each player on the enemies of the active level, choosing their targets.
+    std::vector<int> threatTargets; ///< Player targeted by each enemy of the last AI pass, reused between passes.
+    std::chrono::time_point<std::chrono::steady_clock> lastEnemyAIUpdate; ///< Time of the last AI pass.
 
     static constexpr auto DIFFICULTY_INTERVAL = std::chrono::seconds(300); ///< Interval for difficulty updates.
+    static constexpr double MAX_THREAT_STEP = 0.25; ///< Longest time, in seconds, an AI pass credits with proximity threat.
 
     /**
      * @brief Updates the difficulty coefficient of the game.
@@ -58,6 +100,61 @@ class Game {
      */
     void next_level();
 
+    /**
+     * @brief Retrieves a player by its ID.
+     * @param id The ID of the player.
+     * @return The player, or null if no player has this ID.
+     */
+    Player* findPlayer(int id);
+
+    /**
+     * @brief Retrieves a player by its ID.
+     * @param id The ID of the player.
+     * @return The player, or null if no player has this ID.
+     */
+    [[nodiscard]] const Player* findPlayer(int id) const;
+
+    /**
+     * @brief Fills targetIds and targetPositions with the living players.
+     */
+    void gatherTargets();
+
+    /**
+     * @brief Ends the game if a player died and no other player is alive.
+     * @param fallen The ID of the player that died.
+     */
+    void onPlayerDeath(int fallen);
+
+    /**
+     * @brief Deals the damage over time due and removes the expired status effects.
+     *
+     * The players are damaged last, since their death may end the game.
+     * @param now The current time.
+     */
+    void tickStatusEffects(std::chrono::time_point<std::chrono::steady_clock> now);
+
+    /**
+     * @brief Schedules the end and the readiness of an attack a character just used.
+     * @param character The character.
+     * @param attackName The name of the attack.
+     */
+    void scheduleAttackTimers(const Character&character, const std::string&attackName);
+
+    /**
+     * @brief Schedules the end and the readiness of a movement a character just used.
+     *
+     * Movements without animation nor cooldown, such as RUN or JUMP, have nothing to schedule.
+     * @param character The character.
+     * @param movementName The name of the movement.
+     */
+    void scheduleMovementTimers(const Character&character, const std::string&movementName);
+
+    /**
+     * @brief Schedules the end of the hurt animation a character just started.
+     * @param character The character.
+     */
+    void scheduleHurtTimer(const Character&character);
+
 public:
     /**
      * @brief Constructs a new Game object, initializing levels and the player.
@@ -86,6 +183,53 @@ public:
      */
     [[nodiscard]] int get_area_guid_current_level(int x, int y) const;
 
+    static constexpr std::size_t MAX_PLAYERS = 16; ///< Maximum number of players of a session.
+
+    /**
+     * @brief Adds a player to the session, at the position of the host.
+     * @param primaryAttack The enum index of primary attack for the player.
+     * @param secondaryAttack The enum index of the secondary attack for the player.
+     * @param tertiaryAttack The enum index of the tertiary attack for the player.
+     * @return The ID of the player, or -1 if the session is full or an attack is invalid.
+     */
+    int addPlayer(int primaryAttack, int secondaryAttack, int tertiaryAttack);
+
+    /**
+     * @brief Removes a player from the session. The host cannot be removed.
+     *
+     * The threat and the status effects of the player are removed with it, and the game is over
+     * if no player left is alive.
+     * @param id The ID of the player.
+     * @return True if the player was removed, otherwise false.
+     */
+    bool removePlayer(int id);
+
+    /**
+     * @brief Checks if a character is a player.
+     * @param id The ID of the character.
+     * @return True if a player has this ID, otherwise false.
+     */
+    [[nodiscard]] bool isPlayer(int id) const;
+
+    /**
+     * @brief Retrieves the IDs of the players, the host first.
+     * @return The IDs.
+     */
+    [[nodiscard]] std::vector<int> getPlayerIds() const;
+
+    /**
+     * @brief Retrieves the number of players.
+     * @return The number of players, dead ones included.
+     */
+    [[nodiscard]] std::size_t getPlayerCount() const;
+
+    /**
+     * @brief Retrieves the living player nearest to a position, the one the enemies there target.
+     * @param position The position.
+     * @return The ID of the player, or -1 if every player is dead.
+     */
+    [[nodiscard]] int getNearestPlayer(const Vector2D&position) const;
+
     /**
      * @brief Retrieves the player's maximum health.
      * @return The player's maximum health.
@@ -114,6 +258,408 @@ public:
      */
     int ifCanSpawnCurrentLevelSpawnAt(int areaX, int areaY, int spawdId);
 
+    /**
+     * @brief Retrieves the ready spawn points of the current level; those not spawned are retrieved again next call.
+     * @param maxEvents The maximum number of events to pop; remaining ones are kept for the next call.
+     * @return The ready spawn points.
+     */
+    std::vector<SpawnEvent> drainSpawnEvents(int maxEvents);
+
+    /**
+     * @brief Pops the cooldowns and animations that expired since the last call, instead of polling them.
+     *
+     * Events of characters that no longer exist are dropped.
+     * @param maxEvents The maximum number of events to pop; remaining ones are kept for the next call.
+     * @return The expired states, in chronological order.
+     */
+    std::vector<TimerEvent> drainTimerEvents(int maxEvents);
+
+    /**
+     * @brief Pops the characters killed by a hit since the last call.
+     * @param maxEvents The maximum number of events to pop; remaining ones are kept for the next call.
+     * @return The deaths, in the order the hits were resolved.
+     */
+    std::vector<DeathEvent> drainDeathEvents(int maxEvents);
+
+    /**
+     * @brief Retrieves the time left before each capability of a character is available.
+     * @param id The ID of the character.
+     * @param times Receives Character::REMAINING_TIME_COUNT times, laid out as by Character::getRemainingTimes;
+     * left empty if the ID is invalid.
+     * @return True if the ID is valid, otherwise false.
+     */
+    bool getCharacterRemainingTimes(int id, std::vector<double>&times) const;
+
+    /**
+     * @brief Retrieves the time left before each capability of every character is available, all at the same time.
+     * @param ids Receives the IDs of the player, then of every enemy of the current level.
+     * @param times Receives Character::REMAINING_TIME_COUNT times per character, in the order of the IDs.
+     */
+    void getRemainingTimes(std::vector<int>&ids, std::vector<double>&times) const;
+
+    /**
+     * @brief Retrieves the phase of the last attack of every character, all at the same time.
+     * @param ids Receives the IDs of the player, then of every enemy of the current level.
+     * @param states Receives the state of the attack of each character, in the order of the IDs.
+     * @see Character::getAttackState
+     */
+    void getAttackStates(std::vector<int>&ids, std::vector<AttackState>&states) const;
+
+    /**
+     * @brief Retrieves a character of the current level without copying it.
+     * @param id The ID of the character.
+     * @return The character, valid until an enemy is added or the level changes.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    [[nodiscard]] const Character& getCharacter(int id) const;
+
+    /**
+     * @brief Starts a scripted behaviour driving an enemy, replacing the one it was running.
+     *
+     * The behaviour runs from the next stepPhysics on, and ends with the enemy or the level.
+     * @param id The ID of the enemy.
+     * @param behaviour The behaviour (Behaviours).
+     * @return True if the behaviour started, false if the ID is not that of a living enemy or the behaviour is invalid.
+     * @see BehaviourScheduler
+     */
+    bool startBehaviour(int id, int behaviour);
+
+    /**
+     * @brief Stops the scripted behaviour of an enemy, leaving it to the engine.
+     * @param id The ID of the enemy.
+     * @return True if the enemy was running a behaviour, otherwise false.
+     */
+    bool stopBehaviour(int id);
+
+    /**
+     * @brief Checks if an enemy is driven by a scripted behaviour.
+     * @param id The ID of the enemy.
+     * @return True if the enemy runs a behaviour, otherwise false.
+     */
+    [[nodiscard]] bool hasBehaviour(int id) const;
+
+    /**
+     * @brief Applies a temporary buff to a stat of a character, removed by stepPhysics once expired.
+     * @param id The ID of the character.
+     * @param stat The stat, as a Stats value.
+     * @param added The amount added to the base value of the stat.
+     * @param multiplier The factor applied to the stat.
+     * @param duration The duration of the buff, in seconds.
+     * @return True if the buff was applied, false if the ID or the stat is invalid, the multiplier
+     * is negative or the duration is not positive.
+     */
+    bool addCharacterBuff(int id, int stat, double added, double multiplier, double duration);
+
+    /**
+     * @brief Applies a status effect to many characters at once, refreshing it on those that already have it.
+     * @param ids The IDs of the characters; invalid IDs are skipped.
+     * @param type The effect, as a StatusEffectTypes value.
+     * @param magnitude The strength of the effect, as defined by its type.
+     * @param duration The duration of the effect, in seconds.
+     * @return The number of characters affected, 0 if the type is invalid, the magnitude negative or the
+     * duration not positive.
+     */
+    int applyStatusEffect(const std::vector<int>&ids, int type, double magnitude, double duration);
+
+    /**
+     * @brief Retrieves the time left before a status effect of a character ends.
+     * @param id The ID of the character.
+     * @param type The effect, as a StatusEffectTypes value.
+     * @return The time left, in seconds, 0 if the character does not have the effect, or -1 if the ID or
+     * the type is invalid.
+     */
+    [[nodiscard]] double getCharacterStatusEffectTime(int id, int type) const;
+
+    /**
+     * @brief Retrieves every active status effect at once.
+     * @param ids Receives the ID of the character of each effect.
+     * @param types Receives the type of each effect, as a StatusEffectTypes value.
+     * @param times Receives the time left before each effect ends, in seconds.
+     */
+    void getStatusEffects(std::vector<int>&ids, std::vector<int>&types, std::vector<double>&times) const;
+
+    /**
+     * @brief Spawns an enemy at every ready spawn point of the current level, up to a budget.
+     * @param budget The maximum number of enemies to spawn.
+     * @return The IDs of the spawned enemies.
+     */
+    std::vector<int> spawnReadyEnemies(int budget);
+
+    /**
+     * @brief Updates the game difficulty and lets the spawn director spend its credits on a wave.
+     * @param budget The maximum number of enemies to spawn during this update.
+     * @return The IDs of the spawned enemies.
+     * @see SpawnDirector::update
+     */
+    std::vector<int> updateSpawnDirector(int budget);
+
+    /**
+     * @brief Retrieves the position of a character by ID.
+     * @param id The ID of the character.
+     * @param position Receives the position of the character.
+     * @return True if the ID is valid, otherwise false.
+     */
+    bool getCharacterPosition(int id, Vector2D&position) const;
+
+    /**
+     * @brief Moves a character, keeping the spatial index of the level up to date.
+     * @param id The ID of the character.
+     * @param position The new position of the character.
+     */
+    void setCharacterPosition(int id, const Vector2D&position);
+
+    /**
+     * @brief Retrieves the velocity of a character by ID.
+     * @param id The ID of the character.
+     * @param velocity Receives the velocity of the character.
+     * @return True if the ID is valid, otherwise false.
+     */
+    bool getCharacterVelocity(int id, Vector2D&velocity) const;
+
+    /**
+     * @brief Sets the velocity of a character.
+     * @param id The ID of the character.
+     * @param velocity The new velocity of the character.
+     */
+    void setCharacterVelocity(int id, const Vector2D&velocity);
+
+    /**
+     * @brief Retrieves the alive enemies whose follow range contains a character.
+     * @param targetId The ID of the followed character, typically the player.
+     * @return The IDs of the enemies, or an empty vector if the ID is invalid.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesInFollowRange(int targetId) const;
+
+    /**
+     * @brief Retrieves the alive enemies whose attack range contains a character.
+     * @param targetId The ID of the targeted character, typically the player.
+     * @return The IDs of the enemies, or an empty vector if the ID is invalid.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesInAttackRange(int targetId) const;
+
+    /**
+     * @brief Retrieves the IDs of every enemy in the current level, in spawn order.
+     * @return The enemy IDs.
+     */
+    [[nodiscard]] std::vector<int> getEnemyIds() const;
+
+    /**
+     * @brief Checks if a character can hit another one: the target is in the attack range of
+     * an attacking enemy, and no solid tile stands between them.
+     *
+     * Players have no attack range, their attacks being aimed by the player: only the line of
+     * sight is checked for them. Game::attack does not perform this check, so that callers
+     * decide when to enforce it.
+     * @param id The ID of the attacking character.
+     * @param targetId The ID of the targeted character.
+     * @return True if the target can be hit, false otherwise or if an ID is invalid.
+     */
+    [[nodiscard]] bool canCharacterReach(int id, int targetId) const;
+
+    /**
+     * @brief Retrieves the alive enemies in attack range of a character and in line of sight of it.
+     * @param targetId The ID of the targeted character, typically the player.
+     * @return The IDs of the enemies, or an empty vector if the ID is invalid.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesInReach(int targetId) const;
+
+    /**
+     * @brief Retrieves the alive enemies in reach of a character with an attack ready at the last physics step.
+     * @param targetId The ID of the targeted character, typically the player.
+     * @return The IDs of the enemies, or an empty vector if the ID is invalid.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesReadyToAttack(int targetId) const;
+
+    /**
+     * @brief Retrieves the readiness bitmask of every enemy of the current level, as of the last physics step.
+     *
+     * The players have no bitmask: their readiness is given by getCharacterRemainingTimes.
+     * @param ids The IDs of the enemies, overwritten.
+     * @param masks The bitmask of each enemy, overwritten; bit i stands for the capability at index i of
+     * Character::getRemainingTimes.
+     */
+    void getEnemyReadiness(std::vector<int>&ids, std::vector<CooldownTable::Mask>&masks) const;
+
+    /**
+     * @brief Retrieves the player an enemy targets: the living one with the most threat on it, or else the nearest.
+     * @param enemyId The ID of the enemy.
+     * @return The ID of the player, or -1 if the ID is not an enemy or every player is dead.
+     * @see ThreatTable
+     */
+    [[nodiscard]] int getEnemyTarget(int enemyId) const;
+
+    /**
+     * @brief Retrieves the player each enemy of the current level targets, all at the same time.
+     * @param ids The IDs of the enemies, overwritten.
+     * @param targets The ID of the player each enemy targets, overwritten; -1 if every player is dead.
+     */
+    void getEnemyTargets(std::vector<int>&ids, std::vector<int>&targets) const;
+
+    /**
+     * @brief Makes an enemy target a player until the player loses its threat.
+     * @param playerId The ID of the taunting player.
+     * @param enemyId The ID of the taunted enemy.
+     * @return True if the enemy is taunted, false if an ID is invalid.
+     */
+    bool taunt(int playerId, int enemyId);
+
+    /**
+     * @brief Retrieves the threat of a player on an enemy.
+     * @param enemyId The ID of the enemy.
+     * @param playerId The ID of the player.
+     * @return The threat, 0 if there is none or an ID is invalid.
+     */
+    [[nodiscard]] double getThreat(int enemyId, int playerId) const;
+
+    /**
+     * @brief Retrieves the number of gateways a character must cross to reach the area of another one.
+     * @param id The ID of the moving character.
+     * @param targetId The ID of the targeted character.
+     * @return The distance, or -1 if the target cannot be reached or an ID is invalid.
+     */
+    int getAreaDistance(int id, int targetId);
+
+    /**
+     * @brief Retrieves the gateway a character should take to get closer to the area of another one.
+     * @param id The ID of the moving character.
+     * @param targetId The ID of the targeted character.
+     * @return The direction of the gateway, or (0, 0) if both share an area, if the target cannot be
+     * reached or if an ID is invalid.
+     */
+    Direction2D getNextGateway(int id, int targetId);
+
+    /**
+     * @brief Retrieves the gateway every alive enemy should take to get closer to the area of a character.
+     * @param targetId The ID of the targeted character, typically the player.
+     * @param ids The IDs of the enemies, overwritten; left empty if the target ID is invalid.
+     * @param gateways The direction of the gateway of each enemy, overwritten.
+     */
+    void getEnemyNextGateways(int targetId, std::vector<int>&ids, std::vector<Direction2D>&gateways);
+
+    /**
+     * @brief Retrieves the direction every alive enemy within follow range of a character should follow to reach it.
+     * @param targetId The ID of the chased character, typically the player.
+     * @param ids The IDs of the enemies, overwritten; left empty if the target ID is invalid.
+     * @param directions The unit direction of each enemy, overwritten.
+     */
+    void getChaseDirections(int targetId, std::vector<int>&ids, std::vector<Vector2D>&directions);
+
+    /**
+     * @brief Plans the moves a character needs to reach the ledge of another one, using only its own movements.
+     *
+     * The usable links are cached per movement profile, so that the enemies of an archetype share them.
+     * @param id The ID of the moving character.
+     * @param targetId The ID of the targeted character.
+     * @return The links to follow, empty if there is no such route or if an ID is invalid.
+     */
+    std::vector<LedgeLink> planRoute(int id, int targetId);
+
+    /**
+     * @brief Sets the activation radius: only the enemies within this number of gateways of the
+     * player are simulated, the others staying dormant until the player comes near.
+     * @param radius The radius, or InterestManager::UNLIMITED to simulate every enemy.
+     * @return True if the radius was set, false if it is negative and not UNLIMITED.
+     */
+    bool setActivationRadius(int radius);
+
+    /**
+     * @brief Retrieves the activation radius.
+     * @return The radius, or InterestManager::UNLIMITED.
+     */
+    [[nodiscard]] int getActivationRadius() const;
+
+    /**
+     * @brief Checks if a character is simulated. The player always is.
+     * @param id The ID of the character.
+     * @return True if the character is awake, false if it is dormant or if the ID is invalid.
+     */
+    [[nodiscard]] bool isCharacterAwake(int id) const;
+
+    /**
+     * @brief Retrieves the number of enemies of the current level that are awake, dead ones included.
+     * @return The number of enemies.
+     */
+    std::size_t getAwakeEnemyCount();
+
+    /**
+     * @brief Sets the horizontal run input of a character.
+     * @param id The ID of the character.
+     * @param input The run input, between -1 (left) and 1 (right).
+     */
+    void setCharacterRunInput(int id, double input);
+
+    /**
+     * @brief Decides what every alive and awake enemy does in one pass, then applies it: the enemies
+     * in attack range of their target and seeing it attack it with their first ready attack, those in
+     * follow range run toward it, the others stop.
+     *
+     * The target of an enemy is the living player with the most threat on it, or else the nearest
+     * one; the player an enemy engages gains threat on it over time. The attacks go through attack,
+     * like those of the player, and their hits are resolved together. The enemies running a
+     * behaviour are left to it.
+     * @return The number of enemies ordered to attack.
+     * @see EnemyAI
+     */
+    int updateEnemyAI();
+
+    /**
+     * @brief Sets whether stepPhysics runs updateEnemyAI before moving the characters.
+     * @param enabled True to drive the enemies from the library, false to leave them to the caller.
+     */
+    void setEnemyAI(bool enabled);
+
+    /**
+     * @brief Sets the maximum number of threads deciding the commands of the enemies.
+     * @param workers The number of threads, the calling one included.
+     * @return True if the number was set, false if it is not strictly positive.
+     */
+    bool setEnemyAIWorkers(int workers);
+
+    /**
+     * @brief Moves the player and the alive enemies of the current level for the elapsed time.
+     *
+     * The time is consumed in fixed steps; the remainder is carried over to the next call, so
+     * the simulation does not depend on how often it is called. The projectiles in flight move
+     * for the elapsed time, and their hits are resolved like those of attack. The scripted
+     * behaviours whose wait is over are resumed first, then the AI pass runs if enabled.
+     * @param elapsedSeconds The time elapsed since the previous call.
+     * @return The number of fixed steps integrated.
+     * @throws std::invalid_argument If the elapsed time is negative.
+     * @see KinematicIntegrator
+     */
+    int stepPhysics(double elapsedSeconds);
+
+    /**
+     * @brief Retrieves a tile of the current level.
+     * @param x The x-coordinate of the tile.
+     * @param y The y-coordinate of the tile.
+     * @return The tile, solid if outside of the level.
+     * @see Tile
+     */
+    [[nodiscard]] Tile getTileAt(int x, int y) const;
+
+    /**
+     * @brief Checks if a box overlaps a solid tile of the current level.
+     * @param box The box, in world coordinates.
+     * @return True if a solid tile overlaps the box, otherwise false.
+     */
+    [[nodiscard]] bool overlapsSolidTile(const AABB&box) const;
+
+    /**
+     * @brief Casts a segment through the tiles of the current level.
+     * @param ray The segment.
+     * @return The hit, or a clear result at the end of the segment.
+     * @see TileMap::raycast
+     */
+    [[nodiscard]] RayHit raycast(const RaySegment&ray) const;
+
+    /**
+     * @brief Casts a batch of segments through the tiles of the current level.
+     * @param rays The segments.
+     * @param hits Receives one result per segment, in the same order.
+     */
+    void raycast(const std::vector<RaySegment>&rays, std::vector<RayHit>&hits) const;
+
     /**
      * @brief Retrieves the type of a character by ID.
      * @param id The character's ID.
@@ -292,6 +838,7 @@ public:
      * @param areaY The y-coordinate of the area.
      * @param area_id The ID of the spawn point.
      * @return The ID of the spawned boss, or -1 if the spawn is not possible.
+     * @see startBehaviour to let the BOSS behaviour drive it.
      */
     int activateBossSpawn(int area_x, int area_y, int area_id);
 
@@ -330,6 +877,16 @@ public:
      */
     int openChest(int area_x, int area_y, int chest_id);
 
+    /**
+     * @brief Opens a chest in a specific area for a player, the item going to its inventory.
+     * @param playerId The ID of the player.
+     * @param area_x The x-coordinate of the area.
+     * @param area_y The y-coordinate of the area.
+     * @param chest_id The ID of the chest to open.
+     * @return The ID of the item found in the chest, or -1 if the player ID is invalid.
+     */
+    int openChest(int playerId, int area_x, int area_y, int chest_id);
+
     /**
      * @brief Retrieves the number of a specific item in the player's inventory.
      * @param id The ID of the player.
@@ -342,6 +899,12 @@ public:
 
     void useHealthPotionIfAvailable();
 
+    /**
+     * @brief Uses a health potion from the inventory of a player, if it has one.
+     * @param playerId The ID of the player.
+     */
+    void useHealthPotionIfAvailable(int playerId);
+
     /**
      * @brief Retrieves the names of all character attacks.
      * @return A set of attack names.
@@ -367,10 +930,66 @@ public:
      * @param id The ID of the attacking character.
      * @param attackName The name of the attack.
      * @param targetId The ID of the target character.
-     * @throws std::invalid_argument If the attack is invalid or the ids are not valid.
+     * @throws std::invalid_argument If the attack is invalid, the ids are not valid or a player targets a player.
      */
     void attack(int id, const std::string& attackName, int targetId);
 
+    /**
+     * @brief Chooses when the hits of the attacks are applied.
+     *
+     * By default, the hits of an attack are resolved as soon as it is used. Deferred, the hits are collected
+     * and resolved together at the start of the next physics step, so that simultaneous hits resolve the
+     * same way whatever the order of the calls. Ending the deferral resolves the pending hits.
+     * @param deferred True to resolve the hits once per physics step, false to resolve them after each attack.
+     * @see resolveDamage
+     */
+    void setDeferredDamage(bool deferred);
+
+    /**
+     * @brief Checks if the hits are resolved once per physics step.
+     * @return True if the hits are deferred, otherwise false.
+     */
+    [[nodiscard]] bool isDamageDeferred() const;
+
+    /**
+     * @brief Resolves the pending hits in one pass: grouped by target, scaled by the damage taken by each
+     * target, then applied once per target, starting its hurt animation and recording the deaths.
+     * @see DamageBuffer
+     */
+    void resolveDamage();
+
+    /**
+     * @brief Uses an area attack, hitting every opponent within its area at once.
+     *
+     * The player hits the enemies found by a single query of the spatial index; an enemy hits the player.
+     * The hits are resolved like those of attack.
+     * @param id The ID of the attacking character.
+     * @param attackName The name of the attack.
+     * @return The characters hit, with the damage before their modifiers, empty if the attack cannot be used yet.
+     * @throws std::invalid_argument If the ID or the attack name is invalid, or if the attack is not an area attack.
+     * @see DefinedAttacks::getAreaOfEffect
+     */
+    std::vector<AreaHit> attackArea(int id, const std::string&attackName);
+
+    /**
+     * @brief Uses a ranged attack, firing a projectile that moves with stepPhysics.
+     *
+     * The projectile of the player hits the enemies, that of an enemy hits the player.
+     * @param id The ID of the attacking character.
+     * @param attackName The name of the attack.
+     * @param direction The direction of the shot; the facing direction of the character if null.
+     * @return The ID of the projectile, -1 if the attack cannot be used yet or too many projectiles are in flight.
+     * @throws std::invalid_argument If the ID or the attack name is invalid, or if the attack is not a ranged attack.
+     * @see DefinedAttacks::getRangedProfile
+     */
+    int shoot(int id, const std::string&attackName, const Vector2D&direction);
+
+    /**
+     * @brief Retrieves the projectiles in flight within the current level.
+     * @return The pool of the projectiles.
+     */
+    [[nodiscard]] const ProjectilePool& getProjectiles() const;
+
     /**
      * @brief Moves a character using a specific movement.
      * @param id The ID of the character to move.
@@ -455,5 +1074,45 @@ public:
      * @throws std::runtime_error If the level cannot be ended.
      */
     void nextLevel(int bossId);
+
+    /**
+     * @brief Makes a loaded level the active one, unloading the previous one as when a level ends.
+     * @param level The level, whose ID must follow the one of the active level.
+     * @throws std::invalid_argument If the level is not loaded or its ID does not follow the active one.
+     */
+    void enterLevel(const Level&level);
+
+    /**
+     * @brief Saves the state of the game to a snapshot file.
+     * @param path The path of the file, replaced once the snapshot is fully written.
+     * @throws std::runtime_error If the file cannot be written.
+     * @see Snapshot
+     */
+    void saveSnapshot(const std::string&path) const;
+
+    /**
+     * @brief Restores the state of the game from a snapshot file, left untouched if the snapshot is invalid.
+     * @param path The path of the file.
+     * @throws std::runtime_error If the file cannot be read.
+     * @throws std::invalid_argument If the snapshot is invalid.
+     * @see Snapshot
+     */
+    void loadSnapshot(const std::string&path);
+
+    /**
+     * @brief Takes the state of the game on the active level, cheaply enough to do it every tick.
+     * @param state Receives the state; reusing the same one avoids allocating.
+     * @see GameState
+     */
+    void saveState(GameState&state) const;
+
+    /**
+     * @brief Rewinds the game to a state it took on the active level, removing the enemies spawned since.
+     * @param state The state.
+     * @return True if the game is rewound, otherwise false if the state was taken on another level or
+     * with other players, the game being left untouched.
+     * @see Snapshot::restore
+     */
+    bool restoreState(const GameState&state);
 };
 #endif //GAME_HPP
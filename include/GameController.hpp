@@ -94,6 +94,409 @@ public:
      */
     int ifCanSpawnCurrentLevelSpawnAt(int, int, int);
 
+    /**
+     * @brief Retrieves the ready spawn points of the current level; those not spawned are retrieved again next call.
+     * @param areaX Output array receiving the x-coordinates of the areas.
+     * @param areaY Output array receiving the y-coordinates of the areas.
+     * @param spawnIds Output array receiving the IDs of the spawn points.
+     * @param capacity The size of the output arrays; remaining events are kept for the next call.
+     * @return The number of events written.
+     */
+    int drainSpawnEvents(int*, int*, int*, int);
+
+    /**
+     * @brief Pops the cooldowns and animations of the characters that expired since the last call.
+     * @param characterIds Output array receiving the IDs of the characters.
+     * @param types Output array receiving the TimerEventType of each event.
+     * @param capabilities Output array receiving the attack or movement index of each event, -1 for the hurt animation.
+     * @param capacity The size of the output arrays; remaining events are kept for the next call.
+     * @return The number of events written.
+     */
+    int drainTimerEvents(int*, int*, int*, int);
+
+    /**
+     * @brief Gets the time left before each capability of a character is available.
+     * @param id The ID of the character.
+     * @param times Output array of getRemainingTimeCount() values: one per attack, one per movement, then the
+     * hurt animation, in seconds; 0 when available, -1 when the character does not have the capability.
+     * @return True if the ID is valid, otherwise false.
+     */
+    bool getCharacterRemainingTimes(int, double*) const;
+
+    /**
+     * @brief Gets the time left before each capability of the player and of every enemy is available.
+     * @param ids Output array receiving the IDs of the characters, the player first.
+     * @param times Output array receiving getRemainingTimeCount() values per character.
+     * @param capacity The number of characters the output arrays can hold.
+     * @return The number of characters written.
+     */
+    int getRemainingTimes(int*, double*, int) const;
+
+    /**
+     * @brief Retrieves the phase of the last attack of every character, all at the same time.
+     * @relatedalso Game::getAttackStates
+     * @param ids Output array receiving the IDs of the player, then of every enemy of the current level.
+     * @param attacks Output array receiving the index of the last attack of each character, -1 if none.
+     * @param phases Output array receiving the AttackPhases of each character.
+     * @param progress Output array receiving the elapsed fraction of the phase of each character.
+     * @param capacity The number of characters the output arrays can hold.
+     * @return The number of characters written.
+     */
+    int getAttackPhases(int*, int*, int*, double*, int) const;
+
+    /**
+     * @brief Starts a scripted behaviour driving an enemy.
+     * @relatedalso Game::startBehaviour
+     * @param id The ID of the enemy.
+     * @param behaviour The behaviour (Behaviours).
+     * @return True if the behaviour started, otherwise false.
+     */
+    bool startBehaviour(int, int);
+
+    /**
+     * @brief Stops the scripted behaviour of an enemy.
+     * @param id The ID of the enemy.
+     * @return True if the enemy was running a behaviour, otherwise false.
+     */
+    bool stopBehaviour(int);
+
+    /**
+     * @brief Checks if an enemy is driven by a scripted behaviour.
+     * @param id The ID of the enemy.
+     * @return True if the enemy runs a behaviour, otherwise false.
+     */
+    bool hasBehaviour(int) const;
+
+    /**
+     * @brief Applies a temporary buff to a stat of a character.
+     * @param id The ID of the character.
+     * @param stat The stat: 0 for the maximum health, 1 for the run force, 2 for the number of jumps, 3 for the
+     * damage of the attacks, 4 for the factor of the damage taken.
+     * @param added The amount added to the base value of the stat.
+     * @param multiplier The factor applied to the stat.
+     * @param duration The duration of the buff, in seconds.
+     * @return True if the buff was applied, otherwise false.
+     */
+    bool addCharacterBuff(int, int, double, double, double);
+
+    /**
+     * @brief Applies a status effect to many characters at once.
+     * @param ids Input array of the IDs of the characters.
+     * @param count The number of IDs.
+     * @param type The effect: 0 for a burn, 1 for a slow, 2 for a strength buff.
+     * @param magnitude The damage dealt every half second by a burn, or the factor applied by a slow or a buff.
+     * @param duration The duration of the effect, in seconds.
+     * @return The number of characters affected.
+     */
+    int applyStatusEffect(const int*, int, int, double, double);
+
+    /**
+     * @brief Gets the time left before a status effect of a character ends.
+     * @param id The ID of the character.
+     * @param type The effect.
+     * @return The time left, in seconds, 0 if the character does not have the effect, -1 if the ID or the type is invalid.
+     */
+    double getCharacterStatusEffectTime(int, int) const;
+
+    /**
+     * @brief Gets every active status effect.
+     * @param ids Output array receiving the ID of the character of each effect.
+     * @param types Output array receiving the type of each effect.
+     * @param times Output array receiving the time left before each effect ends, in seconds.
+     * @param capacity The number of effects the output arrays can hold.
+     * @return The number of effects written.
+     */
+    int getStatusEffects(int*, int*, double*, int) const;
+
+    /**
+     * @brief Spawns an enemy at every ready spawn point of the current level, up to a budget.
+     * @param enemyIds Output array receiving the IDs of the spawned enemies.
+     * @param budget The size of the output array, which is also the maximum number of spawns.
+     * @return The number of spawned enemies.
+     */
+    int spawnReadyEnemies(int*, int);
+
+    /**
+     * @brief Lets the spawn director of the game spend its credits on a wave of enemies.
+     * @param enemyIds Output array receiving the IDs of the spawned enemies.
+     * @param budget The size of the output array, which is also the maximum number of spawns.
+     * @return The number of spawned enemies.
+     */
+    int updateSpawnDirector(int*, int);
+
+    /**
+     * @brief Gets the position of a character by ID.
+     * @param id The ID of the character.
+     * @param x Receives the x-coordinate of the character.
+     * @param y Receives the y-coordinate of the character.
+     * @return True if the ID is valid, otherwise false.
+     */
+    bool getCharacterPosition(int, double*, double*) const;
+
+    /**
+     * @brief Moves a character.
+     * @param id The ID of the character.
+     * @param x The new x-coordinate of the character.
+     * @param y The new y-coordinate of the character.
+     */
+    void setCharacterPosition(int, double, double);
+
+    /**
+     * @brief Gets the velocity of a character by ID.
+     * @param id The ID of the character.
+     * @param vx Receives the horizontal velocity of the character.
+     * @param vy Receives the vertical velocity of the character.
+     * @return True if the ID is valid, otherwise false.
+     */
+    bool getCharacterVelocity(int, double*, double*) const;
+
+    /**
+     * @brief Sets the velocity of a character.
+     * @param id The ID of the character.
+     * @param vx The new horizontal velocity of the character.
+     * @param vy The new vertical velocity of the character.
+     */
+    void setCharacterVelocity(int, double, double);
+
+    /**
+     * @brief Gets the enemies whose follow range contains a character, in one batch.
+     * @param targetId The ID of the followed character.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param capacity The size of the output array.
+     * @return The number of IDs written.
+     */
+    int getEnemiesInFollowRange(int, int*, int) const;
+
+    /**
+     * @brief Gets the enemies whose attack range contains a character, in one batch.
+     * @param targetId The ID of the targeted character.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param capacity The size of the output array.
+     * @return The number of IDs written.
+     */
+    int getEnemiesInAttackRange(int, int*, int) const;
+
+    /**
+     * @brief Gets the IDs and positions of the enemies of the current level, in one batch.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param xs Output array receiving the x-coordinates of the enemies.
+     * @param ys Output array receiving the y-coordinates of the enemies.
+     * @param capacity The size of the output arrays.
+     * @return The number of enemies written.
+     */
+    int getEnemyPositions(int*, double*, double*, int) const;
+
+    /**
+     * @brief Sets the horizontal run input of a character.
+     * @param id The ID of the character.
+     * @param input The run input, between -1 (left) and 1 (right).
+     */
+    void setCharacterRunInput(int, double);
+
+    /**
+     * @brief Decides and applies what every alive and awake enemy does in one pass: attack the player
+     * in attack range, run toward it in follow range, stop otherwise.
+     * @return The number of enemies ordered to attack.
+     */
+    int updateEnemyAI();
+
+    /**
+     * @brief Sets whether stepPhysics runs the AI pass of the enemies.
+     * @param enabled True to drive the enemies from the library.
+     */
+    void setEnemyAI(bool);
+
+    /**
+     * @brief Sets the maximum number of threads deciding the commands of the enemies.
+     * @param workers The number of threads, the calling one included.
+     * @return True if the number was set, false if it is not strictly positive.
+     */
+    bool setEnemyAIWorkers(int);
+
+    /**
+     * @brief Moves the characters of the current level for the elapsed time, in fixed steps.
+     * @param elapsedSeconds The time elapsed since the previous call.
+     * @return The number of fixed steps integrated.
+     */
+    int stepPhysics(double);
+
+    /**
+     * @brief Gets a tile of the current level, packed as described in Tile.
+     * @param x The x-coordinate of the tile.
+     * @param y The y-coordinate of the tile.
+     * @return The packed tile.
+     */
+    int getTileAt(int, int) const;
+
+    /**
+     * @brief Checks if a box overlaps a solid tile of the current level.
+     * @param minX The left side of the box.
+     * @param minY The bottom side of the box.
+     * @param maxX The right side of the box.
+     * @param maxY The top side of the box.
+     * @return True if a solid tile overlaps the box, otherwise false.
+     */
+    bool boxOverlapsSolid(double, double, double, double) const;
+
+    /**
+     * @brief Casts a segment through the tiles of the current level.
+     * @param fromX The x-coordinate of the start of the segment.
+     * @param fromY The y-coordinate of the start of the segment.
+     * @param toX The x-coordinate of the end of the segment.
+     * @param toY The y-coordinate of the end of the segment.
+     * @param hitX Receives the x-coordinate where the segment stops.
+     * @param hitY Receives the y-coordinate where the segment stops.
+     * @return True if a solid tile blocks the segment, otherwise false.
+     */
+    bool raycast(double, double, double, double, double*, double*) const;
+
+    /**
+     * @brief Casts a batch of segments through the tiles of the current level.
+     * @param segments Input array of 4 coordinates per segment: fromX, fromY, toX, toY.
+     * @param blocked Output array receiving 1 for each blocked segment and 0 for each clear one.
+     * @param count The number of segments.
+     */
+    void raycastBatch(const double*, int*, int) const;
+
+    /**
+     * @brief Checks if a character can hit another one, in range and in line of sight.
+     * @param id The ID of the attacking character.
+     * @param targetId The ID of the targeted character.
+     * @return True if the target can be hit, otherwise false.
+     */
+    bool canCharacterReach(int, int) const;
+
+    /**
+     * @brief Gets the enemies in attack range and in line of sight of a character, in one batch.
+     * @param targetId The ID of the targeted character.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param capacity The size of the output array.
+     * @return The number of IDs written.
+     */
+    int getEnemiesInReach(int, int*, int) const;
+
+    /**
+     * @brief Gets the enemies in reach of a character with an attack ready at the last physics step, in one batch.
+     * @param targetId The ID of the targeted character.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param capacity The size of the output array.
+     * @return The number of IDs written.
+     */
+    int getEnemiesReadyToAttack(int, int*, int) const;
+
+    /**
+     * @brief Gets the readiness bitmask of every enemy of the current level, as of the last physics step.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param masks Output array receiving the bitmasks: bit i is set when the capability at index i of
+     * getCharacterRemainingTimes is available.
+     * @param capacity The size of the output arrays.
+     * @return The number of enemies written.
+     */
+    int getEnemyReadiness(int*, int*, int) const;
+
+    /**
+     * @brief Gets the player an enemy targets: the living one with the most threat on it, or else the nearest.
+     * @param enemyId The ID of the enemy.
+     * @return The ID of the player, or -1 if the ID is not an enemy or every player is dead.
+     */
+    [[nodiscard]] int getEnemyTarget(int) const;
+
+    /**
+     * @brief Gets the player each enemy of the current level targets, in one batch.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param playerIds Output array receiving the ID of the player each enemy targets, -1 if every player is dead.
+     * @param capacity The size of the output arrays.
+     * @return The number of enemies written.
+     */
+    int getEnemyTargets(int*, int*, int) const;
+
+    /**
+     * @brief Makes an enemy target a player until the player loses its threat.
+     * @param playerId The ID of the taunting player.
+     * @param enemyId The ID of the taunted enemy.
+     * @return True if the enemy is taunted, false if an ID is invalid.
+     */
+    bool taunt(int, int);
+
+    /**
+     * @brief Gets the threat of a player on an enemy.
+     * @param enemyId The ID of the enemy.
+     * @param playerId The ID of the player.
+     * @return The threat, 0 if there is none or an ID is invalid.
+     */
+    [[nodiscard]] double getThreat(int, int) const;
+
+    /**
+     * @brief Gets the number of gateways a character must cross to reach the area of another one.
+     * @param id The ID of the moving character.
+     * @param targetId The ID of the targeted character.
+     * @return The distance, or -1 if the target cannot be reached.
+     */
+    int getAreaDistance(int, int);
+
+    /**
+     * @brief Gets the gateway a character should take to get closer to the area of another one.
+     * @param id The ID of the moving character.
+     * @param targetId The ID of the targeted character.
+     * @param directionX Output receiving the x component of the gateway direction.
+     * @param directionY Output receiving the y component of the gateway direction.
+     * @return True if there is a gateway to take, otherwise false.
+     */
+    bool getNextGateway(int, int, int*, int*);
+
+    /**
+     * @brief Gets the gateway every alive enemy should take toward the area of a character, in one batch.
+     * @param targetId The ID of the targeted character.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param directionsX Output array receiving the x component of each gateway direction.
+     * @param directionsY Output array receiving the y component of each gateway direction.
+     * @param capacity The size of the output arrays.
+     * @return The number of enemies written.
+     */
+    int getEnemyNextGateways(int, int*, int*, int*, int);
+
+    /**
+     * @brief Gets the chase direction of every alive enemy within follow range of a character, in one batch.
+     * @param targetId The ID of the chased character.
+     * @param enemyIds Output array receiving the IDs of the enemies.
+     * @param directionsX Output array receiving the x component of each unit direction.
+     * @param directionsY Output array receiving the y component of each unit direction.
+     * @param capacity The size of the output arrays.
+     * @return The number of enemies written.
+     */
+    int getChaseDirections(int, int*, double*, double*, int);
+
+    /**
+     * @brief Plans the moves a character needs to reach the ledge of another one.
+     * @param id The ID of the moving character.
+     * @param targetId The ID of the targeted character.
+     * @param movements Output array receiving the movement index of each move.
+     * @param points Output array receiving 4 coordinates per move: takeoffX, takeoffY, landingX, landingY.
+     * @param capacity The number of moves the output arrays can hold.
+     * @return The number of moves written, 0 if there is no route.
+     */
+    int planRoute(int, int, int*, double*, int);
+
+    /**
+     * @brief Sets the number of gateways around the player within which enemies are simulated.
+     * @param radius The radius, or -1 to simulate every enemy.
+     * @return True if the radius was set, false if it is invalid.
+     */
+    bool setActivationRadius(int);
+
+    /**
+     * @brief Checks if a character is simulated rather than dormant.
+     * @param id The ID of the character.
+     * @return True if the character is awake, otherwise false.
+     */
+    [[nodiscard]] bool isCharacterAwake(int) const;
+
+    /**
+     * @brief Gets the number of awake enemies of the current level.
+     * @return The number of enemies.
+     */
+    int getAwakeEnemyCount();
+
     /**
      * @brief Gets the type of a character by ID.
      * @param id The unique ID of the character.
@@ -253,6 +656,36 @@ public:
      */
     [[nodiscard]] int getPlayerId() const;
 
+    /**
+     * @brief Adds a player to the session, at the position of the host.
+     * @param primaryAttack The enum index of primary attack for the player.
+     * @param secondaryAttack The enum index of the secondary attack for the player.
+     * @param tertiaryAttack The enum index of the tertiary attack for the player.
+     * @return The ID of the player, or -1 if the session is full or an attack is invalid.
+     */
+    int addPlayer(int, int, int);
+
+    /**
+     * @brief Removes a player from the session. The host cannot be removed.
+     * @param id The ID of the player.
+     * @return True if the player was removed, otherwise false.
+     */
+    bool removePlayer(int);
+
+    /**
+     * @brief Gets the IDs of the players, the host first, in one batch.
+     * @param ids Output array receiving the IDs of the players.
+     * @param capacity The size of the output array.
+     * @return The number of IDs written.
+     */
+    int getPlayerIds(int*, int) const;
+
+    /**
+     * @brief Gets the number of players.
+     * @return The number of players, dead ones included.
+     */
+    [[nodiscard]] int getPlayerCount() const;
+
     /**
      * @brief Attacks a target character with a specific attack.
      * @param id The unique ID of the attacking character.
@@ -261,6 +694,60 @@ public:
      */
     void attack(int, int, int);
 
+    /**
+     * @brief Uses an area attack, hitting every opponent within its area in a single call.
+     * @param id The unique ID of the attacking character.
+     * @param attackIndex The index of the attack, which must be an area attack.
+     * @param ids Output array receiving the IDs of the characters hit.
+     * @param damages Output array receiving the damage dealt to each character hit.
+     * @param capacity The number of hits the output arrays can hold.
+     * @return The number of hits written.
+     */
+    int attackArea(int, int, int*, int*, int);
+
+    /**
+     * @brief Chooses whether the hits are resolved after each attack or once per physics step.
+     * @param deferred True to resolve the hits once per physics step.
+     */
+    void setDeferredDamage(bool);
+
+    /**
+     * @brief Resolves the pending hits now.
+     */
+    void resolveDamage();
+
+    /**
+     * @brief Pops the characters killed by a hit since the last call.
+     * @param victims Output array receiving the IDs of the characters killed.
+     * @param killers Output array receiving the IDs of the characters credited with each kill.
+     * @param capacity The number of events the output arrays can hold.
+     * @return The number of events written.
+     */
+    int drainDeathEvents(int*, int*, int);
+
+    /**
+     * @brief Uses a ranged attack, firing a projectile.
+     * @relatedalso Game::shoot
+     * @param id The ID of the attacking character.
+     * @param attackIndex The index of the attack.
+     * @param directionX The horizontal component of the direction of the shot.
+     * @param directionY The vertical component of the direction of the shot.
+     * @return The ID of the projectile, -1 if the attack cannot be used yet or too many projectiles are in flight.
+     */
+    int shoot(int, int, double, double);
+
+    /**
+     * @brief Retrieves the projectiles in flight, for rendering.
+     * @param ids Output array receiving the ID of each projectile.
+     * @param xs Output array receiving the horizontal position of each projectile.
+     * @param ys Output array receiving the vertical position of each projectile.
+     * @param velocitiesX Output array receiving the horizontal velocity of each projectile.
+     * @param velocitiesY Output array receiving the vertical velocity of each projectile.
+     * @param capacity The number of projectiles the output arrays can hold.
+     * @return The number of projectiles written.
+     */
+    int getProjectiles(int*, double*, double*, double*, double*, int) const;
+
     /**
      * @brief Moves a character with a specific movement.
      * @param id The unique ID of the character.
@@ -343,6 +830,16 @@ public:
      */
     int openChest(int, int, int);
 
+    /**
+     * @brief Opens a chest in a specific area for a player.
+     * @param playerId The ID of the player receiving the item.
+     * @param areaX The x-coordinate of the area.
+     * @param areaY The y-coordinate of the area.
+     * @param chestId The ID of the chest.
+     * @return The id of the item in the chest, or -1 if the player ID is invalid.
+     */
+    int openChestForPlayer(int, int, int, int);
+
     /**
      * @brief Checks if a chest in a specific area has been opened.
      * @param areaX The x-coordinate of the area.
@@ -392,6 +889,39 @@ public:
     void nextLevel(int);
 
     void useHealthPotionIfAvailable();
+
+    /**
+     * @brief Uses a health potion of a player, if it has one and is hurt.
+     * @param playerId The ID of the player.
+     */
+    void useHealthPotionForPlayer(int);
+
+    /**
+     * @brief Saves the state of the game to a snapshot file, for instance every few seconds to recover from a crash.
+     * @param path The path of the file.
+     * @return True if the snapshot is written, otherwise false.
+     */
+    bool saveSnapshot(const char*) const;
+
+    /**
+     * @brief Restores the state of the game from a snapshot file.
+     * @param path The path of the file.
+     * @return True if the game is restored, otherwise false, the game being left untouched.
+     */
+    bool loadSnapshot(const char*);
+
+    /**
+     * @brief Takes the state of the game, for instance every tick of a rollback session.
+     * @param state Receives the state.
+     */
+    void saveState(GameState*) const;
+
+    /**
+     * @brief Rewinds the game to a state it took on the active level.
+     * @param state The state.
+     * @return True if the game is rewound, otherwise false, the game being left untouched.
+     */
+    bool restoreState(const GameState*);
 };
 
 MY_API GameController* newGame(int primaryAttack, int secondaryAttack, int tertiaryAttack);
@@ -408,6 +938,100 @@ MY_API int getAreaGuidCurrentLevel(const GameController*, int, int);
 
 MY_API int ifCanSpawnCurrentLevelSpawnAt(GameController*, int, int, int);
 
+MY_API int drainSpawnEvents(GameController*, int*, int*, int*, int);
+
+MY_API int drainTimerEvents(GameController*, int*, int*, int*, int);
+
+MY_API int getRemainingTimeCount();
+
+MY_API bool getCharacterRemainingTimes(const GameController*, int, double*);
+
+MY_API int getRemainingTimes(const GameController*, int*, double*, int);
+
+MY_API int getAttackPhases(const GameController*, int*, int*, int*, double*, int);
+
+MY_API bool startBehaviour(GameController*, int, int);
+
+MY_API bool stopBehaviour(GameController*, int);
+
+MY_API bool hasBehaviour(const GameController*, int);
+
+MY_API bool addCharacterBuff(GameController*, int, int, double, double, double);
+
+MY_API int applyStatusEffect(GameController*, const int*, int, int, double, double);
+
+MY_API double getCharacterStatusEffectTime(const GameController*, int, int);
+
+MY_API int getStatusEffects(const GameController*, int*, int*, double*, int);
+
+MY_API int spawnReadyEnemies(GameController*, int*, int);
+
+MY_API int updateSpawnDirector(GameController*, int*, int);
+
+MY_API bool getCharacterPosition(const GameController*, int, double*, double*);
+
+MY_API void setCharacterPosition(GameController*, int, double, double);
+
+MY_API bool getCharacterVelocity(const GameController*, int, double*, double*);
+
+MY_API void setCharacterVelocity(GameController*, int, double, double);
+
+MY_API int getEnemiesInFollowRange(const GameController*, int, int*, int);
+
+MY_API int getEnemiesInAttackRange(const GameController*, int, int*, int);
+
+MY_API int getEnemyPositions(const GameController*, int*, double*, double*, int);
+
+MY_API void setCharacterRunInput(GameController*, int, double);
+
+MY_API int updateEnemyAI(GameController*);
+
+MY_API void setEnemyAI(GameController*, bool);
+
+MY_API bool setEnemyAIWorkers(GameController*, int);
+
+MY_API int stepPhysics(GameController*, double);
+
+MY_API int getTileAt(const GameController*, int, int);
+
+MY_API bool boxOverlapsSolid(const GameController*, double, double, double, double);
+
+MY_API bool raycast(const GameController*, double, double, double, double, double*, double*);
+
+MY_API void raycastBatch(const GameController*, const double*, int*, int);
+
+MY_API bool canCharacterReach(const GameController*, int, int);
+
+MY_API int getEnemiesInReach(const GameController*, int, int*, int);
+
+MY_API int getEnemiesReadyToAttack(const GameController*, int, int*, int);
+
+MY_API int getEnemyReadiness(const GameController*, int*, int*, int);
+
+MY_API int getEnemyTarget(const GameController*, int);
+
+MY_API int getEnemyTargets(const GameController*, int*, int*, int);
+
+MY_API bool taunt(GameController*, int, int);
+
+MY_API double getThreat(const GameController*, int, int);
+
+MY_API int getAreaDistance(GameController*, int, int);
+
+MY_API bool getNextGateway(GameController*, int, int, int*, int*);
+
+MY_API int getEnemyNextGateways(GameController*, int, int*, int*, int*, int);
+
+MY_API int getChaseDirections(GameController*, int, int*, double*, double*, int);
+
+MY_API int planRoute(GameController*, int, int, int*, double*, int);
+
+MY_API bool setActivationRadius(GameController*, int);
+
+MY_API bool isCharacterAwake(const GameController*, int);
+
+MY_API int getAwakeEnemyCount(GameController*);
+
 MY_API int getCharacterType(const GameController*, int);
 
 MY_API double getCharacterSpeed(const GameController*, int);
@@ -452,8 +1076,28 @@ MY_API bool isAValidId(const GameController*, int);
 
 MY_API int getPlayerId(const GameController*);
 
+MY_API int addPlayer(GameController*, int, int, int);
+
+MY_API bool removePlayer(GameController*, int);
+
+MY_API int getPlayerIds(const GameController*, int*, int);
+
+MY_API int getPlayerCount(const GameController*);
+
 MY_API void attack(GameController*, int, int, int);
 
+MY_API int attackArea(GameController*, int, int, int*, int*, int);
+
+MY_API void setDeferredDamage(GameController*, bool);
+
+MY_API void resolveDamage(GameController*);
+
+MY_API int shoot(GameController*, int, int, double, double);
+
+MY_API int getProjectiles(const GameController*, int*, double*, double*, double*, double*, int);
+
+MY_API int drainDeathEvents(GameController*, int*, int*, int);
+
 MY_API void move(GameController*, int, int);
 
 MY_API bool isCharacterBusy(GameController*, int);
@@ -478,6 +1122,8 @@ MY_API bool isChestEmpty(const GameController*, int, int, int);
 
 MY_API int openChest(GameController*, int, int, int);
 
+MY_API int openChestForPlayer(GameController*, int, int, int, int);
+
 MY_API int getNumberOfItem(GameController*, int, int);
 
 MY_API int getPrimaryPlayerAttack(const GameController*);
@@ -492,4 +1138,18 @@ MY_API void nextLevel(GameController*, int);
 
 MY_API void useHealthPotionIfAvailable(GameController*);
 
+MY_API void useHealthPotionForPlayer(GameController*, int);
+
+MY_API bool saveSnapshot(const GameController*, const char*);
+
+MY_API bool loadSnapshot(GameController*, const char*);
+
+MY_API GameState* newGameState();
+
+MY_API void destroyGameState(const GameState*);
+
+MY_API void saveGameState(const GameController*, GameState*);
+
+MY_API bool restoreGameState(GameController*, const GameState*);
+
 #endif
@@ -0,0 +1,138 @@
+/**
+ * @file GameState.hpp
+ * @brief Defines GameState, an in-memory copy of the state of a Game cheap enough to take and restore every tick.
+ *
+ * Rollback netcode and look-ahead searches rewind a game many times per second, which rules out
+ * copying its Level and Characters, deep graphs of maps, strings and shared movements. A GameState
+ * only keeps what changes while a level is played, in flat arrays of trivially copyable frames:
+ * the characters point into the arrays of attacks, movements, modifiers and items by index, in the
+ * order their capabilities iterate them. What never changes within a level (the areas, the names
+ * and the tuning of the capabilities) is not copied: a state only restores the game that took it,
+ * on the same level.
+ *
+ * The pending timer events are not copied either: they follow from the times of the capabilities
+ * and hurt animations, and are scheduled again on restore from those expiring after the time the
+ * wheel was drained up to. The state of the scripts cannot be copied, only which script each enemy
+ * runs.
+ *
+ * The times are kept as they are, since a state never leaves the process. Taking a state into the
+ * same GameState again reuses the capacity of its arrays, so that it allocates nothing once warm.
+ * @see Snapshot::capture
+ * @see Snapshot::restore
+ */
+#ifndef GAMESTATE_HPP
+#define GAMESTATE_HPP
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "DamageBuffer.hpp"
+#include "Health.hpp"
+#include "KinematicIntegrator.hpp"
+#include "ModifierStack.hpp"
+#include "ProjectilePool.hpp"
+#include "SpawnDirector.hpp"
+#include "StatusEffectPool.hpp"
+#include "ThreatTable.hpp"
+#include "TimerWheel.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @struct AttackFrame
+ * @brief The changing state of an attack.
+ */
+struct AttackFrame {
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    TimePoint lastUsage; ///< The last time the attack was used.
+    TimePoint charged; ///< The time the charge of the last usage ends.
+    TimePoint recovery; ///< The time the active part of the last usage ends.
+    TimePoint end; ///< The time the animation of the last usage ends.
+    TimePoint ready; ///< The time the cooldown of the last usage elapses.
+    int damage; ///< The damage of the attack, after the modifiers.
+};
+
+/**
+ * @struct MovementFrame
+ * @brief The changing state of a movement.
+ */
+struct MovementFrame {
+    std::chrono::time_point<std::chrono::steady_clock> lastUsage; ///< The last time the movement was used.
+    double force; ///< The force of the movement, after the modifiers.
+    int maxUsage; ///< The number of consecutive jumps of a JUMP, after the modifiers, otherwise 0.
+    int state; ///< The jumps done by a JUMP, whether a RUN runs or a CLIMB climbs, otherwise 0.
+};
+
+/**
+ * @struct ItemFrame
+ * @brief An item held by a character.
+ */
+struct ItemFrame {
+    int item; ///< The item (Items).
+    int count; ///< The number held.
+};
+
+/**
+ * @struct CharacterFrame
+ * @brief The changing state of a character, with the ranges of its capabilities, modifiers and items.
+ */
+struct CharacterFrame {
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    Vector2D position; ///< The position.
+    Vector2D velocity; ///< The velocity.
+    double runInput; ///< The horizontal run input.
+    TimePoint hurtStart; ///< The time the hurt animation last started.
+    TimePoint jetPackStart; ///< The last time the jetpack was activated.
+    Health health; ///< The health, its maximum after the modifiers.
+    int id; ///< The ID of the character.
+    int facing; ///< The horizontal direction faced.
+    int script; ///< The script run by an enemy (Behaviours), -1 if it runs none and for a player.
+    std::uint32_t firstAttack; ///< Index of the first attack in GameState::attacks.
+    std::uint32_t firstMovement; ///< Index of the first movement in GameState::movements.
+    std::uint32_t firstModifier; ///< Index of the first modifier in GameState::modifiers.
+    std::uint32_t firstItem; ///< Index of the first item in GameState::items.
+    std::uint16_t attackCount; ///< Number of attacks.
+    std::uint16_t movementCount; ///< Number of movements.
+    std::uint16_t modifierCount; ///< Number of modifiers.
+    std::uint16_t itemCount; ///< Number of items.
+    bool onGround; ///< Whether the character stands on the ground.
+    bool jetPackInUse; ///< Whether the jetpack is in use.
+};
+
+static_assert(std::is_trivially_copyable_v<AttackFrame>, "An AttackFrame must be copied as bytes");
+static_assert(std::is_trivially_copyable_v<MovementFrame>, "A MovementFrame must be copied as bytes");
+static_assert(std::is_trivially_copyable_v<CharacterFrame>, "A CharacterFrame must be copied as bytes");
+static_assert(std::is_trivially_copyable_v<Modifier>, "A Modifier must be copied as bytes");
+
+/**
+ * @struct GameState
+ * @brief The state of a game on its active level, taken by Game::saveState and restored by Game::restoreState.
+ */
+struct GameState {
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    int level = -1; ///< The ID of the active level, -1 if no state was taken.
+    std::size_t playerCount = 0; ///< Number of players, whose frames come first.
+    bool over = false; ///< Whether the game is over.
+    double difficulty = 1.0; ///< The difficulty coefficient.
+    TimePoint difficultyUpdate; ///< The time of the last difficulty update.
+    TimePoint lastEnemyAIUpdate; ///< The time of the last AI pass.
+    TimePoint timersDrained; ///< The time up to which the timer events were drained.
+    std::vector<CharacterFrame> characters; ///< The players, then the enemies in slot order.
+    std::vector<AttackFrame> attacks; ///< The attacks of the characters.
+    std::vector<MovementFrame> movements; ///< The movements of the characters.
+    std::vector<Modifier> modifiers; ///< The modifiers of the characters.
+    std::vector<ItemFrame> items; ///< The items of the characters.
+    std::vector<TimePoint> spawnTimes; ///< The last spawn of each spawn point, area by area.
+    std::vector<std::uint8_t> emptyChests; ///< 1 for each emptied chest, area by area.
+    StatusEffectPool statusEffects; ///< The status effects of the characters.
+    ThreatTable threat; ///< The threat of the players on the enemies.
+    DamageBuffer damageBuffer; ///< The hits waiting to be resolved.
+    std::vector<TimerEvent> dueTimers; ///< The timer events that fell due, not drained yet.
+    std::vector<DeathEvent> deaths; ///< The deaths not drained yet.
+    ProjectilePool projectiles; ///< The projectiles in flight.
+    SpawnDirector spawnDirector; ///< The spawn credits and their last update.
+    KinematicIntegrator integrator; ///< The time not yet consumed by a physics step.
+};
+#endif //GAMESTATE_HPP
@@ -0,0 +1,47 @@
+/**
+ * @file GridCell.hpp
+ * @brief Defines the conversion of world coordinates to the integer coordinates of grid cells.
+ *
+ * Casting a double to int is undefined for NaN and for values beyond the range of int, and the
+ * positions of the characters can be any double. Every grid of the game (tiles, areas, spatial
+ * cells) converts its coordinates through these functions instead, which clamp them first: a
+ * coordinate beyond MAX_CELL lands in the outermost cell, far outside any level, and NaN in the
+ * lowest one.
+ */
+#ifndef GRIDCELL_HPP
+#define GRIDCELL_HPP
+#include <algorithm>
+#include <cmath>
+
+constexpr int MAX_CELL = 1 << 30; ///< Largest cell coordinate, in absolute value; leaves room for offsets.
+
+/**
+ * @brief Converts an integral value to a cell coordinate, clamping it to the range of the cells.
+ * @param value The value, already rounded.
+ * @return The cell coordinate, between -MAX_CELL and MAX_CELL; -MAX_CELL for NaN.
+ */
+[[nodiscard]] inline int clampToCell(const double value) {
+    if (std::isnan(value)) {
+        return -MAX_CELL;
+    }
+    return static_cast<int>(std::clamp(value, static_cast<double>(-MAX_CELL), static_cast<double>(MAX_CELL)));
+}
+
+/**
+ * @brief Computes the cell holding a coordinate, in cells of unit size.
+ * @param coordinate The coordinate, divided by the cell size.
+ * @return The cell coordinate, rounded down and clamped by clampToCell.
+ */
+[[nodiscard]] inline int floorToCell(const double coordinate) {
+    return clampToCell(std::floor(coordinate));
+}
+
+/**
+ * @brief Computes the first cell boundary at or above a coordinate, in cells of unit size.
+ * @param coordinate The coordinate, divided by the cell size.
+ * @return The cell coordinate, rounded up and clamped by clampToCell.
+ */
+[[nodiscard]] inline int ceilToCell(const double coordinate) {
+    return clampToCell(std::ceil(coordinate));
+}
+#endif //GRIDCELL_HPP
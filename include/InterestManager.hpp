@@ -0,0 +1,134 @@
+/**
+ * @file InterestManager.hpp
+ * @brief Defines the InterestManager class, which decides the enemies of a level worth simulating.
+ *
+ * The enemies are bucketed by area. Around the area of each player, the areas within an
+ * activation radius, counted in gateways, are active: their enemies are awake and simulated,
+ * while the other enemies are dormant and cost nothing per tick. The active areas only change
+ * when a player changes area, so that the per-tick cost follows the number of nearby enemies
+ * rather than the number of spawned ones.
+ *
+ * The manager works on the storage slots of the enemies, that is their index in the level.
+ */
+#ifndef INTERESTMANAGER_HPP
+#define INTERESTMANAGER_HPP
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include "NavigationGraph.hpp"
+
+/**
+ * @class InterestManager
+ * @brief Area-based activation of the enemies of a level.
+ */
+class InterestManager {
+    int radius = UNLIMITED; ///< Activation radius, in gateways.
+    bool focused = false; ///< True once the active areas match the radius and the foci.
+    std::vector<std::int64_t> foci; ///< Sorted indices of the areas of the players, OUTSIDE for those outside of the grid.
+    std::vector<std::int64_t> nextFoci; ///< The foci being set, reused between calls.
+    std::vector<std::size_t> reached; ///< The areas around one focus, reused between calls.
+    std::vector<std::uint8_t> activeAreas; ///< 1 for each active area.
+    std::vector<std::size_t> activeAreaList; ///< Indices of the active areas.
+    std::vector<std::vector<std::size_t>> areaEnemies; ///< Slots of the enemies of each area.
+    std::vector<std::int64_t> enemyAreas; ///< Area of each enemy, OUTSIDE if outside of the grid.
+    std::vector<std::uint8_t> awake; ///< 1 for each awake enemy.
+    std::vector<std::size_t> summoned; ///< Enemies woken up on demand outside of the active areas.
+    std::vector<std::size_t> awakeEnemies; ///< Slots of the awake enemies, in slot order.
+    bool dirty = true; ///< True when awakeEnemies must be rebuilt.
+
+    static constexpr std::int64_t OUTSIDE = -1; ///< Area of the enemies outside of the grid.
+
+    /**
+     * @brief Wakes up or puts to sleep an enemy.
+     * @param slot The slot of the enemy.
+     * @param state 1 to wake it up, 0 to put it to sleep.
+     * @return True if the enemy woke up, otherwise false.
+     */
+    bool setAwake(std::size_t slot, std::uint8_t state);
+
+public:
+    static constexpr int UNLIMITED = -1; ///< Radius for which every enemy is always awake.
+
+    /**
+     * @brief Constructs a manager for a grid of areas, keeping every enemy awake.
+     * @param areaCount The number of areas of the grid.
+     */
+    explicit InterestManager(std::size_t areaCount = 0);
+
+    /**
+     * @brief Sets the activation radius. The active areas are recomputed by the next focus.
+     * @param activationRadius The radius, in gateways, or UNLIMITED to keep every enemy awake.
+     * @throws std::invalid_argument If the radius is negative and not UNLIMITED.
+     */
+    void setRadius(int activationRadius);
+
+    /**
+     * @brief Retrieves the activation radius.
+     * @return The radius, in gateways, or UNLIMITED.
+     */
+    [[nodiscard]] int getRadius() const;
+
+    /**
+     * @brief Centers the active areas on the area of the player.
+     *
+     * Nothing happens unless the player changed area or the radius changed; otherwise only the
+     * enemies of the previous and new active areas are visited.
+     * @param navigation The navigation graph of the level.
+     * @param areaX The x-coordinate of the area of the player.
+     * @param areaY The y-coordinate of the area of the player.
+     * @param woken Receives the slots of the enemies that woke up.
+     */
+    void focusOn(NavigationGraph&navigation, int areaX, int areaY, std::vector<std::size_t>&woken);
+
+    /**
+     * @brief Centers the active areas on the areas of several players: an area is active if it is
+     * within the radius of any of them.
+     *
+     * Nothing happens unless a player changed area or the radius changed.
+     * @param navigation The navigation graph of the level.
+     * @param areas The coordinates of the area of each player.
+     * @param woken Receives the slots of the enemies that woke up.
+     */
+    void focusOn(NavigationGraph&navigation, std::span<const std::pair<int, int>> areas,
+                 std::vector<std::size_t>&woken);
+
+    /**
+     * @brief Registers the area of an enemy, either a new one or one that moved.
+     *
+     * An enemy entering an active area wakes up; an awake enemy leaving the active areas falls asleep.
+     * @param slot The slot of the enemy, at most the number of enemies registered.
+     * @param area The index of its area, or a negative value if it is outside of the grid.
+     * @return True if the enemy woke up, otherwise false.
+     */
+    bool place(std::size_t slot, std::int64_t area);
+
+    /**
+     * @brief Wakes up an enemy on demand, until the active areas are next recomputed.
+     * @param slot The slot of the enemy.
+     * @return True if the enemy was dormant, otherwise false.
+     * @throws std::out_of_range If the slot is not registered.
+     */
+    bool wake(std::size_t slot);
+
+    /**
+     * @brief Unregisters the last enemies, keeping the first ones.
+     * @param count The number of enemies kept.
+     */
+    void truncate(std::size_t count);
+
+    /**
+     * @brief Checks if an enemy is awake.
+     * @param slot The slot of the enemy.
+     * @return True if the enemy is awake, otherwise false.
+     * @throws std::out_of_range If the slot is not registered.
+     */
+    [[nodiscard]] bool isAwake(std::size_t slot) const;
+
+    /**
+     * @brief Retrieves the awake enemies.
+     * @return The slots of the awake enemies, in slot order.
+     */
+    const std::vector<std::size_t>& getAwakeEnemies();
+};
+#endif //INTERESTMANAGER_HPP
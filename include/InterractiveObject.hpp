@@ -1,10 +1,70 @@
 //
 // Created by Enzo Renard on 28/11/2024.
 //
-
+/**
+ * @file InterractiveObject.hpp
+ * @brief Defines the InterractiveObject class, an object of an area placed on a tile.
+ */
 #ifndef INTERRACTIVEOBJECT_HPP
 #define INTERRACTIVEOBJECT_HPP
+
+/**
+ * @enum InterractiveObjectKind
+ * @brief Enumerates the kinds of objects a tile can hold.
+ */
+enum class InterractiveObjectKind {
+    NONE, ///< No object.
+    CHEST, ///< A chest of the area, identified by its chest ID.
+    SPAWN ///< A spawn point of the area, identified by its spawn ID.
+};
+
+/**
+ * @class InterractiveObject
+ * @brief An object of an area, identified by its kind and its ID within the area, and placed on a tile.
+ */
 class InterractiveObject {
-    
+    InterractiveObjectKind kind = InterractiveObjectKind::NONE; ///< The kind of the object.
+    int id = -1; ///< The ID of the chest or of the spawn point within its area.
+    int tileX = 0; ///< The x-coordinate of the tile holding the object, in level tiles.
+    int tileY = 0; ///< The y-coordinate of the tile holding the object, in level tiles.
+
+public:
+    /**
+     * @brief Constructs an empty object.
+     */
+    InterractiveObject() = default;
+
+    /**
+     * @brief Constructs an object placed on a tile.
+     * @param kind The kind of the object.
+     * @param id The ID of the chest or of the spawn point within its area.
+     * @param tileX The x-coordinate of the tile holding the object.
+     * @param tileY The y-coordinate of the tile holding the object.
+     */
+    InterractiveObject(InterractiveObjectKind kind, int id, int tileX, int tileY);
+
+    /**
+     * @brief Retrieves the kind of the object.
+     * @return The kind.
+     */
+    [[nodiscard]] InterractiveObjectKind getKind() const;
+
+    /**
+     * @brief Retrieves the ID of the chest or of the spawn point within its area.
+     * @return The ID.
+     */
+    [[nodiscard]] int getId() const;
+
+    /**
+     * @brief Retrieves the x-coordinate of the tile holding the object.
+     * @return The tile x-coordinate.
+     */
+    [[nodiscard]] int getTileX() const;
+
+    /**
+     * @brief Retrieves the y-coordinate of the tile holding the object.
+     * @return The tile y-coordinate.
+     */
+    [[nodiscard]] int getTileY() const;
 };
 #endif //INTERRACTIVEOBJECT_HPP
@@ -17,6 +17,8 @@
  * @brief Represents a jetpack, allowing a character to fly for a limited time with specified constraints.
  */
 class JetPack {
+    friend class Snapshot;
+
     double force; ///< The force generated by the jetpack during activation.
     double maxTime; ///< The maximum duration the jetpack can be used continuously.
     double cooldown; ///< The cooldown time required before the jetpack can be used again.
@@ -53,9 +55,10 @@ public:
 
     /**
      * @brief Checks if the jetpack is currently in use.
+     * @param now The current time.
      * @return True if the jetpack is being used, otherwise false.
      */
-    [[nodiscard]] bool isUsing() const;
+    [[nodiscard]] bool isUsing(std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now()) const;
 
     /**
      * @brief Retrieves the force generated by the jetpack.
@@ -85,5 +88,18 @@ public:
      * @return The cooldown time as a double.
      */
     double getCoolDown() const;
+
+    /**
+     * @brief Retrieves the time at which the flight, landing and cooldown of the last activation elapse.
+     * @return The ready time, meaningless if the jetpack was never activated.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getReadyTime() const;
+
+    /**
+     * @brief Computes the time left before the jetpack can be activated again.
+     * @param now The current time.
+     * @return The remaining time in seconds, 0 if the jetpack is ready.
+     */
+    [[nodiscard]] double getRemainingTime(std::chrono::time_point<std::chrono::steady_clock> now) const;
 };
 #endif //JETPACK_HPP
@@ -22,6 +22,8 @@
  * allowed before requiring the character to touch the ground to reset the jump counter.
  */
 class Jump : public Movement {
+    friend class Snapshot;
+
     int maxUsage; ///< Maximum number of consecutive jumps allowed.
     int currentUsage; ///< Current number of jumps performed since the last reset.
 
@@ -50,6 +52,30 @@ public:
      */
     void reset();
 
-    void increaseForce(double amount) override;
+    /**
+     * @brief Retrieves the maximum number of consecutive jumps.
+     * @return The maximum number of jumps before touching the ground.
+     */
+    [[nodiscard]] int getMaxUsage() const;
+
+    /**
+     * @brief Computes the time left before the character can jump again.
+     * @param now The current time.
+     * @return 0 if a jump is left, otherwise infinity: the jumps are only given back on landing.
+     */
+    [[nodiscard]] double getRemainingTime(std::chrono::time_point<std::chrono::steady_clock> now) const override;
+
+    /**
+     * @brief Sets the maximum number of consecutive jumps.
+     * @param amount The new maximum.
+     * @throws std::invalid_argument If the amount is negative.
+     */
+    void setMaxUsage(int amount);
+
+    /**
+     * @brief Copies the jump, its count of consecutive jumps included with its state.
+     * @return The copy, owned by nobody else.
+     */
+    [[nodiscard]] std::shared_ptr<Movement> clone() const override;
 };
 #endif //JUMP_HPP
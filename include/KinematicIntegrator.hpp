@@ -0,0 +1,166 @@
+/**
+ * @file KinematicIntegrator.hpp
+ * @brief Defines the KinematicBodies and KinematicIntegrator classes, moving characters at a fixed timestep.
+ *
+ * The movement forces of the characters are gathered into a structure of arrays, integrated with
+ * a semi-implicit Euler scheme at a fixed timestep, then written back to the characters. The
+ * integration loop only reads and writes contiguous arrays of doubles so it can be vectorized,
+ * and it does not depend on the wall clock so the same simulation runs headless: the timed
+ * movements (DASH, JETPACK) are sampled at the simulation time given to gather.
+ *
+ * The forces are interpreted as follows, in world units and seconds:
+ * - RUN: horizontal speed, scaled by the run input of the character.
+ * - JUMP: vertical speed given when the jump is used.
+ * - DASH: impulse, converted to a horizontal speed by DASH_SPEED_SCALE, while the dash lasts.
+ * - CLIMB: upward speed while climbing, gravity is ignored.
+ * - JETPACK: upward acceleration while the jetpack is used, opposed by gravity.
+ *
+ * When a call would take more than MAX_STEPS_PER_ADVANCE steps, as after a hitch, the steps
+ * beyond the limit are not integrated: the time they covered is reported by getDroppedTime.
+ */
+#ifndef KINEMATICINTEGRATOR_HPP
+#define KINEMATICINTEGRATOR_HPP
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "Character.hpp"
+
+/**
+ * @struct KinematicBodies
+ * @brief Structure of arrays holding the kinematic state of a batch of characters.
+ */
+struct KinematicBodies {
+    std::vector<int> ids; ///< The IDs of the characters.
+    std::vector<double> x; ///< The horizontal positions.
+    std::vector<double> y; ///< The vertical positions.
+    std::vector<double> vx; ///< The horizontal velocities.
+    std::vector<double> vy; ///< The vertical velocities.
+    std::vector<double> ax; ///< The horizontal accelerations, gravity excluded.
+    std::vector<double> ay; ///< The vertical accelerations, gravity excluded.
+    std::vector<double> gravityScale; ///< The scale of gravity, 0 for characters ignoring it.
+    std::vector<double> groundHeight; ///< The height of the ground under each character.
+    std::vector<std::uint8_t> grounded; ///< 1 if the character stands on the ground, otherwise 0.
+
+    /**
+     * @brief Appends a body.
+     * @param id The ID of the character.
+     * @param position The position of the character.
+     * @param velocity The velocity of the character.
+     * @param acceleration The acceleration of the character, gravity excluded.
+     * @param gravity The scale of gravity for the character.
+     * @param ground The height of the ground under the character.
+     */
+    void add(int id, const Vector2D&position, const Vector2D&velocity, const Vector2D&acceleration, double gravity,
+             double ground);
+
+    /**
+     * @brief Reserves storage for a number of bodies.
+     * @param capacity The number of bodies.
+     */
+    void reserve(std::size_t capacity);
+
+    /**
+     * @brief Retrieves the number of bodies.
+     * @return The number of bodies.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Removes every body, keeping the storage.
+     */
+    void clear();
+};
+
+/**
+ * @class KinematicIntegrator
+ * @brief Fixed-timestep integrator of the movement of characters.
+ */
+class KinematicIntegrator {
+    double timestep; ///< Duration of a step, in seconds.
+    double gravity; ///< Downward acceleration, in world units per second squared.
+    double accumulator = 0.0; ///< Elapsed time not yet consumed by a step.
+    double dropped = 0.0; ///< Elapsed time discarded by advance since the last reset.
+
+public:
+    static constexpr double DEF_TIMESTEP = 1.0 / 60.0; ///< Default duration of a step.
+    static constexpr double DEF_GRAVITY = 4.0; ///< Default gravity, lower than the default jetpack thrust.
+    /**
+     * Converts a dash force to a horizontal speed: the default dash force of 1000 becomes 10 units
+     * per second, so that a default dash of 0.4 seconds covers 4 units, the width of a tile.
+     */
+    static constexpr double DASH_SPEED_SCALE = 0.01;
+    /**
+     * Maximum number of steps of a single advance, half a second at the default timestep, so that
+     * a long hitch does not stall the next frame. The time of the steps beyond it is dropped.
+     */
+    static constexpr int MAX_STEPS_PER_ADVANCE = 8;
+
+    /**
+     * @brief Constructs a KinematicIntegrator with the default timestep and gravity.
+     */
+    KinematicIntegrator();
+
+    /**
+     * @brief Constructs a KinematicIntegrator with a specified timestep and gravity.
+     * @param timestep The duration of a step, in seconds.
+     * @param gravity The downward acceleration.
+     * @throws std::invalid_argument If the timestep is not strictly positive or the gravity is negative.
+     */
+    KinematicIntegrator(double timestep, double gravity);
+
+    /**
+     * @brief Integrates a single step over every body.
+     * @param bodies The bodies to integrate.
+     */
+    void step(KinematicBodies&bodies) const;
+
+    /**
+     * @brief Consumes elapsed time in fixed steps, keeping the remainder for the next call.
+     *
+     * At most MAX_STEPS_PER_ADVANCE steps are taken, the whole steps left over are dropped and
+     * added to getDroppedTime, and only the remainder below a step is kept.
+     * @param bodies The bodies to integrate.
+     * @param elapsedSeconds The time elapsed since the previous call.
+     * @return The number of steps integrated.
+     * @throws std::invalid_argument If the elapsed time is negative.
+     */
+    int advance(KinematicBodies&bodies, double elapsedSeconds);
+
+    /**
+     * @brief Appends the kinematic state of a character, deriving its velocity from its movements.
+     *
+     * The movements are found by kind rather than by name, and a missing one has no effect.
+     * @param character The character.
+     * @param ground The height of the ground under the character.
+     * @param bodies The bodies to append to.
+     * @param now The simulation time at which the timed movements are sampled.
+     */
+    static void gather(const Character&character, double ground, KinematicBodies&bodies,
+                       std::chrono::time_point<std::chrono::steady_clock> now);
+
+    /**
+     * @brief Writes an integrated body back to its character, landing it or making it take off.
+     * @param bodies The integrated bodies.
+     * @param index The index of the body of the character.
+     * @param character The character.
+     */
+    static void scatter(const KinematicBodies&bodies, std::size_t index, Character&character);
+
+    /**
+     * @brief Retrieves the duration of a step.
+     * @return The timestep, in seconds.
+     */
+    [[nodiscard]] double getTimestep() const;
+
+    /**
+     * @brief Retrieves the elapsed time dropped by advance beyond MAX_STEPS_PER_ADVANCE since the last reset.
+     * @return The dropped time, in seconds.
+     */
+    [[nodiscard]] double getDroppedTime() const;
+
+    /**
+     * @brief Discards the elapsed time not yet consumed and the dropped time, typically when the level changes.
+     */
+    void reset();
+};
+#endif //KINEMATICINTEGRATOR_HPP
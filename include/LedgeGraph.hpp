@@ -0,0 +1,194 @@
+/**
+ * @file LedgeGraph.hpp
+ * @brief Defines the LedgeGraph class, the ledges of a tile map and the moves linking them.
+ *
+ * A ledge is a horizontal run of free tiles standing on a floor. Walking along a ledge needs
+ * nothing, but going from one ledge to another needs a movement: dropping off with RUN, jumping,
+ * dashing over a pit, climbing or flying up with the jetpack. Each link is annotated with the
+ * movement it needs and the strength that movement must reach. The geometry is computed once per
+ * tile map; the links usable with a given set of movements are filtered once per MovementProfile
+ * and cached, so that every enemy of an archetype shares them.
+ *
+ * The cache is keyed by the rank of each strength of a profile among the thresholds of the links
+ * of its movement: two profiles of the same ranks allow exactly the same links, however slightly
+ * their strengths differ, and share one entry. The cache is emptied beyond MAX_CACHED_PROFILES.
+ */
+#ifndef LEDGEGRAPH_HPP
+#define LEDGEGRAPH_HPP
+#include <array>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "Character.hpp"
+#include "Movements.hpp"
+#include "TileMap.hpp"
+
+/**
+ * @struct MovementProfile
+ * @brief Strength of each movement of a character, as compared to the thresholds of the links.
+ *
+ * The strength of a movement is 0 when the character does not have it. RUN and CLIMB have no
+ * threshold, their strength is infinite when available.
+ */
+struct MovementProfile {
+    std::array<double, 5> strengths{}; ///< Strength of each movement, indexed by Movements.
+
+    /**
+     * @brief Computes the profile of a character from its current capabilities.
+     *
+     * JUMP is the take-off speed of a single jump reaching as high as all the consecutive jumps,
+     * DASH the distance covered by a dash, JETPACK the height gained with a full jetpack flight.
+     * @param character The character.
+     * @return The profile.
+     */
+    static MovementProfile of(const Character&character);
+
+    /**
+     * @brief Checks if a movement is strong enough for a threshold.
+     * @param movement The movement.
+     * @param threshold The strength required.
+     * @return True if the character has the movement and reaches the threshold, otherwise false.
+     */
+    [[nodiscard]] bool allows(Movements movement, double threshold) const;
+
+    /**
+     * @brief Compares two profiles.
+     * @param other The other profile.
+     * @return True if every strength is equal, otherwise false.
+     */
+    bool operator==(const MovementProfile&other) const = default;
+};
+
+/**
+ * @struct Ledge
+ * @brief A horizontal run of free tiles standing on a floor.
+ */
+struct Ledge {
+    int row; ///< The y-coordinate of the free tiles, which is also the height of the feet.
+    int left; ///< The x-coordinate of the leftmost tile.
+    int right; ///< The x-coordinate of the rightmost tile.
+};
+
+/**
+ * @struct LedgeLink
+ * @brief A move from one ledge to another.
+ */
+struct LedgeLink {
+    int from; ///< The index of the ledge of departure.
+    int to; ///< The index of the ledge of arrival.
+    Movements movement; ///< The movement needed.
+    double threshold; ///< The strength the movement must reach.
+    Vector2D takeoff; ///< The point where the move starts, at the feet of the character.
+    Vector2D landing; ///< The point where the move ends, at the feet of the character.
+};
+
+/**
+ * @class LedgeGraph
+ * @brief Ledges of a tile map linked by the movements of the characters.
+ */
+class LedgeGraph {
+    /**
+     * @struct Adjacency
+     * @brief Links usable with a profile, grouped by ledge of departure.
+     */
+    struct Adjacency {
+        std::vector<std::uint32_t> offsets; ///< Index of the first link of each ledge, plus the total.
+        std::vector<std::uint32_t> links; ///< Indices of the usable links.
+    };
+
+    std::vector<Ledge> ledges; ///< Every ledge, row after row, from left to right.
+    std::vector<std::uint32_t> rowOffsets; ///< Index of the first ledge of each row, plus the total.
+    std::vector<LedgeLink> links; ///< Every link, grouped by ledge of departure.
+    std::array<std::vector<double>, 5> thresholds; ///< Distinct thresholds of the links of each movement, sorted.
+
+    using ProfileKey = std::array<std::uint32_t, 5>; ///< Number of thresholds each strength of a profile reaches.
+    std::map<ProfileKey, Adjacency> profiles; ///< Usable links of each profile queried since the cache was emptied.
+
+    /**
+     * @brief Finds the links between every pair of ledges close enough to each other.
+     * @param map The tile map.
+     */
+    void linkLedges(const TileMap&map);
+
+    /**
+     * @brief Computes the key of a profile in the cache.
+     * @param profile The profile.
+     * @return The number of thresholds of its movement each strength reaches, 0 for a missing movement.
+     */
+    [[nodiscard]] ProfileKey keyOf(const MovementProfile&profile) const;
+
+    /**
+     * @brief Retrieves the usable links of a profile, filtering them on first use.
+     * @param profile The profile.
+     * @return The usable links.
+     */
+    const Adjacency& adjacency(const MovementProfile&profile);
+
+public:
+    static constexpr int MAX_LINK_HEIGHT = 16; ///< Largest height difference of a single link, in tiles.
+    static constexpr int MAX_JUMP_GAP = 4; ///< Widest gap crossed by a jump or a dash, in tiles.
+    static constexpr int MAX_DROP_GAP = 1; ///< Widest gap crossed by running off a ledge, in tiles.
+    static constexpr std::size_t MAX_CACHED_PROFILES = 64; ///< The cache is emptied beyond this number of profiles.
+
+    /**
+     * @brief Constructs an empty graph.
+     */
+    LedgeGraph() = default;
+
+    /**
+     * @brief Builds the graph of a tile map.
+     * @param map The tile map.
+     */
+    explicit LedgeGraph(const TileMap&map);
+
+    /**
+     * @brief Retrieves the ledge on which a character stands.
+     * @param feet The position of the feet of the character.
+     * @return The index of the ledge, or -1 if the character does not stand on one.
+     */
+    [[nodiscard]] int findLedge(const Vector2D&feet) const;
+
+    /**
+     * @brief Retrieves a ledge.
+     * @param index The index of the ledge.
+     * @return The ledge.
+     * @throws std::out_of_range If the index is invalid.
+     */
+    [[nodiscard]] const Ledge& getLedge(int index) const;
+
+    /**
+     * @brief Retrieves the number of ledges.
+     * @return The number of ledges.
+     */
+    [[nodiscard]] std::size_t getLedgeCount() const;
+
+    /**
+     * @brief Retrieves every link, whatever the movements of the characters.
+     * @return The links.
+     */
+    [[nodiscard]] const std::vector<LedgeLink>& getLinks() const;
+
+    /**
+     * @brief Retrieves the number of links usable with a profile.
+     * @param profile The profile.
+     * @return The number of links.
+     */
+    std::size_t getUsableLinkCount(const MovementProfile&profile);
+
+    /**
+     * @brief Finds a route with the fewest links from a ledge to another, using only the links of a profile.
+     * @param profile The profile.
+     * @param from The index of the ledge of departure.
+     * @param to The index of the ledge of arrival.
+     * @return The links to follow, empty if both ledges are the same, if the arrival cannot be reached
+     * or if an index is invalid.
+     */
+    std::vector<LedgeLink> findRoute(const MovementProfile&profile, int from, int to);
+
+    /**
+     * @brief Retrieves the number of profiles whose usable links are cached, those allowing the same links counted once.
+     * @return The number of profiles.
+     */
+    [[nodiscard]] std::size_t getCachedProfileCount() const;
+};
+#endif //LEDGEGRAPH_HPP
@@ -4,20 +4,66 @@
 
 #ifndef LEVEL_HPP
 #define LEVEL_HPP
+#include <functional>
+#include <span>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include "Enemy.hpp"
 #include "Area.hpp"
 #include "Areas.hpp"
+#include "SpawnScheduler.hpp"
+#include "SpatialGrid.hpp"
+#include "Vector2D.hpp"
+#include "KinematicIntegrator.hpp"
+#include "TileMap.hpp"
+#include "NavigationGraph.hpp"
+#include "FlowField.hpp"
+#include "LedgeGraph.hpp"
+#include "InterestManager.hpp"
+#include "CooldownTable.hpp"
+#include "Attacks.hpp"
+#include "DamageBuffer.hpp"
+#include "ProjectilePool.hpp"
+#include "EnemyAI.hpp"
+
+/**
+ * @struct AreaHit
+ * @brief A character hit by an area attack.
+ */
+struct AreaHit {
+    int characterId; ///< The ID of the character.
+    int damage; ///< The damage of the hit, after the falloff and before the modifiers of the character.
+};
 
 /**
  * @class Level
  * @brief Represents a game level containing areas and enemies.
  */
 class Level {
+    friend class Snapshot;
+
     int id; ///< Unique identifier for the level.
+    int length = LENGTH; ///< Number of areas along the x axis of the level grid.
+    int height = HEIGHT; ///< Number of areas along the y axis of the level grid.
     std::vector<std::vector<Area>> areas; ///< 2D grid of areas in the level.
-    std::map<int, Enemy> enemies; ///< Map of enemies in the level, keyed by their ID.
+    std::vector<Enemy> enemies; ///< Contiguous storage of the enemies in the level, in spawn order.
+    std::unordered_map<int, std::size_t> enemyIndex; ///< Index of each enemy in the storage, keyed by its ID.
+    SpawnScheduler spawnScheduler; ///< Spawn points of the level ordered by the time they become ready.
+    std::size_t spawnPointCount = 0; ///< Number of spawn points of the level, the most live entries of the scheduler.
+    SpatialGrid enemyGrid; ///< Spatial index of the enemy positions.
+    TileMap tileMap; ///< Tile interiors of the areas, built when the level is loaded.
+    NavigationGraph navigation; ///< Connectivity of the areas, built when the level is loaded.
+    FlowField chaseField; ///< Directions toward the chased character, shared by every enemy.
+    LedgeGraph ledges; ///< Ledges of the tile map and the moves linking them, built when the level is loaded.
+    InterestManager interest; ///< Enemies awake around the player, the others being dormant.
+    std::vector<std::size_t> woken; ///< Slots of the enemies woken up by the last focus.
+    std::vector<std::pair<int, int>> focusAreas; ///< Areas of the players of the last focus, reused between focuses.
+    CooldownTable cooldowns; ///< Ready-at ticks and readiness bitmasks of the capabilities of the enemies, not the players.
+    std::vector<std::size_t> buffedEnemies; ///< Slots of the enemies with a modifier that expires.
+    ProjectilePool projectiles; ///< Projectiles in flight within the level.
+    double maxFollowRange = 0.0; ///< Largest follow range among the enemies, bounding the grid queries.
+    double maxAttackRange = 0.0; ///< Largest attack range among the enemies, bounding the grid queries.
 
     /**
      * @brief Loads the level from a given set of areas.
@@ -33,10 +79,107 @@ class Level {
      */
     static Enemy getARandomEnemy(double difficulty_coefficient);
 
+    /**
+     * @brief Appends an enemy to the storage of the level.
+     * @param enemy The enemy to add.
+     * @return The ID of the added enemy.
+     */
+    int addEnemy(const Enemy&enemy);
+
+    /**
+     * @brief Retrieves a stored enemy by its ID.
+     * @param id ID of the enemy.
+     * @return A reference to the enemy.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    Enemy& enemyAt(int id);
+
+    /**
+     * @brief Schedules every spawn point of the level at its next ready time.
+     */
+    void scheduleAllSpawns();
+
+    /**
+     * @brief Schedules a spawn point at its next ready time, after it has been used.
+     *
+     * The entry of its previous readiness becomes stale; once stale entries outnumber the spawn
+     * points, the scheduler is compacted.
+     * @param area_x X-coordinate of the area.
+     * @param area_y Y-coordinate of the area.
+     * @param spawnId Spawn ID.
+     */
+    void reschedule(int area_x, int area_y, int spawnId);
+
+    /**
+     * @brief Checks if a scheduled entry still matches the next ready time of its spawn point.
+     * @param entry The scheduled entry.
+     * @return True if the spawn point was not used since the entry was scheduled, otherwise false.
+     */
+    [[nodiscard]] bool isLive(const SpawnScheduler::Entry&entry) const;
+
+    /**
+     * @brief Retrieves a stored enemy by its ID, waking it up if it is dormant.
+     * @param id ID of the enemy.
+     * @return A reference to the enemy.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    Enemy& awakeEnemyAt(int id);
+
+    /**
+     * @brief Computes the index of the area holding a position.
+     * @param position The position.
+     * @return The index of the area (x * height + y), or -1 if the position is outside of the grid.
+     */
+    [[nodiscard]] std::int64_t areaIndexOf(const Vector2D&position) const;
+
+    /**
+     * @brief Updates the spatial index and the area of an enemy after it moved.
+     * @param slot The index of the enemy in the storage.
+     */
+    void relocate(std::size_t slot);
+
+    /**
+     * @brief Recomputes the ready-at ticks of an enemy, after it used a capability, was hurt or landed.
+     * @param slot The index of the enemy in the storage.
+     */
+    void refreshCooldowns(std::size_t slot);
+
+    /**
+     * @brief Catches up with the time an enemy spent dormant, when it wakes up.
+     * @param slot The index of the enemy in the storage.
+     */
+    void fastForward(std::size_t slot);
+
+    /**
+     * @brief Keeps track of an enemy given a modifier, if the modifier expires.
+     * @param slot The index of the enemy in the storage.
+     * @param modifier The modifier.
+     */
+    void trackModifier(std::size_t slot, const Modifier&modifier);
+
+    /**
+     * @brief Removes the last enemies of the storage, as when rewinding to a state taken before they spawned.
+     * @param count The number of enemies kept.
+     */
+    void truncateEnemies(std::size_t count);
+
+    /**
+     * @brief Collects the enemies whose range, as given by a getter, contains a position.
+     * @param target The position to test.
+     * @param queryRadius The largest range among the enemies.
+     * @param range The getter of the range of an enemy.
+     * @return The IDs of the alive enemies in range.
+     */
+    [[nodiscard]] std::vector<int> enemiesInRange(const Vector2D&target, double queryRadius,
+                                                  double (Enemy::*range)() const) const;
+
 public:
-    static constexpr int HEIGHT = 3; ///< Height of the level grid.
-    static constexpr int LENGTH = 3; ///< Length of the level grid.
+    static constexpr int HEIGHT = 3; ///< Default height of the level grid.
+    static constexpr int LENGTH = 3; ///< Default length of the level grid.
     static constexpr float FILL_PROBABILITY = 0.05; ///< Probability of filling an area.
+    static constexpr int AREA_TILES = 32; ///< Side length of an area, in tiles.
+    static constexpr double AREA_SIZE = AREA_TILES; ///< Side length of an area, in world units; a tile is one unit wide.
+    static constexpr double EYE_HEIGHT = 0.5; ///< Height above the feet of a character from which it sees.
 
     /**
      * @brief Constructs a level with a given ID.
@@ -44,6 +187,15 @@ public:
      */
     explicit Level(int id);
 
+    /**
+     * @brief Constructs a level with a given ID and grid dimensions, used by generate.
+     * @param id Unique identifier for the level.
+     * @param length Number of areas along the x axis.
+     * @param height Number of areas along the y axis.
+     * @throws std::invalid_argument If a dimension is less than 2.
+     */
+    Level(int id, int length, int height);
+
     /**
      * @brief Constructs a level with a given ID and areas.
      * @param id Unique identifier for the level.
@@ -57,6 +209,18 @@ public:
      */
     [[nodiscard]] int getId() const;
 
+    /**
+     * @brief Gets the number of areas along the x axis of the level grid.
+     * @return The length of the grid.
+     */
+    [[nodiscard]] int getLength() const;
+
+    /**
+     * @brief Gets the number of areas along the y axis of the level grid.
+     * @return The height of the grid.
+     */
+    [[nodiscard]] int getHeight() const;
+
     /**
      * @brief Checks if the level is loaded.
      * @return True if the level is loaded, false otherwise.
@@ -106,18 +270,340 @@ public:
      * @param area_x X-coordinate of the area.
      * @param area_y Y-coordinate of the area.
      * @param spawnId Spawn ID.
+     * @param now The current time.
      * @return True if the enemy can spawn, false otherwise.
      */
-    bool can_spawn_at(int area_x, int area_y, int spawnId);
+    bool can_spawn_at(int area_x, int area_y, int spawnId,
+                      std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now());
 
     /**
      * @brief Spawns an enemy at the given area coordinates with the given spawn ID.
      * @param area_x X-coordinate of the area.
      * @param area_y Y-coordinate of the area.
      * @param spawnId Spawn ID.
+     * @param difficultyCoefficient The coefficient applied to the stats of the spawned enemy.
+     * @param now The current time.
      * @return The ID of the spawned enemy.
      */
-    int spawn_at(int area_x, int area_y, int spawnId, double difficultyCoefficient);
+    int spawn_at(int area_x, int area_y, int spawnId, double difficultyCoefficient,
+                 std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Pops the spawn points whose cooldown elapsed.
+     *
+     * A spawn point stays scheduled until it is used: one drained but not spawned is emitted
+     * again by the next drain.
+     * @param now The current time.
+     * @param maxEvents The maximum number of events to pop; remaining ready spawns stay queued.
+     * @return The spawn points that became ready, in ready-time order.
+     */
+    std::vector<SpawnEvent> drainSpawnEvents(std::chrono::time_point<std::chrono::steady_clock> now, int maxEvents);
+
+    /**
+     * @brief Spawns an enemy at every ready spawn point, up to a budget.
+     * @param now The current time.
+     * @param budget The maximum number of enemies to spawn.
+     * @param difficultyCoefficient The coefficient applied to the stats of the spawned enemies.
+     * @return The IDs of the spawned enemies.
+     */
+    std::vector<int> spawnReady(std::chrono::time_point<std::chrono::steady_clock> now, int budget,
+                                double difficultyCoefficient);
+
+    /**
+     * @brief Spawns a wave of enemies at the given spawn points in one batch.
+     *
+     * The enemy storage is grown once for the whole wave. Spawn points that are not ready at the
+     * given time are skipped; they are still scheduled, so none is lost.
+     * @param wave The spawn points to use.
+     * @param difficultyCoefficient The coefficient applied to the stats of the spawned enemies.
+     * @param now The current time, the one the wave was drained with.
+     * @return The IDs of the spawned enemies.
+     */
+    std::vector<int> spawnWave(const std::vector<SpawnEvent>&wave, double difficultyCoefficient,
+                               std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Reserves storage for a number of enemies so that spawning does not reallocate.
+     * @param capacity The number of enemies to reserve storage for.
+     */
+    void reserveEnemies(std::size_t capacity);
+
+    /**
+     * @brief Gets the number of enemies in the level.
+     * @return The number of enemies.
+     */
+    [[nodiscard]] std::size_t getEnemyCount() const;
+
+    /**
+     * @brief Gets the number of enemies the level can hold without reallocating.
+     * @return The reserved capacity.
+     */
+    [[nodiscard]] std::size_t getEnemyCapacity() const;
+
+    /**
+     * @brief Gets the time at which the next spawn point will be ready.
+     * @return The earliest ready time, or time_point::max() if no spawn point is scheduled.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getNextSpawnTime() const;
+
+    /**
+     * @brief Gets the world position at which a spawn point spawns its enemies.
+     *
+     * The enemies stand on the tile holding the spawn point, the area (x, y) covering
+     * the square [x, x + 1) * AREA_SIZE by [y, y + 1) * AREA_SIZE.
+     * @param area_x X-coordinate of the area.
+     * @param area_y Y-coordinate of the area.
+     * @param spawnId Spawn ID.
+     * @return The spawn position.
+     * @throws std::invalid_argument If the area has no such spawn point.
+     */
+    [[nodiscard]] Vector2D getSpawnPosition(int area_x, int area_y, int spawnId) const;
+
+    /**
+     * @brief Moves an enemy and updates the spatial index accordingly.
+     * @param id ID of the enemy.
+     * @param position The new position of the enemy.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    void setEnemyPosition(int id, const Vector2D&position);
+
+    /**
+     * @brief Sets the velocity of an enemy.
+     * @param id ID of the enemy.
+     * @param velocity The new velocity of the enemy.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    void setEnemyVelocity(int id, const Vector2D&velocity);
+
+    /**
+     * @brief Sets the horizontal run input of an enemy.
+     * @param id ID of the enemy.
+     * @param input The run input, between -1 (left) and 1 (right).
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    void setEnemyRunInput(int id, double input);
+
+    /**
+     * @brief Executes a movement of an enemy if it can be used.
+     * @param id ID of the enemy.
+     * @param movementName The name of the movement.
+     * @return True if the movement was executed, otherwise false.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    bool moveEnemy(int id, const std::string&movementName);
+
+    /**
+     * @brief Gets the height of the first floor tile under a position.
+     * @param position The position.
+     * @return The height of the ground.
+     */
+    [[nodiscard]] double getGroundHeight(const Vector2D&position) const;
+
+    /**
+     * @brief Gets the tile interiors of the areas of the level.
+     * @return The tile map, empty if the level is not loaded.
+     */
+    [[nodiscard]] const TileMap& getTileMap() const;
+
+    /**
+     * @brief Gets the coordinates of the area holding a position.
+     * @param position The position.
+     * @return The coordinates of the area, which may be outside of the grid, clamped by floorToCell.
+     */
+    [[nodiscard]] static std::pair<int, int> getAreaAt(const Vector2D&position);
+
+    /**
+     * @brief Gets the number of gateways to cross to go from an area to another.
+     *
+     * The distance field toward the target area is computed on first use and kept until the level is unloaded.
+     * @param fromX X-coordinate of the start area.
+     * @param fromY Y-coordinate of the start area.
+     * @param toX X-coordinate of the target area.
+     * @param toY Y-coordinate of the target area.
+     * @return The distance, or -1 if the target cannot be reached or an area is invalid.
+     */
+    int getAreaDistance(int fromX, int fromY, int toX, int toY);
+
+    /**
+     * @brief Gets the gateway to take from an area to get closer to another.
+     * @param fromX X-coordinate of the start area.
+     * @param fromY Y-coordinate of the start area.
+     * @param toX X-coordinate of the target area.
+     * @param toY Y-coordinate of the target area.
+     * @return The direction of the gateway, or (0, 0) if there is none to take.
+     * @see NavigationGraph::getNextGateway
+     */
+    Direction2D getNextGateway(int fromX, int fromY, int toX, int toY);
+
+    /**
+     * @brief Gets the gateway every alive enemy should take to get closer to a position.
+     *
+     * The enemies share the distance field of the area holding the target, computed once.
+     * @param target The position to reach, typically the position of the player.
+     * @param ids The IDs of the enemies, overwritten.
+     * @param gateways The direction of the gateway of each enemy, overwritten; (0, 0) if there is none to take.
+     */
+    void getEnemyNextGateways(const Vector2D&target, std::vector<int>&ids, std::vector<Direction2D>&gateways);
+
+    /**
+     * @brief Gets the direction every alive enemy within follow range of a position should follow to reach it.
+     *
+     * The enemies read a flow field shared by all of them, rebuilt only when the position changes area.
+     * @param target The position to reach, typically the position of the player.
+     * @param ids The IDs of the enemies in follow range, overwritten.
+     * @param directions The unit direction of each enemy, overwritten; null if it cannot reach the target.
+     */
+    void getChaseDirections(const Vector2D&target, std::vector<int>&ids, std::vector<Vector2D>&directions);
+
+    /**
+     * @brief Plans the moves a character needs to go from its ledge to the ledge of a target.
+     *
+     * A position in the air is projected on the ground below it.
+     * @param profile The movement profile of the character.
+     * @param from The position of the character.
+     * @param to The position of the target.
+     * @return The links to follow, empty if no route uses only the movements of the profile.
+     */
+    std::vector<LedgeLink> planRoute(const MovementProfile&profile, const Vector2D&from, const Vector2D&to);
+
+    /**
+     * @brief Gets the ledges of the level and the moves linking them.
+     * @return The ledge graph, empty if the level is not loaded.
+     */
+    LedgeGraph& getLedgeGraph();
+
+    /**
+     * @brief Gets the connectivity of the areas of the level.
+     * @return The navigation graph, empty if the level is not loaded.
+     */
+    [[nodiscard]] const NavigationGraph& getNavigationGraph() const;
+
+    /**
+     * @brief Appends the kinematic state of every alive and awake enemy to a batch of bodies.
+     * @param bodies The bodies to append to.
+     * @param now The simulation time at which the timed movements are sampled.
+     */
+    void gatherEnemyBodies(KinematicBodies&bodies, std::chrono::time_point<std::chrono::steady_clock> now);
+
+    /**
+     * @brief Writes integrated bodies back to the enemies and updates the spatial index.
+     * @param bodies The integrated bodies.
+     * @param first The index of the first enemy body, as appended by gatherEnemyBodies.
+     */
+    void scatterEnemyBodies(const KinematicBodies&bodies, std::size_t first);
+
+    /**
+     * @brief Appends what every alive and awake enemy needs to decide to a batch, readiness as of the last update.
+     *
+     * The line of sight of an enemy is only cast toward the targets within its attack range.
+     * @param perception The batch to append to.
+     * @param targets The positions of the targets, typically the living players.
+     * @param isDriven Tells the enemies driven otherwise, such as by a behaviour, which are left out.
+     * @see EnemyAI
+     */
+    void gatherEnemyPerception(EnemyPerception&perception, std::span<const Vector2D> targets,
+                               const std::function<bool(int)>&isDriven);
+
+    /**
+     * @brief Sets the run input of every enemy of a batch from its command.
+     * @param perception The batch, as appended by gatherEnemyPerception.
+     * @param commands The commands of the batch.
+     */
+    void applyEnemyRunInputs(const EnemyPerception&perception, const EnemyCommands&commands);
+
+    /**
+     * @brief Sets the activation radius: only the enemies within this number of gateways of the
+     * player are awake and simulated.
+     * @param radius The radius, or InterestManager::UNLIMITED to keep every enemy awake.
+     * @throws std::invalid_argument If the radius is negative and not UNLIMITED.
+     */
+    void setActivationRadius(int radius);
+
+    /**
+     * @brief Gets the activation radius.
+     * @return The radius, or InterestManager::UNLIMITED.
+     */
+    [[nodiscard]] int getActivationRadius() const;
+
+    /**
+     * @brief Centers the awake enemies on the area of the player, waking up the enemies that became near.
+     * @param player The position of the player.
+     * @return The number of enemies that woke up.
+     */
+    std::size_t focusOn(const Vector2D&player);
+
+    /**
+     * @brief Centers the awake enemies on the areas of several players, waking up the enemies that became near.
+     * @param players The positions of the players.
+     * @return The number of enemies that woke up.
+     */
+    std::size_t focusOn(std::span<const Vector2D> players);
+
+    /**
+     * @brief Wakes up a dormant enemy on demand, until the player next changes area.
+     * @param id ID of the enemy.
+     * @return True if the enemy was dormant, otherwise false.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    bool wakeEnemy(int id);
+
+    /**
+     * @brief Checks if an enemy is awake.
+     * @param id ID of the enemy.
+     * @return True if the enemy is awake, otherwise false.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    [[nodiscard]] bool isEnemyAwake(int id) const;
+
+    /**
+     * @brief Gets the number of awake enemies, dead ones included.
+     * @return The number of enemies.
+     */
+    std::size_t getAwakeEnemyCount();
+
+    /**
+     * @brief Gets the alive enemies whose follow range contains a position.
+     * @param target The position to test, typically the position of the player.
+     * @return The IDs of the enemies, in no particular order.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesInFollowRange(const Vector2D&target) const;
+
+    /**
+     * @brief Gets the alive enemies whose attack range contains a position.
+     * @param target The position to test, typically the position of the player.
+     * @return The IDs of the enemies, in no particular order.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesInAttackRange(const Vector2D&target) const;
+
+    /**
+     * @brief Checks if two characters standing at given positions see each other.
+     * @param from The position of the first character.
+     * @param to The position of the second character.
+     * @return True if no solid tile stands between their eyes, otherwise false.
+     */
+    [[nodiscard]] bool hasLineOfSight(const Vector2D&from, const Vector2D&to) const;
+
+    /**
+     * @brief Gets the alive enemies able to hit a position: in attack range and in line of sight.
+     *
+     * The lines of sight of every enemy in attack range are cast in one batch.
+     * @param target The position to test, typically the position of the player.
+     * @return The IDs of the enemies, in no particular order.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesInReach(const Vector2D&target) const;
+
+    /**
+     * @brief Gets the alive enemies able to hit a position with an attack that was ready at the last readiness update.
+     * @param target The position to test, typically the position of the player.
+     * @return The IDs of the enemies, in no particular order.
+     */
+    [[nodiscard]] std::vector<int> getEnemiesReadyToAttack(const Vector2D&target) const;
+
+    /**
+     * @brief Gets the IDs of every enemy in the level, in spawn order.
+     * @return The enemy IDs.
+     */
+    [[nodiscard]] std::vector<int> getEnemyIds() const;
 
     /**
      * @brief Gets the enemy with the given ID.
@@ -126,6 +612,14 @@ public:
      */
     [[nodiscard]] Enemy getEnemy(int enemyId) const;
 
+    /**
+     * @brief Gets the enemy with the given ID, without copying it.
+     * @param enemyId ID of the enemy.
+     * @return The enemy, valid until an enemy is added or the level is unloaded.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    [[nodiscard]] const Enemy& findEnemy(int enemyId) const;
+
     /**
      * @brief Checks if the given ID is a valid enemy ID.
      * @param id Enemy ID.
@@ -139,7 +633,7 @@ public:
      * @param y Y-coordinate.
      * @return True if the coordinates are valid, false otherwise.
      */
-    static bool isValidCoordinates(int x, int y);
+    [[nodiscard]] bool isValidCoordinates(int x, int y) const;
 
     /**
      * @brief Gets an existing spawn point in the level.
@@ -196,6 +690,60 @@ public:
      */
     void hurtEnemy(int id, int damage);
 
+    /**
+     * @brief Finds every living enemy within the area of an attack, with a single query of the spatial index.
+     * @param center The position of the attacker.
+     * @param facing The horizontal direction the attacker faces, 1 for right and -1 for left.
+     * @param area The area of the attack.
+     * @param damage The damage of the attack, before the falloff.
+     * @param hits Receives the enemies hit, in no particular order; cleared first.
+     */
+    void findEnemiesInArea(const Vector2D&center, int facing, const AreaOfEffect&area, int damage,
+                           std::vector<AreaHit>&hits) const;
+
+    /**
+     * @brief Applies the hits of a tick to the enemies, once per enemy.
+     *
+     * Each enemy hit is woken up, damaged by the sum of its hits and, if its hurt animation
+     * started, has its readiness refreshed. Hits of unknown IDs and of dead enemies are skipped.
+     * @param hits Hits on enemies, grouped by target.
+     * @param results Receives the outcome for each enemy hit; appended to.
+     * @see DamageBuffer::total
+     */
+    void resolveEnemyHits(std::span<const DamageHit> hits, std::vector<DamageResult>&results);
+
+    /**
+     * @brief Fires a projectile within the level.
+     * @param ownerId The ID of the character firing the projectile.
+     * @param isHostile True if the projectile is fired by an enemy and only hits the player.
+     * @param position The starting position of the projectile.
+     * @param velocity The velocity of the projectile, in units per second.
+     * @param damage The damage of the projectile.
+     * @param lifetime The flight time of the projectile, in seconds.
+     * @return The ID of the projectile, -1 if too many projectiles are in flight.
+     * @throws std::invalid_argument If the damage is negative or the lifetime is not strictly positive.
+     * @see ProjectilePool::spawn
+     */
+    int fireProjectile(int ownerId, bool isHostile, const Vector2D&position, const Vector2D&velocity, int damage,
+                       double lifetime);
+
+    /**
+     * @brief Moves the projectiles in flight and collides them with the tiles and the characters, in one pass.
+     * @param elapsedSeconds The duration of the tick.
+     * @param playerIds The IDs of the players that can be hit.
+     * @param playerPositions The position of each of these players.
+     * @param hits Receives the hits of the projectiles; appended to.
+     * @see ProjectilePool::step
+     */
+    void stepProjectiles(double elapsedSeconds, std::span<const int> playerIds,
+                         std::span<const Vector2D> playerPositions, std::vector<DamageHit>&hits);
+
+    /**
+     * @brief Retrieves the projectiles in flight.
+     * @return The pool of the projectiles.
+     */
+    [[nodiscard]] const ProjectilePool& getProjectiles() const;
+
     /**
      * @brief Performs an attack on an enemy identified by its ID.
      * @param id The ID of the enemy to attack.
@@ -204,6 +752,66 @@ public:
      */
     int attackEnemy(int id, const std::string& attackName);
 
+    /**
+     * @brief Lands an enemy, giving its jumps back.
+     * @param id The ID of the enemy.
+     * @throws std::invalid_argument If the ID is invalid.
+     */
+    void landEnemy(int id);
+
+    /**
+     * @brief Adds a modifier to the stats of an enemy.
+     * @param id The ID of the enemy.
+     * @param modifier The modifier.
+     * @throws std::invalid_argument If the ID is invalid or the multiplier is negative.
+     */
+    void addEnemyModifier(int id, const Modifier&modifier);
+
+    /**
+     * @brief Extends the expiry of a modifier an enemy already has, or adds it.
+     * @param id The ID of the enemy.
+     * @param modifier The modifier.
+     * @throws std::invalid_argument If the ID is invalid or the multiplier is negative.
+     * @see Character::refreshModifier
+     */
+    void refreshEnemyModifier(int id, const Modifier&modifier);
+
+    /**
+     * @brief Takes health from an enemy without the hurt animation, as damage over time does.
+     * @param id The ID of the enemy.
+     * @param damage The amount of health to take.
+     * @throws std::invalid_argument If the ID is invalid or the damage is negative.
+     */
+    void bleedEnemy(int id, int damage);
+
+    /**
+     * @brief Removes the expired modifiers of the enemies, only visiting the enemies with a temporary one.
+     * @param now The current time.
+     */
+    void expireEnemyModifiers(ModifierStack::TimePoint now);
+
+    /**
+     * @brief Computes the readiness bitmask of every enemy in one pass.
+     * @param now The current time.
+     * @see CooldownTable
+     */
+    void updateReadiness(std::chrono::time_point<std::chrono::steady_clock> now);
+
+    /**
+     * @brief Gets the readiness bitmask of every enemy, as of the last update.
+     * @param ids The IDs of the enemies, overwritten.
+     * @param masks The bitmask of each enemy, overwritten.
+     */
+    void getEnemyReadiness(std::vector<int>&ids, std::vector<CooldownTable::Mask>&masks) const;
+
+    /**
+     * @brief Gets the phase of the last attack of every enemy.
+     * @param now The current time.
+     * @param states Receives the state of each enemy, in the order of getEnemyIds; appended to.
+     * @see Character::getAttackState
+     */
+    void getEnemyAttackStates(std::chrono::time_point<std::chrono::steady_clock> now, std::vector<AttackState>&states) const;
+
     /**
      * @brief Unloads the level, removing all areas and enemies.
      */
@@ -0,0 +1,125 @@
+/**
+ * @file ModifierStack.hpp
+ * @brief Defines the ModifierStack class, the modifiers applied to the stats of a character.
+ *
+ * Items, the difficulty and temporary buffs do not rewrite the base stats of a character: each one
+ * pushes a modifier onto the stack of the character. The stack keeps, for each stat, the sum of the
+ * additive terms and the product of the multipliers of its modifiers, so that a derived stat is
+ * (base + added) * multiplier whatever the number of modifiers. The aggregates are only recomputed
+ * when a modifier is added or expires, never per frame.
+ */
+#ifndef MODIFIERSTACK_HPP
+#define MODIFIERSTACK_HPP
+#include <array>
+#include <chrono>
+#include <vector>
+#include "magic_enum/magic_enum.hpp"
+
+/**
+ * @enum Stats
+ * @brief The stats of a character that modifiers can change.
+ */
+enum Stats {
+    MAX_HEALTH, ///< Maximum health.
+    RUN_FORCE, ///< Force of the RUN movement.
+    JUMP_COUNT, ///< Number of consecutive jumps.
+    ATTACK_DAMAGE, ///< Damage of every attack.
+    DAMAGE_TAKEN ///< Factor applied to the damage of the hits taken, from a base of 1.
+};
+
+/**
+ * @enum ModifierSources
+ * @brief Where a modifier comes from.
+ */
+enum ModifierSources {
+    ITEM, ///< An item picked up from a chest, permanent.
+    DIFFICULTY, ///< The difficulty of the game when the character spawned, permanent.
+    BUFF, ///< A temporary effect.
+    STATUS_EFFECT ///< A status effect, lasting as long as it (StatusEffectPool).
+};
+
+/**
+ * @struct Modifier
+ * @brief A change of a stat of a character.
+ */
+struct Modifier {
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    Stats stat; ///< The stat changed.
+    ModifierSources source; ///< Where the modifier comes from.
+    double added = 0.0; ///< Added to the base value of the stat.
+    double multiplier = 1.0; ///< Multiplies the base value of the stat, plus the added terms.
+    TimePoint expiresAt = TimePoint::max(); ///< The time the modifier expires, TimePoint::max() if permanent.
+};
+
+/**
+ * @class ModifierStack
+ * @brief The modifiers of a character, with their aggregates per stat.
+ */
+class ModifierStack {
+    friend class Snapshot;
+
+public:
+    using TimePoint = Modifier::TimePoint; ///< Clock used by the capabilities.
+
+    static constexpr std::size_t STAT_COUNT = magic_enum::enum_count<Stats>(); ///< Number of stats.
+
+private:
+    std::vector<Modifier> modifiers; ///< Every modifier, in the order they were added.
+    std::array<double, STAT_COUNT> added{}; ///< Sum of the added terms of each stat.
+    std::array<double, STAT_COUNT> multipliers{}; ///< Product of the multipliers of each stat.
+    TimePoint nextExpiry = TimePoint::max(); ///< The earliest expiry of the modifiers.
+
+    /**
+     * @brief Recomputes the aggregates and the earliest expiry from the modifiers.
+     */
+    void aggregate();
+
+public:
+    /**
+     * @brief Constructs an empty stack, leaving every stat to its base value.
+     */
+    ModifierStack();
+
+    /**
+     * @brief Adds a modifier.
+     * @param modifier The modifier.
+     * @throws std::invalid_argument If the multiplier is negative.
+     */
+    void add(const Modifier&modifier);
+
+    /**
+     * @brief Extends the expiry of a modifier equal to a given one but for its expiry.
+     * @param modifier The modifier, with its new expiry.
+     * @return True if a modifier was found, whose expiry is now the latest of both, otherwise false.
+     */
+    bool refresh(const Modifier&modifier);
+
+    /**
+     * @brief Removes the modifiers that expired.
+     * @param now The current time.
+     * @return True if a modifier was removed, otherwise false.
+     */
+    bool expire(TimePoint now);
+
+    /**
+     * @brief Computes the derived value of a stat.
+     * @param stat The stat.
+     * @param base The base value of the stat.
+     * @return (base + the added terms) * the multipliers.
+     */
+    [[nodiscard]] double apply(Stats stat, double base) const;
+
+    /**
+     * @brief Retrieves the earliest expiry of the modifiers.
+     * @return The time, TimePoint::max() if every modifier is permanent.
+     */
+    [[nodiscard]] TimePoint getNextExpiry() const;
+
+    /**
+     * @brief Retrieves the modifiers.
+     * @return The modifiers, in the order they were added.
+     */
+    [[nodiscard]] const std::vector<Modifier>& getModifiers() const;
+};
+#endif //MODIFIERSTACK_HPP
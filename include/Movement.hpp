@@ -13,6 +13,7 @@
 #define MOVEMENT_HPP
 #include <string>
 #include <chrono>
+#include <memory>
 #include "Movements.hpp"
 
 /**
@@ -23,6 +24,8 @@
  * Derived classes can override methods to implement specific movement behaviors.
  */
 class Movement {
+    friend class Snapshot;
+
 protected:
     std::string name; ///< The name of the movement (e.g., "JUMP", "RUN").
     double force; ///< The force applied during the movement.
@@ -34,11 +37,11 @@ public:
     virtual ~Movement() = default;
 
     /**
-     * @brief Increases the force of the movement by a specified amount.
-     * @param amount The amount to increase the force by.
+     * @brief Sets the force of the movement.
+     * @param amount The new force.
      * @throws std::invalid_argument If the amount is negative.
      */
-    virtual void increaseForce(double amount);
+    void setForce(double amount);
 
     /**
      * @brief Constructs a Movement object with specified parameters.
@@ -51,9 +54,10 @@ public:
 
     /**
      * @brief Checks if the movement is currently in use.
+     * @param now The current time.
      * @return True if the movement is in use, otherwise false.
      */
-    virtual bool isUsing() const;
+    virtual bool isUsing(std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now()) const;
 
     /**
      * @brief Checks if the movement can be used.
@@ -102,5 +106,30 @@ public:
      * @return The time point of the last usage.
      */
     [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getLastUsageTime() const;
+
+    /**
+     * @brief Retrieves the time at which the animation of the last usage ends.
+     * @return The end time, meaningless if the movement was never used.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getEndTime() const;
+
+    /**
+     * @brief Retrieves the time at which the cooldown of the last usage elapses.
+     * @return The ready time, meaningless if the movement was never used.
+     */
+    [[nodiscard]] std::chrono::time_point<std::chrono::steady_clock> getReadyTime() const;
+
+    /**
+     * @brief Computes the time left before the movement can be used again.
+     * @param now The current time.
+     * @return The remaining time in seconds, 0 if the movement is ready.
+     */
+    [[nodiscard]] virtual double getRemainingTime(std::chrono::time_point<std::chrono::steady_clock> now) const;
+
+    /**
+     * @brief Copies the movement with its state, keeping its type.
+     * @return The copy, owned by nobody else.
+     */
+    [[nodiscard]] virtual std::shared_ptr<Movement> clone() const;
 };
 #endif //MOVEMENT_HPP
@@ -0,0 +1,139 @@
+/**
+ * @file NavigationGraph.hpp
+ * @brief Defines the NavigationGraph class, the connectivity of the areas of a level through their gateways.
+ *
+ * Two neighbouring areas are connected when both of them have a gateway toward the other one.
+ * Breadth-first distance fields are computed lazily, once per target area, and cached until the
+ * graph is rebuilt, which only happens when the level changes. Each field also stores the gateway
+ * to take from every area to get closer to its target, so that a lookup is O(1).
+ */
+#ifndef NAVIGATIONGRAPH_HPP
+#define NAVIGATIONGRAPH_HPP
+#include <cstdint>
+#include <vector>
+#include "Area.hpp"
+
+/**
+ * @class NavigationGraph
+ * @brief Graph of the areas of a level, with cached distance fields toward target areas.
+ */
+class NavigationGraph {
+    /**
+     * @struct Field
+     * @brief Distances and next gateways of every area toward a target area.
+     */
+    struct Field {
+        std::vector<std::uint16_t> distance; ///< Number of gateways to cross to reach the target, per area.
+        std::vector<std::uint8_t> next; ///< Index of the gateway to take toward the target, per area.
+    };
+
+    int length = 0; ///< Number of areas along the x axis.
+    int height = 0; ///< Number of areas along the y axis.
+    std::vector<std::uint8_t> gateways; ///< Bitmask of the connected gateways of each area.
+    std::vector<Field> fields; ///< Distance field toward each area, empty until first requested.
+    std::size_t cachedFields = 0; ///< Number of fields computed.
+    std::vector<std::uint32_t> visits; ///< Stamp of the last bounded search that reached each area.
+    std::uint32_t stamp = 0; ///< Stamp of the current bounded search.
+
+    static constexpr std::uint16_t UNREACHABLE = 0xFFFF; ///< Distance of the areas that cannot reach the target.
+    static constexpr std::uint8_t NO_GATEWAY = 0xFF; ///< Next gateway of the target and of unreachable areas.
+
+    /**
+     * @brief Computes the index of an area.
+     * @param x The x-coordinate of the area.
+     * @param y The y-coordinate of the area.
+     * @return The index.
+     */
+    [[nodiscard]] std::size_t index(int x, int y) const;
+
+    /**
+     * @brief Retrieves the distance field toward an area, computing it on first use.
+     * @param target The index of the target area.
+     * @return The field.
+     */
+    const Field& field(std::size_t target);
+
+public:
+    static constexpr std::size_t MAX_CACHED_FIELDS = 256; ///< The cache is emptied beyond this number of fields.
+
+    /**
+     * @brief Constructs an empty graph.
+     */
+    NavigationGraph() = default;
+
+    /**
+     * @brief Builds the graph of a grid of areas.
+     * @param areas 2D grid of areas, indexed by x then y.
+     * @throws std::invalid_argument If the grid is not rectangular.
+     */
+    explicit NavigationGraph(const std::vector<std::vector<Area>>&areas);
+
+    /**
+     * @brief Checks if a gateway of an area leads to its neighbour.
+     * @param x The x-coordinate of the area.
+     * @param y The y-coordinate of the area.
+     * @param direction The direction of the gateway.
+     * @return True if both areas are connected through this gateway, otherwise false.
+     */
+    [[nodiscard]] bool isConnected(int x, int y, const Direction2D&direction) const;
+
+    /**
+     * @brief Retrieves the number of gateways to cross to go from an area to another.
+     * @param fromX The x-coordinate of the start area.
+     * @param fromY The y-coordinate of the start area.
+     * @param toX The x-coordinate of the target area.
+     * @param toY The y-coordinate of the target area.
+     * @return The distance, or -1 if the target cannot be reached or an area is invalid.
+     */
+    int getDistance(int fromX, int fromY, int toX, int toY);
+
+    /**
+     * @brief Retrieves the gateway to take from an area to get closer to another.
+     * @param fromX The x-coordinate of the start area.
+     * @param fromY The y-coordinate of the start area.
+     * @param toX The x-coordinate of the target area.
+     * @param toY The y-coordinate of the target area.
+     * @return The direction of the gateway, or (0, 0) if both areas are the same, if the target
+     * cannot be reached or if an area is invalid.
+     */
+    Direction2D getNextGateway(int fromX, int fromY, int toX, int toY);
+
+    /**
+     * @brief Collects the areas within a number of gateways of an area.
+     *
+     * The search stops at the radius, so that its cost only depends on the areas it reaches.
+     * @param x The x-coordinate of the area.
+     * @param y The y-coordinate of the area.
+     * @param radius The largest number of gateways to cross.
+     * @param areas Receives the indices (x * height + y) of the areas reached, the start area included;
+     * left empty if the start area is invalid.
+     */
+    void collectAreasWithin(int x, int y, int radius, std::vector<std::size_t>&areas);
+
+    /**
+     * @brief Checks if area coordinates are within the graph.
+     * @param x The x-coordinate of the area.
+     * @param y The y-coordinate of the area.
+     * @return True if the coordinates are valid, otherwise false.
+     */
+    [[nodiscard]] bool contains(int x, int y) const;
+
+    /**
+     * @brief Retrieves the number of areas along the x axis.
+     * @return The length of the graph.
+     */
+    [[nodiscard]] int getLength() const;
+
+    /**
+     * @brief Retrieves the number of areas along the y axis.
+     * @return The height of the graph.
+     */
+    [[nodiscard]] int getHeight() const;
+
+    /**
+     * @brief Retrieves the number of distance fields currently cached.
+     * @return The number of fields.
+     */
+    [[nodiscard]] std::size_t getCachedFieldCount() const;
+};
+#endif //NAVIGATIONGRAPH_HPP
@@ -0,0 +1,147 @@
+/**
+ * @file ProjectilePool.hpp
+ * @brief Defines the ProjectilePool class, the projectiles in flight within a level.
+ *
+ * A ranged attack fires a projectile that travels in a straight line until it hits a solid tile, a
+ * character, or runs out of time. The projectiles live in a pool of fixed capacity whose positions,
+ * velocities and payloads are stored as separate dense arrays, so that a single linear pass per tick
+ * moves every projectile and tests it against the tile map and the spatial index of the characters.
+ * A spent projectile is replaced by the last one, keeping the live projectiles contiguous.
+ *
+ * The pool does not own the characters: it reports the hits, which the owner resolves like any other.
+ */
+#ifndef PROJECTILEPOOL_HPP
+#define PROJECTILEPOOL_HPP
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+#include "DamageBuffer.hpp"
+#include "SpatialGrid.hpp"
+#include "TileMap.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @class ProjectilePool
+ * @brief Fixed-capacity structure of arrays of the projectiles in flight.
+ */
+class ProjectilePool {
+public:
+    static constexpr std::size_t DEF_CAPACITY = 10000; ///< Default number of projectiles in flight at once.
+    static constexpr double HIT_RADIUS = 0.5; ///< Distance from the center of a character within which a projectile hits it.
+    static constexpr double HIT_HEIGHT = 0.5; ///< Height above the feet of a character of its center.
+
+private:
+    std::size_t capacity = DEF_CAPACITY; ///< Maximum number of projectiles in flight.
+    int nextId = 0; ///< The ID given to the next projectile fired.
+    std::vector<int> ids; ///< The ID of each projectile.
+    std::vector<double> xs; ///< The horizontal position of each projectile.
+    std::vector<double> ys; ///< The vertical position of each projectile.
+    std::vector<double> velocitiesX; ///< The horizontal velocity of each projectile, in units per second.
+    std::vector<double> velocitiesY; ///< The vertical velocity of each projectile, in units per second.
+    std::vector<double> lifetimes; ///< The remaining flight time of each projectile, in seconds.
+    std::vector<int> owners; ///< The ID of the character that fired each projectile.
+    std::vector<int> damages; ///< The damage of each projectile.
+    std::vector<std::uint8_t> hostile; ///< 1 for each projectile fired by an enemy, which only hits the player.
+    std::vector<int> candidates; ///< Scratch buffer of the spatial queries.
+
+    /**
+     * @brief Removes a projectile, moving the last projectile into its place.
+     * @param index The index of the projectile.
+     */
+    void removeAt(std::size_t index);
+
+public:
+    /**
+     * @brief Constructs a ProjectilePool with the default capacity.
+     */
+    ProjectilePool() = default;
+
+    /**
+     * @brief Constructs a ProjectilePool with a specified capacity.
+     * @param capacity The maximum number of projectiles in flight.
+     * @throws std::invalid_argument If the capacity is 0.
+     */
+    explicit ProjectilePool(std::size_t capacity);
+
+    /**
+     * @brief Fires a projectile.
+     *
+     * The storage of the pool is allocated on the first projectile fired.
+     * @param ownerId The ID of the character firing the projectile.
+     * @param isHostile True if the projectile is fired by an enemy and only hits the player.
+     * @param position The starting position of the projectile.
+     * @param velocity The velocity of the projectile, in units per second.
+     * @param damage The damage of the projectile.
+     * @param lifetime The flight time of the projectile, in seconds.
+     * @return The ID of the projectile, -1 if the pool is full.
+     * @throws std::invalid_argument If the damage is negative or the lifetime is not strictly positive.
+     */
+    int spawn(int ownerId, bool isHostile, const Vector2D&position, const Vector2D&velocity, int damage, double lifetime);
+
+    /**
+     * @brief Moves every projectile and collides it, in one pass.
+     *
+     * A projectile stops at the first solid tile along its path, otherwise hits the first living
+     * character found within HIT_RADIUS of it: an enemy of the spatial index for a projectile of a
+     * player, a player for a projectile of an enemy. Spent projectiles are removed.
+     * @param elapsedSeconds The duration of the tick.
+     * @param tiles The tile map of the level.
+     * @param enemies The spatial index of the enemies, at their feet.
+     * @param isAlive Checks if an enemy of the spatial index can be hit.
+     * @param playerIds The IDs of the players that can be hit.
+     * @param playerPositions The position of the feet of each of these players.
+     * @param hits Receives the hits of the tick; appended to.
+     */
+    void step(double elapsedSeconds, const TileMap&tiles, const SpatialGrid&enemies,
+              const std::function<bool(int)>&isAlive, std::span<const int> playerIds,
+              std::span<const Vector2D> playerPositions, std::vector<DamageHit>&hits);
+
+    /**
+     * @brief Retrieves the number of projectiles in flight.
+     * @return The number of projectiles.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Retrieves the maximum number of projectiles in flight.
+     * @return The capacity of the pool.
+     */
+    [[nodiscard]] std::size_t getCapacity() const;
+
+    /**
+     * @brief Retrieves the IDs of the projectiles in flight.
+     * @return One ID per projectile, in the order of the other arrays.
+     */
+    [[nodiscard]] std::span<const int> getIds() const;
+
+    /**
+     * @brief Retrieves the horizontal positions of the projectiles in flight.
+     * @return One position per projectile.
+     */
+    [[nodiscard]] std::span<const double> getPositionsX() const;
+
+    /**
+     * @brief Retrieves the vertical positions of the projectiles in flight.
+     * @return One position per projectile.
+     */
+    [[nodiscard]] std::span<const double> getPositionsY() const;
+
+    /**
+     * @brief Retrieves the horizontal velocities of the projectiles in flight.
+     * @return One velocity per projectile.
+     */
+    [[nodiscard]] std::span<const double> getVelocitiesX() const;
+
+    /**
+     * @brief Retrieves the vertical velocities of the projectiles in flight.
+     * @return One velocity per projectile.
+     */
+    [[nodiscard]] std::span<const double> getVelocitiesY() const;
+
+    /**
+     * @brief Removes every projectile, keeping the storage.
+     */
+    void clear();
+};
+#endif //PROJECTILEPOOL_HPP
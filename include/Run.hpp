@@ -20,6 +20,8 @@
  * to run with a specified force.
  */
 class Run : public Movement {
+    friend class Snapshot;
+
     int running = false; ///< Flag indicating if the character is currently running.
 public:
     /**
@@ -41,9 +43,10 @@ public:
 
     /**
      * @brief Returns the current running state.
+     * @param now Unused, running lasts until stopped.
      * @return true if the character is running, false otherwise.
      */
-    bool isUsing() const override;
+    bool isUsing(std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now()) const override;
 
     /**
      * @brief Returns true if the movement is available.
@@ -51,6 +54,12 @@ public:
      * @return true.
      */
     bool canUse() const override;
+
+    /**
+     * @brief Copies the run, whether the character runs included with its state.
+     * @return The copy, owned by nobody else.
+     */
+    [[nodiscard]] std::shared_ptr<Movement> clone() const override;
 };
 
 #endif //RUN_HPP
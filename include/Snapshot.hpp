@@ -0,0 +1,404 @@
+/**
+ * @file Snapshot.hpp
+ * @brief Defines the binary snapshot format of a Game and the Snapshot class saving and loading it.
+ *
+ * A snapshot is a flat, pointer-free image of the persistent state of a game: a fixed header
+ * followed by one section per kind of record, each section an array of fixed-size records aligned
+ * on 8 bytes. The records only hold integers, doubles and indices into the other sections, so a
+ * mapped file is read in place: loading validates the header and the bounds of the sections without
+ * copying nor decoding them. Rebuilding the game from the records is the bulk of a load, and costs
+ * an order of magnitude more than a save: every character is constructed again with its
+ * capabilities, modifiers and items, every area with its spawn points and chests, and the level
+ * indexes its enemies anew. A GameState restored with restore is the cheap way to rewind a game
+ * within a process.
+ *
+ * Times are stored in nanoseconds relative to the time of the save, since the steady clock of
+ * another process has another origin; they are rebased on the time of the load. The records are
+ * stored in the byte order of the machine that saved them, and a snapshot of another byte order is
+ * rejected.
+ *
+ * The snapshot holds the players, the active level with its areas, spawn points, chests and
+ * enemies, the capabilities, modifiers and items of every character, the status effects and the
+ * script each enemy runs. The threat table, the projectiles in flight and the deaths not drained yet
+ * are not saved and start afresh. The pending timer events are scheduled again on load from the times
+ * of the capabilities and hurt animations still running, and the scripts restart from their beginning.
+ *
+ * Snapshot also takes and restores the in-memory GameState of a game, the cheap counterpart of a
+ * snapshot used to rewind it within the same process.
+ */
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+class Character;
+class Enemy;
+class Game;
+class Level;
+struct CharacterFrame;
+struct GameState;
+
+/**
+ * @enum SnapshotSections
+ * @brief The sections of a snapshot, in the order of the section table of its header.
+ */
+enum SnapshotSections {
+    GAME_SECTION, ///< One SnapshotGame.
+    AREA_SECTION, ///< The areas of the active level (SnapshotArea), column by column.
+    SPAWN_SECTION, ///< The spawn points of the areas (SnapshotSpawn).
+    CHEST_SECTION, ///< The chests of the areas (SnapshotChest).
+    CHARACTER_SECTION, ///< The players, then the enemies of the active level (SnapshotCharacter).
+    ATTACK_SECTION, ///< The attacks of the characters (SnapshotAttack).
+    MOVEMENT_SECTION, ///< The movements of the characters (SnapshotMovement).
+    MODIFIER_SECTION, ///< The modifiers of the characters (SnapshotModifier).
+    ITEM_SECTION, ///< The items of the characters (SnapshotItem).
+    STATUS_EFFECT_SECTION, ///< The status effects of the characters (SnapshotStatusEffect).
+    SNAPSHOT_SECTION_COUNT ///< Number of sections.
+};
+
+/**
+ * @struct SnapshotSection
+ * @brief Location of a section within a snapshot.
+ */
+struct SnapshotSection {
+    std::uint64_t offset; ///< Offset of the first record from the start of the snapshot, a multiple of 8.
+    std::uint32_t count; ///< Number of records.
+    std::uint32_t recordSize; ///< Size of a record, checked against the one of this version.
+};
+
+/**
+ * @struct SnapshotHeader
+ * @brief First bytes of a snapshot.
+ */
+struct SnapshotHeader {
+    char magic[4]; ///< SNAPSHOT_MAGIC.
+    std::uint32_t version; ///< SNAPSHOT_VERSION of the format.
+    std::uint32_t byteOrder; ///< SNAPSHOT_BYTE_ORDER, as written by the machine that saved it.
+    std::uint32_t headerSize; ///< Size of the header.
+    std::uint64_t totalSize; ///< Size of the whole snapshot.
+    SnapshotSection sections[SNAPSHOT_SECTION_COUNT]; ///< The sections, indexed by SnapshotSections.
+};
+
+/**
+ * @struct SnapshotGame
+ * @brief The state of the game itself.
+ */
+struct SnapshotGame {
+    double difficulty; ///< Difficulty coefficient.
+    std::int64_t difficultyUpdate; ///< Time of the last difficulty update.
+    std::int32_t nextCharacterId; ///< ID the next character will take.
+    std::int32_t level; ///< ID of the active level.
+    std::int32_t levelLength; ///< Number of areas along the x axis of the active level.
+    std::int32_t levelHeight; ///< Number of areas along the y axis of the active level.
+    std::int32_t playerCount; ///< Number of players, the first records of the character section.
+    std::int32_t activationRadius; ///< Gateways around the players within which enemies are simulated.
+    std::uint8_t over; ///< 1 if the game is over.
+    std::uint8_t deferredDamage; ///< 1 if the hits are resolved once per physics step.
+    std::uint8_t enemyAI; ///< 1 if the AI pass runs at each physics step.
+    std::uint8_t padding[5]; ///< Zero.
+};
+
+/**
+ * @struct SnapshotArea
+ * @brief An area of the active level.
+ */
+struct SnapshotArea {
+    std::int32_t type; ///< Type of the area.
+    std::int32_t id; ///< Identifier of the area among those of its type.
+    std::uint32_t gateways; ///< One bit per gateway: right, down, left then up.
+    std::uint32_t firstSpawn; ///< Index of its first spawn point in the spawn section.
+    std::uint32_t spawnCount; ///< Number of its spawn points.
+    std::uint32_t firstChest; ///< Index of its first chest in the chest section.
+    std::uint32_t chestCount; ///< Number of its chests.
+    std::uint32_t padding; ///< Zero.
+};
+
+/**
+ * @struct SnapshotSpawn
+ * @brief A spawn point of an area.
+ */
+struct SnapshotSpawn {
+    std::int64_t lastSpawned; ///< Time of its last spawn.
+    double cooldown; ///< Cooldown between two spawns, in seconds.
+    std::int32_t id; ///< Identifier within its area.
+    std::uint8_t boss; ///< 1 if it can spawn bosses.
+    std::uint8_t padding[3]; ///< Zero.
+};
+
+/**
+ * @struct SnapshotChest
+ * @brief A chest of an area.
+ */
+struct SnapshotChest {
+    std::int32_t id; ///< Identifier within its area.
+    std::int32_t item; ///< The item it holds (Items).
+    std::uint8_t empty; ///< 1 if it was opened.
+    std::uint8_t padding[7]; ///< Zero.
+};
+
+/**
+ * @struct SnapshotCharacter
+ * @brief A player or an enemy.
+ */
+struct SnapshotCharacter {
+    double x; ///< Position along the x axis.
+    double y; ///< Position along the y axis.
+    double velocityX; ///< Velocity along the x axis.
+    double velocityY; ///< Velocity along the y axis.
+    double runInput; ///< Horizontal run input.
+    double baseRunForce; ///< Force of the RUN movement before the modifiers.
+    double followRange; ///< Follow range of an enemy.
+    double attackRange; ///< Attack range of an enemy.
+    double hurtTime; ///< Duration of the hurt animation.
+    double jetPackForce; ///< Force of the jetpack.
+    double jetPackMaxTime; ///< Maximum flight time of the jetpack.
+    double jetPackCooldown; ///< Cooldown of the jetpack.
+    double jetPackLanding; ///< Landing animation time of the jetpack.
+    std::int64_t hurtStart; ///< Time the hurt animation last started.
+    std::int64_t jetPackStart; ///< Time the jetpack was last activated.
+    std::int32_t id; ///< ID of the character.
+    std::int32_t type; ///< SNAPSHOT_PLAYER, or the type of the enemy (Enemies).
+    std::int32_t health; ///< Current health.
+    std::int32_t baseMaxHealth; ///< Maximum health before the modifiers.
+    std::int32_t baseJumpCount; ///< Number of consecutive jumps before the modifiers.
+    std::int32_t facing; ///< 1 if it faces right, -1 if it faces left.
+    std::uint32_t firstAttack; ///< Index of its first attack in the attack section.
+    std::uint32_t attackCount; ///< Number of its attacks.
+    std::uint32_t firstMovement; ///< Index of its first movement in the movement section.
+    std::uint32_t movementCount; ///< Number of its movements.
+    std::uint32_t firstModifier; ///< Index of its first modifier in the modifier section.
+    std::uint32_t modifierCount; ///< Number of its modifiers.
+    std::uint32_t firstItem; ///< Index of its first item in the item section.
+    std::uint32_t itemCount; ///< Number of its items.
+    std::uint8_t onGround; ///< 1 if it stands on the ground.
+    std::uint8_t boss; ///< 1 if the enemy is a boss.
+    std::uint8_t jetPackInUse; ///< 1 if the jetpack is in use.
+    std::uint8_t behaviour; ///< 1 + the script an enemy runs (Behaviours), 0 if it runs none.
+    std::uint8_t padding[4]; ///< Zero.
+};
+
+/**
+ * @struct SnapshotAttack
+ * @brief An attack of a character.
+ */
+struct SnapshotAttack {
+    std::int64_t lastUsage; ///< Time of its last usage.
+    std::int64_t charged; ///< Time the charge of the last usage ends.
+    std::int64_t recovery; ///< Time the active part of the last usage ends.
+    std::int64_t end; ///< Time the animation of the last usage ends.
+    std::int64_t ready; ///< Time the cooldown of the last usage elapses.
+    double cooldown; ///< Cooldown, in seconds.
+    double chargeTime; ///< Charge time, in seconds.
+    double animationTime; ///< Animation time, in seconds.
+    std::int32_t attack; ///< The attack (Attacks).
+    std::int32_t baseDamage; ///< Damage before the modifiers.
+};
+
+/**
+ * @struct SnapshotMovement
+ * @brief A movement of a character.
+ */
+struct SnapshotMovement {
+    std::int64_t lastUsage; ///< Time of its last usage.
+    double force; ///< Force.
+    double animationTime; ///< Animation time, in seconds.
+    double cooldown; ///< Cooldown, in seconds.
+    std::int32_t movement; ///< The movement (Movements).
+    std::int32_t maxUsage; ///< Maximum number of consecutive jumps of a JUMP.
+    std::int32_t state; ///< Jumps done by a JUMP, or 1 if a RUN or a CLIMB is in use.
+    std::uint32_t padding; ///< Zero.
+};
+
+/**
+ * @struct SnapshotModifier
+ * @brief A modifier of a character.
+ */
+struct SnapshotModifier {
+    std::int64_t expiresAt; ///< Time it expires.
+    double added; ///< Added to the base value of the stat.
+    double multiplier; ///< Multiplies the base value of the stat, plus the added terms.
+    std::int32_t stat; ///< The stat (Stats).
+    std::int32_t source; ///< Where it comes from (ModifierSources).
+};
+
+/**
+ * @struct SnapshotItem
+ * @brief Items of a kind held by a character.
+ */
+struct SnapshotItem {
+    std::int32_t item; ///< The item (Items).
+    std::int32_t count; ///< Number of items held.
+};
+
+/**
+ * @struct SnapshotStatusEffect
+ * @brief A status effect of a character.
+ */
+struct SnapshotStatusEffect {
+    std::int64_t expiresAt; ///< Time it ends.
+    double magnitude; ///< Strength.
+    std::int32_t characterId; ///< ID of the character.
+    std::int32_t type; ///< Type (StatusEffectTypes).
+};
+
+/**
+ * @class Snapshot
+ * @brief Saves a Game to a snapshot and restores it from one.
+ */
+class Snapshot {
+public:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    static constexpr char SNAPSHOT_MAGIC[4] = {'R', 'O', 'R', 'S'}; ///< First bytes of a snapshot.
+    static constexpr std::uint32_t SNAPSHOT_VERSION = 1; ///< Version of the format written.
+    static constexpr std::uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304; ///< Written in the byte order of the machine.
+    static constexpr std::int32_t SNAPSHOT_PLAYER = -1; ///< Type of the character records of the players.
+    static constexpr std::int64_t NEVER = INT64_MIN; ///< Stored time of a capability never used.
+    static constexpr std::int64_t FOREVER = INT64_MAX; ///< Stored time of what never expires.
+
+private:
+    struct Records; ///< The records of a snapshot being saved.
+    struct Sections; ///< The records of a snapshot being loaded, in place.
+
+    /**
+     * @brief Appends the records of a character.
+     * @param character The character.
+     * @param enemy The character as an enemy, nullptr for a player.
+     * @param records The records.
+     * @param now The time of the save.
+     */
+    static void saveCharacter(const Character&character, const Enemy* enemy, Records&records, TimePoint now);
+
+    /**
+     * @brief Appends the records of the areas and the enemies of a level.
+     * @param level The level.
+     * @param records The records.
+     * @param now The time of the save.
+     */
+    static void saveLevel(const Level&level, Records&records, TimePoint now);
+
+    /**
+     * @brief Schedules the timer events of the states of a character still running at a time.
+     * @param game The game owning the timers.
+     * @param character The character.
+     * @param now The time, before which the states expired and their events were drained.
+     */
+    static void scheduleTimers(Game&game, const Character&character, TimePoint now);
+
+    /**
+     * @brief Checks the header, the sections and the indices of a snapshot.
+     * @param bytes The snapshot.
+     * @return The sections.
+     * @throws std::invalid_argument If the snapshot is invalid.
+     */
+    static Sections validate(std::span<const std::byte> bytes);
+
+    /**
+     * @brief Restores the state of a character, its ID, capabilities, modifiers and items included.
+     * @param character The character, freshly constructed.
+     * @param record The record of the character.
+     * @param sections The sections of the snapshot.
+     * @param now The time of the load.
+     */
+    static void loadCharacter(Character&character, const SnapshotCharacter&record, const Sections&sections,
+                              TimePoint now);
+
+    /**
+     * @brief Rebuilds the active level, its areas and its enemies.
+     * @param state The state of the game.
+     * @param sections The sections of the snapshot.
+     * @param now The time of the load.
+     * @return The loaded level.
+     */
+    static Level loadLevel(const SnapshotGame&state, const Sections&sections, TimePoint now);
+
+    /**
+     * @brief Appends the frames of a character to a state.
+     * @param character The character.
+     * @param state The state.
+     */
+    static void captureCharacter(const Character&character, GameState&state);
+
+    /**
+     * @brief Checks that a state was taken by a game, on its active level and with the same players.
+     * @param game The game.
+     * @param state The state.
+     * @return True if the game can be restored to the state, otherwise false.
+     */
+    static bool matches(const Game&game, const GameState&state);
+
+    /**
+     * @brief Restores the frames of a character, which has the capabilities it had when they were taken.
+     * @param character The character.
+     * @param frame The frame of the character.
+     * @param state The state holding the frames of its capabilities, modifiers and items.
+     * @return True if the times of its capabilities or of its hurt animation changed, otherwise false.
+     */
+    static bool restoreCharacter(Character&character, const CharacterFrame&frame, const GameState&state);
+
+public:
+    /**
+     * @brief Saves a game to a snapshot in memory.
+     * @param game The game.
+     * @param bytes Receives the snapshot, overwritten.
+     * @param now The time of the save, to which the times are relative.
+     */
+    static void save(const Game&game, std::vector<std::byte>&bytes, TimePoint now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Saves a game to a snapshot file, replacing the file only once the snapshot is fully written.
+     * @param game The game.
+     * @param path The path of the file.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    static void save(const Game&game, const std::string&path);
+
+    /**
+     * @brief Restores a game from a snapshot in memory.
+     *
+     * The game is left untouched if the snapshot is invalid.
+     * @param game The game, whose state is replaced.
+     * @param bytes The snapshot.
+     * @param now The time of the load, on which the times are rebased.
+     * @throws std::invalid_argument If the snapshot is truncated, of another version or byte order, or inconsistent.
+     */
+    static void load(Game&game, std::span<const std::byte> bytes, TimePoint now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Restores a game from a snapshot file, mapped in memory rather than read.
+     *
+     * The game is left untouched if the snapshot is invalid.
+     * @param game The game, whose state is replaced.
+     * @param path The path of the file.
+     * @throws std::runtime_error If the file cannot be opened or mapped.
+     * @throws std::invalid_argument If the snapshot is truncated, of another version or byte order, or inconsistent.
+     */
+    static void load(Game&game, const std::string&path);
+
+    /**
+     * @brief Takes the state of a game on its active level, reusing the capacity of the state.
+     * @param game The game.
+     * @param state Receives the state, overwritten.
+     */
+    static void capture(const Game&game, GameState&state);
+
+    /**
+     * @brief Rewinds a game to a state it took on its active level.
+     *
+     * The enemies spawned since are removed, with their scripted behaviours. The deaths not drained
+     * yet are rewound, and the timer events are scheduled again from the restored times. The other
+     * enemies run the scripts they ran, those still running keeping their progress. The counter of
+     * the character IDs is not rewound: the enemies spawned again take new IDs, never those of the
+     * removed ones.
+     * @param game The game.
+     * @param state The state.
+     * @return True if the game is restored, otherwise false if the state was taken on another level,
+     * with other players or by another game, the game being left untouched.
+     */
+    static bool restore(Game&game, const GameState&state);
+};
+#endif //SNAPSHOT_HPP
@@ -0,0 +1,113 @@
+/**
+ * @file SpatialGrid.hpp
+ * @brief Defines the SpatialGrid class, a uniform-grid spatial hash of character positions.
+ *
+ * Positions are bucketed in square cells so that a range query only visits the cells overlapping
+ * the query circle instead of every character of the level.
+ */
+#ifndef SPATIALGRID_HPP
+#define SPATIALGRID_HPP
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Vector2D.hpp"
+
+/**
+ * @class SpatialGrid
+ * @brief Uniform spatial hash mapping world cells to the IDs of the characters they contain.
+ */
+class SpatialGrid {
+    /**
+     * @struct Entry
+     * @brief The indexed position of a character and the cell holding it.
+     */
+    struct Entry {
+        std::int64_t cell; ///< Key of the cell holding the character.
+        Vector2D position; ///< Indexed position of the character.
+    };
+
+    double cellSize; ///< Side length of a cell, in world units.
+    std::unordered_map<std::int64_t, std::vector<int>> cells; ///< Character IDs per non-empty cell.
+    std::unordered_map<int, Entry> entries; ///< Indexed entry per character ID.
+
+    /**
+     * @brief Computes the cell coordinate holding a world coordinate.
+     *
+     * @param coordinate The world coordinate.
+     * @return The cell coordinate, clamped by floorToCell.
+     */
+    [[nodiscard]] int toCell(double coordinate) const;
+
+    /**
+     * @brief Packs two cell coordinates into a single key.
+     * @param cellX The cell x-coordinate.
+     * @param cellY The cell y-coordinate.
+     * @return The cell key.
+     */
+    static std::int64_t key(int cellX, int cellY);
+
+    /**
+     * @brief Removes an ID from the bucket of a cell.
+     * @param cell The cell key.
+     * @param id The ID to remove.
+     */
+    void removeFromCell(std::int64_t cell, int id);
+
+public:
+    static constexpr double DEF_CELL_SIZE = 16.0; ///< Default cell size, close to the largest follow range.
+
+    /**
+     * @brief Constructs a SpatialGrid with the default cell size.
+     */
+    SpatialGrid();
+
+    /**
+     * @brief Constructs a SpatialGrid with a specified cell size.
+     * @param cellSize The side length of a cell, in world units.
+     * @throws std::invalid_argument If the cell size is not strictly positive.
+     */
+    explicit SpatialGrid(double cellSize);
+
+    /**
+     * @brief Indexes a character, or moves it if it is already indexed.
+     * @param id The ID of the character.
+     * @param position The position of the character.
+     */
+    void update(int id, const Vector2D&position);
+
+    /**
+     * @brief Removes a character from the index.
+     * @param id The ID of the character.
+     */
+    void remove(int id);
+
+    /**
+     * @brief Checks if a character is indexed.
+     * @param id The ID of the character.
+     * @return True if the character is indexed, otherwise false.
+     */
+    [[nodiscard]] bool contains(int id) const;
+
+    /**
+     * @brief Appends the IDs of the characters within a radius of a point.
+     *
+     * A query covering more cells than there are characters checks every character instead. A
+     * center that is not finite, or a radius that is negative or NaN, finds nothing.
+     * @param center The center of the query circle.
+     * @param radius The radius of the query circle.
+     * @param result The vector receiving the IDs; it is not cleared.
+     */
+    void queryRadius(const Vector2D&center, double radius, std::vector<int>&result) const;
+
+    /**
+     * @brief Retrieves the number of indexed characters.
+     * @return The number of characters.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Removes every character from the index.
+     */
+    void clear();
+};
+#endif //SPATIALGRID_HPP
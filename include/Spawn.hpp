@@ -14,6 +14,8 @@
  * utility methods for spawn management.
  */
 class Spawn {
+    friend class Snapshot;
+
     int id; ///< The unique identifier for the spawn point.
     std::chrono::time_point<std::chrono::steady_clock> lastTimeSpawned; ///< The last time an enemy was spawned.
     double spawnCoolDown; ///< The cooldown duration between spawns.
@@ -38,11 +40,24 @@ public:
      */
     std::chrono::time_point<std::chrono::steady_clock> getLastTimeSpawned() const;
 
+    /**
+     * @brief Retrieves the cooldown duration between two spawns.
+     * @return The cooldown in seconds.
+     */
+    double getSpawnCoolDown() const;
+
+    /**
+     * @brief Retrieves the time at which the spawn point will be ready again.
+     * @return The ready time, or the clock epoch if nothing has been spawned yet.
+     */
+    std::chrono::time_point<std::chrono::steady_clock> getNextSpawnTime() const;
+
     /**
      * @Brief Checks if the spawn point is ready to spawn an enemy.
-     * @return True if the cooldown has passed or no enemy has been spawned yet, false otherwise.
+     * @param now The current time.
+     * @return True if now is at or after getNextSpawnTime(), false otherwise.
      */
-    bool canSpawn() const;
+    bool canSpawn(std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now()) const;
 
     /**
      * @brief Checks if the spawn point can spawn a boss.
@@ -58,8 +73,9 @@ public:
 
     /**
      * @brief Spawns an enemy at the spawn point and updates the last spawn time.
+     * @param now The current time, recorded as the last spawn time.
      * @throws std::runtime_error if the spawn point is not ready to spawn.
      */
-    void spawn();
+    void spawn(std::chrono::time_point<std::chrono::steady_clock> now = std::chrono::steady_clock::now());
 };
 #endif //SPAWN_HPP
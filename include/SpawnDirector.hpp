@@ -0,0 +1,80 @@
+/**
+ * @file SpawnDirector.hpp
+ * @brief Defines the SpawnDirector class, deciding when and where enemies are spawned.
+ *
+ * The director accrues spawn credits over time, scaled by the game difficulty, and spends them
+ * on waves of enemies at the spawn points of the level that are ready. The number of enemies
+ * spawned in a single update is bounded by a hard budget.
+ */
+#ifndef SPAWNDIRECTOR_HPP
+#define SPAWNDIRECTOR_HPP
+#include <chrono>
+#include <vector>
+#include "Level.hpp"
+
+/**
+ * @class SpawnDirector
+ * @brief Spends spawn credits accrued from difficulty and elapsed time on waves of enemies.
+ */
+class SpawnDirector {
+    double credits = 0.0; ///< Spawn credits available.
+    double creditsPerSecond; ///< Credits accrued per second at difficulty 1.0.
+    int waveSize; ///< Minimum number of enemies bought at once.
+    int maxSpawnsPerTick; ///< Hard limit of enemies spawned by a single update.
+    std::chrono::time_point<std::chrono::steady_clock> lastUpdate; ///< Time of the previous update.
+
+public:
+    static constexpr double DEF_CREDITS_PER_SECOND = 0.5; ///< Default credits accrued per second.
+    static constexpr int DEF_WAVE_SIZE = 3; ///< Default minimum size of a wave.
+    static constexpr int DEF_MAX_SPAWNS_PER_TICK = 8; ///< Default hard limit of spawns per update.
+    static constexpr double ENEMY_COST = 1.0; ///< Credits spent per spawned enemy.
+    static constexpr double MAX_CREDITS = 64.0; ///< Credits stop accruing beyond this amount.
+    static constexpr std::size_t RESERVED_ENEMIES = 256; ///< Enemy storage reserved ahead of the waves.
+
+    /**
+     * @brief Constructs a SpawnDirector with default settings.
+     */
+    SpawnDirector();
+
+    /**
+     * @brief Constructs a SpawnDirector with specified settings.
+     * @param creditsPerSecond The credits accrued per second at difficulty 1.0.
+     * @param waveSize The minimum number of enemies bought at once.
+     * @param maxSpawnsPerTick The hard limit of enemies spawned by a single update.
+     * @throws std::invalid_argument If a setting is not strictly positive.
+     */
+    SpawnDirector(double creditsPerSecond, int waveSize, int maxSpawnsPerTick);
+
+    /**
+     * @brief Accrues credits for the time elapsed since the previous update and spends them on a wave.
+     *
+     * A wave is only bought once the credits cover waveSize enemies; it is then spawned, up to
+     * the budget, at the spawn points of the level that are ready. The first update only starts
+     * the clock.
+     * @param level The level to spawn the enemies in.
+     * @param now The current time.
+     * @param difficulty The difficulty coefficient of the game.
+     * @param budget The maximum number of enemies to spawn, itself capped by maxSpawnsPerTick.
+     * @return The IDs of the spawned enemies.
+     */
+    std::vector<int> update(Level&level, std::chrono::time_point<std::chrono::steady_clock> now, double difficulty,
+                            int budget);
+
+    /**
+     * @brief Retrieves the spawn credits available.
+     * @return The credits.
+     */
+    [[nodiscard]] double getCredits() const;
+
+    /**
+     * @brief Retrieves the hard limit of enemies spawned by a single update.
+     * @return The spawn budget per update.
+     */
+    [[nodiscard]] int getMaxSpawnsPerTick() const;
+
+    /**
+     * @brief Resets the credits and the clock, typically when the level changes.
+     */
+    void reset();
+};
+#endif //SPAWNDIRECTOR_HPP
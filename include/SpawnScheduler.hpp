@@ -0,0 +1,109 @@
+/**
+ * @file SpawnScheduler.hpp
+ * @brief Defines the SpawnScheduler class, an event-driven queue of the spawn points of a level.
+ *
+ * Instead of polling every spawn point every frame, the level keeps its spawn points in a
+ * min-heap keyed by the time at which their cooldown elapses. Only the spawn points that
+ * actually became ready are popped, so the cost scales with the number of spawns.
+ */
+#ifndef SPAWNSCHEDULER_HPP
+#define SPAWNSCHEDULER_HPP
+#include <chrono>
+#include <functional>
+#include <vector>
+
+/**
+ * @struct SpawnEvent
+ * @brief Identifies a spawn point of a level that became ready to spawn.
+ */
+struct SpawnEvent {
+    int areaX; ///< The x-coordinate of the area holding the spawn point.
+    int areaY; ///< The y-coordinate of the area holding the spawn point.
+    int spawnId; ///< The ID of the spawn point within its area.
+};
+
+/**
+ * @class SpawnScheduler
+ * @brief Min-heap of spawn points ordered by the time they become ready.
+ *
+ * The scheduler does not own the spawn points: entries may become stale when a spawn point
+ * is used outside of the scheduler, so the owner validates every popped entry and compacts the
+ * heap once stale entries pile up.
+ */
+class SpawnScheduler {
+public:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the spawn points.
+
+    /**
+     * @struct Entry
+     * @brief A scheduled spawn point with its ready time.
+     */
+    struct Entry {
+        TimePoint readyAt; ///< The time at which the spawn point is expected to be ready.
+        SpawnEvent spawn; ///< The spawn point.
+
+        /**
+         * @brief Orders entries by ready time, used to build the min-heap.
+         * @param rhs The other entry.
+         * @return True if this entry is ready later than the other one.
+         */
+        bool operator>(const Entry&rhs) const {
+            return readyAt > rhs.readyAt;
+        }
+    };
+
+private:
+    std::vector<Entry> heap; ///< Spawn points by ready time, as a min-heap.
+
+public:
+    /**
+     * @brief Schedules a spawn point.
+     * @param spawn The spawn point to schedule.
+     * @param readyAt The time at which the spawn point becomes ready.
+     */
+    void schedule(const SpawnEvent&spawn, TimePoint readyAt);
+
+    /**
+     * @brief Checks if the earliest scheduled spawn point is ready.
+     * @param now The current time.
+     * @return True if an entry is ready at the given time, otherwise false.
+     */
+    [[nodiscard]] bool hasReady(TimePoint now) const;
+
+    /**
+     * @brief Removes and returns the earliest scheduled spawn point.
+     * @return The earliest entry.
+     * @throws std::runtime_error If the scheduler is empty.
+     */
+    Entry pop();
+
+    /**
+     * @brief Retrieves the ready time of the earliest scheduled spawn point.
+     * @return The earliest ready time, or TimePoint::max() if the scheduler is empty.
+     */
+    [[nodiscard]] TimePoint nextReadyTime() const;
+
+    /**
+     * @brief Retrieves the number of scheduled entries, stale ones included.
+     * @return The number of entries.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Checks if nothing is scheduled.
+     * @return True if the scheduler is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Removes the stale entries and rebuilds the heap.
+     * @param isLive Tells whether an entry is still valid; the others are removed.
+     */
+    void compact(const std::function<bool(const Entry&)>&isLive);
+
+    /**
+     * @brief Removes every scheduled entry.
+     */
+    void clear();
+};
+#endif //SPAWNSCHEDULER_HPP
@@ -0,0 +1,150 @@
+/**
+ * @file StatusEffectPool.hpp
+ * @brief Defines the StatusEffectPool class, the status effects of every character of a level.
+ *
+ * A status effect is a temporary state of a character: damage over time, a slow or a buff. Instead
+ * of an object per character, the effects of every character live in one dense array, so that a
+ * single contiguous pass per frame deals the damage over time and removes the expired effects,
+ * whatever the number of characters. A character has at most one effect of each type: applying an
+ * effect it already has refreshes it. The pass is skipped until the next effect falls due.
+ *
+ * The pool does not own the characters: it reports the damage to deal, and the stat effects are
+ * applied by the owner as modifiers expiring with them.
+ */
+#ifndef STATUSEFFECTPOOL_HPP
+#define STATUSEFFECTPOOL_HPP
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "ModifierStack.hpp"
+
+/**
+ * @enum StatusEffectTypes
+ * @brief Enumerates the status effects.
+ */
+enum StatusEffectTypes {
+    BURN, ///< Damage over time; the magnitude is the damage dealt every StatusEffectPool::TICK_INTERVAL.
+    SLOW, ///< Slower run; the magnitude multiplies the RUN force.
+    STRENGTH ///< Stronger attacks; the magnitude multiplies the damage of every attack.
+};
+
+/**
+ * @struct StatusEffect
+ * @brief A status effect applied to a character.
+ */
+struct StatusEffect {
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    int characterId; ///< The ID of the character.
+    StatusEffectTypes type; ///< The type of the effect.
+    double magnitude; ///< The strength of the effect, as defined by its type.
+    TimePoint expiresAt; ///< The time the effect ends.
+    TimePoint nextTick; ///< The time of the next damage of a BURN.
+};
+
+/**
+ * @struct StatusTick
+ * @brief The damage over time dealt to a character by a pass of the pool.
+ */
+struct StatusTick {
+    int characterId; ///< The ID of the character.
+    int damage; ///< The damage dealt.
+};
+
+/**
+ * @class StatusEffectPool
+ * @brief Dense array of the status effects of the characters of a level.
+ */
+class StatusEffectPool {
+public:
+    using TimePoint = StatusEffect::TimePoint; ///< Clock used by the capabilities.
+
+    static constexpr auto TICK_INTERVAL = std::chrono::milliseconds(500); ///< Interval between two damages of a BURN.
+
+private:
+    std::vector<StatusEffect> effects; ///< Every active effect, in no particular order.
+    std::unordered_map<std::uint64_t, std::uint32_t> lookup; ///< Index of the effect of each character and type.
+    TimePoint nextEvent = TimePoint::max(); ///< The earliest damage or expiry of the effects.
+
+    /**
+     * @brief Computes the key of the effect of a character in the lookup.
+     * @param characterId The ID of the character.
+     * @param type The type of the effect.
+     * @return The key.
+     */
+    static std::uint64_t keyOf(int characterId, StatusEffectTypes type);
+
+    /**
+     * @brief Removes an effect, moving the last effect into its place.
+     * @param index The index of the effect.
+     */
+    void removeAt(std::size_t index);
+
+public:
+    /**
+     * @brief Applies an effect to a character, or refreshes the effect of the same type it already has.
+     *
+     * A refreshed effect lasts until the latest of both expiries; a refreshed BURN keeps the larger
+     * magnitude, while a stat effect keeps its magnitude, matching the modifier already applied.
+     * @param characterId The ID of the character.
+     * @param type The type of the effect.
+     * @param magnitude The strength of the effect.
+     * @param now The current time.
+     * @param expiresAt The time the effect ends.
+     * @return True if the effect is new, false if it was refreshed.
+     * @throws std::invalid_argument If the magnitude is negative or the effect ends before now.
+     */
+    bool apply(int characterId, StatusEffectTypes type, double magnitude, TimePoint now, TimePoint expiresAt);
+
+    /**
+     * @brief Deals the damage over time due by now and removes the expired effects, in one pass.
+     *
+     * A BURN deals every tick due before it expires, even if the pass runs late.
+     * @param now The current time.
+     * @param ticks Receives the damage dealt, one entry per BURN that dealt damage; cleared first.
+     */
+    void tick(TimePoint now, std::vector<StatusTick>&ticks);
+
+    /**
+     * @brief Retrieves the effect of a type on a character.
+     * @param characterId The ID of the character.
+     * @param type The type of the effect.
+     * @return The effect, or nullptr if the character does not have it.
+     */
+    [[nodiscard]] const StatusEffect* find(int characterId, StatusEffectTypes type) const;
+
+    /**
+     * @brief Retrieves every active effect.
+     * @return The effects, in no particular order.
+     */
+    [[nodiscard]] const std::vector<StatusEffect>& getEffects() const;
+
+    /**
+     * @brief Retrieves the number of active effects.
+     * @return The number of effects.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Removes the effects of every character but some, when the others leave the level.
+     * @param characterIds The IDs of the characters whose effects are kept, typically the players.
+     */
+    void retainOnly(std::span<const int> characterIds);
+
+    /**
+     * @brief Removes the effects of a character, when it leaves the game.
+     * @param characterId The ID of the character.
+     */
+    void removeCharacter(int characterId);
+
+    /**
+     * @brief Creates the modifier a stat effect applies to its character.
+     * @param effect The effect.
+     * @return The modifier, expiring with the effect.
+     * @throws std::invalid_argument If the effect does not change a stat.
+     */
+    static Modifier modifierOf(const StatusEffect&effect);
+};
+#endif //STATUSEFFECTPOOL_HPP
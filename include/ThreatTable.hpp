@@ -0,0 +1,181 @@
+/**
+ * @file ThreatTable.hpp
+ * @brief Defines the ThreatTable class, the threat each player holds on each enemy, deciding whom the enemies target.
+ *
+ * Every enemy keeps a fixed row of threats, one slot per player: a player gains threat on an enemy
+ * by hurting it, by staying close to it, or at once by taunting it, and the enemy targets the player
+ * with the highest threat. The threats decay exponentially over game time, every one by the same
+ * factor, so the decay never changes which player leads a row: the leader is kept up to date as
+ * threat is added, and querying the target of an enemy is a lookup.
+ *
+ * Rather than scaling every row as time passes, the threats are stored multiplied by a growth factor
+ * that doubles every half-life: the threat added at a time is scaled up by the factor of that time,
+ * and a stored threat is scaled down by the current factor when read. Adding threat therefore only
+ * touches one slot, and the rows are rescaled all at once, rarely, before the factor grows too large.
+ */
+#ifndef THREATTABLE_HPP
+#define THREATTABLE_HPP
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "DamageBuffer.hpp"
+
+/**
+ * @class ThreatTable
+ * @brief Decaying threat of each player on each enemy of a level.
+ */
+class ThreatTable {
+public:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+
+    static constexpr std::size_t MAX_PLAYERS = 16; ///< Number of player slots of a row.
+    static constexpr double DEF_HALF_LIFE = 5.0; ///< Default time, in seconds, for a threat to halve.
+    static constexpr double MIN_THREAT = 1.0; ///< Threat below which a player is no longer targeted.
+    static constexpr double TAUNT_MARGIN = 100.0; ///< Threat a taunt puts its player ahead of the leader of the row.
+    static constexpr double PROXIMITY_RATE = 2.0; ///< Threat per second a player gains on an enemy engaging it.
+
+private:
+    /**
+     * @struct Row
+     * @brief The threats on an enemy.
+     */
+    struct Row {
+        std::array<float, MAX_PLAYERS> threats{}; ///< The threat of each player slot, scaled by the growth factor.
+        std::int8_t leader = -1; ///< The slot with the highest threat, -1 if no player has any.
+    };
+
+    static constexpr double REBASE_GROWTH = 0x1p64; ///< Growth factor beyond which the rows are rescaled.
+
+    double halfLife; ///< Time, in seconds, for a threat to halve.
+    std::vector<Row> rows; ///< The rows, dense.
+    std::vector<int> rowEnemies; ///< The ID of the enemy of each row.
+    std::unordered_map<int, std::size_t> rowOf; ///< Index of the row of each enemy, keyed by its ID.
+    std::array<int, MAX_PLAYERS> slotPlayers; ///< The ID of the player of each slot, -1 if free.
+    TimePoint origin; ///< The time at which the growth factor is 1.
+    double growth = 1.0; ///< The growth factor at the current time.
+
+    /**
+     * @brief Retrieves the slot of a player.
+     * @param playerId The ID of the player.
+     * @return The slot, or -1 if the player has none.
+     */
+    [[nodiscard]] int slotOf(int playerId) const;
+
+    /**
+     * @brief Retrieves the row of an enemy, creating it if needed.
+     * @param enemyId The ID of the enemy.
+     * @return The row.
+     */
+    Row& rowFor(int enemyId);
+
+    /**
+     * @brief Adds threat, already scaled by the growth factor, to a slot of a row.
+     * @param row The row.
+     * @param slot The slot.
+     * @param scaled The threat to add.
+     */
+    static void add(Row&row, int slot, float scaled);
+
+    /**
+     * @brief Elects the slot with the highest threat of a row.
+     * @param row The row.
+     */
+    static void elect(Row&row);
+
+public:
+    /**
+     * @brief Constructs an empty ThreatTable.
+     * @param halfLife Time, in seconds, for a threat to halve.
+     * @param now The current time.
+     * @throws std::invalid_argument If the half-life is not strictly positive.
+     */
+    explicit ThreatTable(double halfLife = DEF_HALF_LIFE, TimePoint now = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Moves the table to the current time, decaying every threat; called once per tick.
+     * @param now The current time, not before the previous one.
+     */
+    void advance(TimePoint now);
+
+    /**
+     * @brief Gives a slot to a player, so that it can gain threat.
+     * @param playerId The ID of the player.
+     * @return True if the player has a slot, otherwise false if every slot is taken.
+     */
+    bool addPlayer(int playerId);
+
+    /**
+     * @brief Frees the slot of a player, clearing its threat on every enemy.
+     * @param playerId The ID of the player.
+     */
+    void removePlayer(int playerId);
+
+    /**
+     * @brief Removes the row of an enemy, typically when it dies.
+     * @param enemyId The ID of the enemy.
+     */
+    void removeEnemy(int enemyId);
+
+    /**
+     * @brief Removes every row, keeping the players, typically when the level changes.
+     */
+    void clearEnemies();
+
+    /**
+     * @brief Adds threat of a player on an enemy.
+     * @param enemyId The ID of the enemy.
+     * @param playerId The ID of the player; ignored if it has no slot.
+     * @param threat The threat to add, at the current time.
+     */
+    void addThreat(int enemyId, int playerId, double threat);
+
+    /**
+     * @brief Adds the threat of the damage dealt in a tick, each player gaining as much threat as the damage it dealt.
+     *
+     * The damage of each result, after the modifiers of its target, is shared among the hits on that
+     * target in proportion of their damage. The hits whose attacker has no slot, those of the enemies,
+     * gain nothing, and the targets without a result, such as the dead ones, are skipped.
+     * @param hits The hits, grouped by target as resolved by the DamageBuffer.
+     * @param results The outcome of the hits on each target hurt, in the order of the groups of hits.
+     */
+    void addDamage(std::span<const DamageHit> hits, std::span<const DamageResult> results);
+
+    /**
+     * @brief Makes an enemy target a player, putting it TAUNT_MARGIN ahead of the leader of the row.
+     * @param enemyId The ID of the enemy.
+     * @param playerId The ID of the player; ignored if it has no slot.
+     */
+    void taunt(int enemyId, int playerId);
+
+    /**
+     * @brief Retrieves the threat of a player on an enemy at the current time.
+     * @param enemyId The ID of the enemy.
+     * @param playerId The ID of the player.
+     * @return The threat, 0 if there is none.
+     */
+    [[nodiscard]] double getThreat(int enemyId, int playerId) const;
+
+    /**
+     * @brief Retrieves the player an enemy targets, the one with the highest threat on it.
+     * @param enemyId The ID of the enemy.
+     * @return The ID of the player, or -1 if no player has at least MIN_THREAT on it.
+     */
+    [[nodiscard]] int getTarget(int enemyId) const;
+
+    /**
+     * @brief Retrieves the player each enemy of a batch targets.
+     * @param enemyIds The IDs of the enemies.
+     * @param targets Receives the ID of the player each enemy targets, -1 if none, in the order of the enemies.
+     */
+    void getTargets(std::span<const int> enemyIds, std::vector<int>&targets) const;
+
+    /**
+     * @brief Retrieves the number of enemies with a row.
+     * @return The number of rows.
+     */
+    [[nodiscard]] std::size_t size() const;
+};
+#endif //THREATTABLE_HPP
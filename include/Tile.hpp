@@ -1,14 +1,112 @@
 //
 // Created by Enzo Renard on 19/11/2024.
 //
-
+/**
+ * @file Tile.hpp
+ * @brief Defines the Tile class, a single cell of the interior of an area packed in 16 bits.
+ *
+ * Bit layout, from the least significant bit:
+ * - bit 0: solid, the tile blocks movement from every side;
+ * - bit 1: floor, the top of the tile can be stood on;
+ * - bits 2 to 7: texture ID;
+ * - bits 8 to 15: interactive object slot within the area, 0 when the tile holds no object.
+ */
 #ifndef TILE_HPP
 #define TILE_HPP
+#include <cstdint>
 #include "Texture.hpp"
 #include "InterractiveObject.hpp"
+
+/**
+ * @class Tile
+ * @brief Bit-packed tile holding collision flags, a texture and an interactive object slot.
+ */
 class Tile {
-  Texture texture;
-  bool isFloor;
-  InterractiveObject object;
+    std::uint16_t bits = 0; ///< The packed flags, texture and object slot.
+
+public:
+    static constexpr std::uint16_t SOLID_BIT = 1u << 0; ///< Flag of the solid tiles.
+    static constexpr std::uint16_t FLOOR_BIT = 1u << 1; ///< Flag of the tiles that can be stood on.
+    static constexpr int TEXTURE_SHIFT = 2; ///< Offset of the texture ID.
+    static constexpr std::uint16_t TEXTURE_MASK = 0x3F; ///< Mask of the texture ID, once shifted.
+    static constexpr int OBJECT_SHIFT = 8; ///< Offset of the object slot.
+    static constexpr std::uint16_t OBJECT_MASK = 0xFF; ///< Mask of the object slot, once shifted.
+    static constexpr int MAX_OBJECT_SLOT = OBJECT_MASK; ///< Highest object slot a tile can reference.
+
+    /**
+     * @brief Constructs an empty tile.
+     */
+    constexpr Tile() = default;
+
+    /**
+     * @brief Constructs a tile with specified flags, texture and object slot.
+     * @param solid True if the tile blocks movement.
+     * @param floor True if the top of the tile can be stood on.
+     * @param texture The texture of the tile.
+     * @param objectSlot The interactive object slot, 0 for none.
+     */
+    constexpr Tile(const bool solid, const bool floor, const Texture texture, const int objectSlot = 0)
+        : bits(static_cast<std::uint16_t>((solid ? SOLID_BIT : 0) | (floor ? FLOOR_BIT : 0) |
+                                          (static_cast<unsigned>(texture) & TEXTURE_MASK) << TEXTURE_SHIFT |
+                                          (static_cast<unsigned>(objectSlot) & OBJECT_MASK) << OBJECT_SHIFT)) {
+    }
+
+    /**
+     * @brief Constructs a tile from its packed representation.
+     * @param bits The packed flags, texture and object slot.
+     * @return The tile.
+     */
+    static constexpr Tile fromBits(const std::uint16_t bits) {
+        Tile tile;
+        tile.bits = bits;
+        return tile;
+    }
+
+    /**
+     * @brief Retrieves the packed representation of the tile.
+     * @return The packed bits.
+     */
+    [[nodiscard]] constexpr std::uint16_t getBits() const {
+        return bits;
+    }
+
+    /**
+     * @brief Checks if the tile blocks movement.
+     * @return True if the tile is solid, otherwise false.
+     */
+    [[nodiscard]] constexpr bool isSolid() const {
+        return bits & SOLID_BIT;
+    }
+
+    /**
+     * @brief Checks if the top of the tile can be stood on, which is always the case of solid tiles.
+     * @return True if the tile is a floor or is solid, otherwise false.
+     */
+    [[nodiscard]] constexpr bool isFloor() const {
+        return bits & (FLOOR_BIT | SOLID_BIT);
+    }
+
+    /**
+     * @brief Retrieves the texture of the tile.
+     * @return The texture.
+     */
+    [[nodiscard]] constexpr Texture getTexture() const {
+        return static_cast<Texture>(bits >> TEXTURE_SHIFT & TEXTURE_MASK);
+    }
+
+    /**
+     * @brief Retrieves the interactive object slot of the tile.
+     * @return The slot, 0 if the tile holds no object.
+     */
+    [[nodiscard]] constexpr int getObjectSlot() const {
+        return bits >> OBJECT_SHIFT & OBJECT_MASK;
+    }
+
+    /**
+     * @brief Compares two tiles.
+     * @param rhs The other tile.
+     * @return True if both tiles have the same flags, texture and object slot.
+     */
+    constexpr bool operator==(const Tile&rhs) const = default;
 };
 #endif //TILE_HPP
@@ -0,0 +1,264 @@
+/**
+ * @file TileMap.hpp
+ * @brief Defines the TileMap class, the run-length encoded tile interiors of every area of a level.
+ *
+ * The tiles of a level form a single grid, each area covering a square of areaTiles tiles, with
+ * the y axis pointing up. Every row of the grid is stored as runs of identical tiles, all rows
+ * sharing one contiguous buffer, so that the mostly empty rooms only cost a few runs per row.
+ * One tile is one world unit wide.
+ */
+#ifndef TILEMAP_HPP
+#define TILEMAP_HPP
+#include <cstdint>
+#include <vector>
+#include "Area.hpp"
+#include "Tile.hpp"
+#include "Vector2D.hpp"
+
+/**
+ * @struct AABB
+ * @brief Axis-aligned bounding box in world coordinates.
+ */
+struct AABB {
+    Vector2D min; ///< The bottom-left corner.
+    Vector2D max; ///< The top-right corner.
+};
+
+/**
+ * @struct RaySegment
+ * @brief Segment cast through the tile grid.
+ */
+struct RaySegment {
+    Vector2D from; ///< The start of the segment.
+    Vector2D to; ///< The end of the segment.
+};
+
+/**
+ * @struct RayHit
+ * @brief Result of a raycast through the tile grid.
+ */
+struct RayHit {
+    bool blocked = false; ///< True if a solid tile stops the ray before its end.
+    Vector2D point{0.0, 0.0}; ///< The point where the ray enters the blocking tile, or the end of the ray.
+    int tileX = -1; ///< The x-coordinate of the blocking tile, -1 if the ray is clear.
+    int tileY = -1; ///< The y-coordinate of the blocking tile, -1 if the ray is clear.
+    double distance = 0.0; ///< The distance travelled by the ray until the point.
+};
+
+/**
+ * @class TileMap
+ * @brief Compressed tile grid of a level, with point and box collision queries.
+ *
+ * Tiles outside of the grid are considered solid.
+ */
+class TileMap {
+    /**
+     * @struct Run
+     * @brief A run of identical tiles within a row, lasting until the start of the next run.
+     */
+    struct Run {
+        std::uint16_t start; ///< The x-coordinate of the first tile of the run.
+        std::uint16_t tile; ///< The packed tile repeated by the run.
+    };
+
+    int areasWide = 0; ///< Number of areas along the x axis.
+    int areasHigh = 0; ///< Number of areas along the y axis.
+    int areaTiles = 0; ///< Side length of an area, in tiles.
+    std::vector<Run> runs; ///< Runs of every row, row after row.
+    std::vector<std::uint32_t> rowOffsets; ///< Index of the first run of each row, plus the total run count.
+    std::vector<std::vector<InterractiveObject>> objects; ///< Objects of each area, the slot of a tile being its index + 1.
+
+    static constexpr int FILLED = 1 << 0; ///< Shape flag of the filled areas.
+    static constexpr int GATEWAY_LEFT = 1 << 1; ///< Shape flag of the areas opened to the left.
+    static constexpr int GATEWAY_RIGHT = 1 << 2; ///< Shape flag of the areas opened to the right.
+    static constexpr int GATEWAY_UP = 1 << 3; ///< Shape flag of the areas opened upward.
+    static constexpr int GATEWAY_DOWN = 1 << 4; ///< Shape flag of the areas opened downward.
+    static constexpr int GATEWAY_SIZE = 4; ///< Width of the openings of the gateways, in tiles.
+    static constexpr int PLATFORM_SPACING = 5; ///< Vertical spacing of the platforms below an upward gateway.
+
+    /**
+     * @brief Computes the shape flags of an area.
+     * @param area The area.
+     * @return The combination of the shape flags.
+     */
+    static int shapeOf(const Area&area);
+
+    /**
+     * @brief Computes the tile of an area interior, its walls being opened at its gateways.
+     * @param shape The shape flags of the area.
+     * @param localX The x-coordinate of the tile within the area.
+     * @param localY The y-coordinate of the tile within the area.
+     * @param size The side length of the area, in tiles.
+     * @return The tile, without object.
+     */
+    static Tile layoutTile(int shape, int localX, int localY, int size);
+
+    /**
+     * @brief Places the chests and the spawn points of an area on its floor.
+     * @param area The area.
+     * @param areaX The x-coordinate of the area.
+     * @param areaY The y-coordinate of the area.
+     * @return The placed objects.
+     */
+    [[nodiscard]] std::vector<InterractiveObject> placeObjects(const Area&area, int areaX, int areaY) const;
+
+    /**
+     * @brief Computes the index of an area in the object table.
+     * @param areaX The x-coordinate of the area.
+     * @param areaY The y-coordinate of the area.
+     * @return The index.
+     */
+    [[nodiscard]] std::size_t areaIndex(int areaX, int areaY) const;
+
+    /**
+     * @brief Finds the run covering a tile of a row.
+     * @param y The row.
+     * @param x The x-coordinate of the tile.
+     * @return The index of the run.
+     */
+    [[nodiscard]] std::size_t findRun(int y, int x) const;
+
+public:
+    /**
+     * @brief Constructs an empty tile map, where every tile is solid.
+     */
+    TileMap() = default;
+
+    /**
+     * @brief Builds the tile map of a level from its areas.
+     * @param areas 2D grid of areas, indexed by x then y.
+     * @param areaTiles The side length of an area, in tiles.
+     * @throws std::invalid_argument If the grid is not rectangular or too large to be encoded.
+     */
+    TileMap(const std::vector<std::vector<Area>>&areas, int areaTiles);
+
+    /**
+     * @brief Retrieves a tile.
+     * @param x The x-coordinate of the tile.
+     * @param y The y-coordinate of the tile.
+     * @return The tile, solid if outside of the grid.
+     */
+    [[nodiscard]] Tile at(int x, int y) const;
+
+    /**
+     * @brief Decodes a whole row of tiles, cheaper than reading them one by one.
+     * @param y The y-coordinate of the row.
+     * @param tiles Receives the tiles of the row, empty if the row is outside of the grid.
+     */
+    void getRow(int y, std::vector<Tile>&tiles) const;
+
+    /**
+     * @brief Checks if the tile holding a point is solid.
+     * @param point The point, in world coordinates.
+     * @return True if the tile is solid, otherwise false.
+     */
+    [[nodiscard]] bool isSolidAt(const Vector2D&point) const;
+
+    /**
+     * @brief Checks if a box overlaps a solid tile.
+     * @param box The box, in world coordinates.
+     * @return True if a solid tile overlaps the box, otherwise false.
+     */
+    [[nodiscard]] bool overlapsSolid(const AABB&box) const;
+
+    /**
+     * @brief Casts a segment through the tile grid, stopping at the first solid tile.
+     *
+     * The traversal visits every tile crossed by the segment in order (Amanatides and Woo), the
+     * runs of a row being followed incrementally so that each visited tile costs O(1). A segment
+     * of null length is clear; a segment whose length is not finite is blocked at its start.
+     * @param ray The segment.
+     * @return The hit, or a clear result at the end of the segment.
+     */
+    [[nodiscard]] RayHit raycast(const RaySegment&ray) const;
+
+    /**
+     * @brief Casts a batch of segments through the tile grid.
+     * @param rays The segments.
+     * @param hits Receives one result per segment, in the same order.
+     */
+    void raycast(const std::vector<RaySegment>&rays, std::vector<RayHit>&hits) const;
+
+    /**
+     * @brief Checks if no solid tile stands between two points.
+     * @param from The first point.
+     * @param to The second point.
+     * @return True if the segment is clear, otherwise false.
+     */
+    [[nodiscard]] bool hasLineOfSight(const Vector2D&from, const Vector2D&to) const;
+
+    /**
+     * @brief Checks the line of sight of a batch of segments.
+     * @param rays The segments.
+     * @param visible Receives 1 for each clear segment and 0 for each blocked one, in the same order.
+     */
+    void hasLineOfSight(const std::vector<RaySegment>&rays, std::vector<std::uint8_t>&visible) const;
+
+    /**
+     * @brief Retrieves the height of the first floor below a point.
+     * @param point The point, in world coordinates.
+     * @return The height of the top of the floor, 0 if there is none within the grid.
+     */
+    [[nodiscard]] double getGroundHeight(const Vector2D&point) const;
+
+    /**
+     * @brief Retrieves an object of an area.
+     * @param areaX The x-coordinate of the area.
+     * @param areaY The y-coordinate of the area.
+     * @param kind The kind of the object.
+     * @param id The ID of the object within its area.
+     * @return The object.
+     * @throws std::invalid_argument If the area has no such object.
+     */
+    [[nodiscard]] InterractiveObject getObject(int areaX, int areaY, InterractiveObjectKind kind, int id) const;
+
+    /**
+     * @brief Retrieves the object held by a tile.
+     * @param x The x-coordinate of the tile.
+     * @param y The y-coordinate of the tile.
+     * @return The object, of kind InterractiveObjectKind::NONE if the tile holds none.
+     */
+    [[nodiscard]] InterractiveObject getObjectAt(int x, int y) const;
+
+    /**
+     * @brief Retrieves the center of the opening of a gateway of an area, on the border of the area.
+     *
+     * The opening is laid out whether or not the area actually has this gateway.
+     * @param areaX The x-coordinate of the area.
+     * @param areaY The y-coordinate of the area.
+     * @param direction The direction of the gateway.
+     * @return The center of the opening, in world coordinates.
+     */
+    [[nodiscard]] Vector2D getGatewayCenter(int areaX, int areaY, const Direction2D&direction) const;
+
+    /**
+     * @brief Retrieves the side length of an area.
+     * @return The side length, in tiles.
+     */
+    [[nodiscard]] int getAreaTiles() const;
+
+    /**
+     * @brief Retrieves the width of the grid.
+     * @return The width, in tiles.
+     */
+    [[nodiscard]] int getWidth() const;
+
+    /**
+     * @brief Retrieves the height of the grid.
+     * @return The height, in tiles.
+     */
+    [[nodiscard]] int getHeight() const;
+
+    /**
+     * @brief Retrieves the number of runs encoding the grid.
+     * @return The number of runs.
+     */
+    [[nodiscard]] std::size_t getRunCount() const;
+
+    /**
+     * @brief Retrieves the memory used by the encoded tiles and the objects.
+     * @return The size, in bytes.
+     */
+    [[nodiscard]] std::size_t getMemoryUsage() const;
+};
+#endif //TILEMAP_HPP
@@ -0,0 +1,144 @@
+/**
+ * @file TimerWheel.hpp
+ * @brief Defines the TimerWheel class, a hierarchical timing wheel of capability expiry events.
+ *
+ * Attacks, movements, the jetpack and the hurt animation each store the time they were last
+ * used, so learning when one of them became ready means polling every capability of every
+ * character. Instead, the game schedules an event at the time each state expires, and drains
+ * the events that fell due once per frame.
+ *
+ * The wheel counts time in ticks of one millisecond. Its first level holds the events due within
+ * the next 64 ticks, one slot per tick; each further level covers 64 times the span of the previous
+ * one, one slot per slot of it. Events cascade down a level whenever the wheel enters their slot,
+ * so scheduling and draining an event costs a constant amount of work whatever the number of timers.
+ * Each level keeps a bitmap of its occupied slots: advancing jumps from one occupied slot to the
+ * next rather than stepping through every millisecond, so a long pause costs no more than a short one.
+ */
+#ifndef TIMERWHEEL_HPP
+#define TIMERWHEEL_HPP
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @enum TimerEventType
+ * @brief Enumerates the states whose expiry is reported by the timer wheel.
+ */
+enum TimerEventType {
+    ATTACK_READY, ///< The cooldown of an attack elapsed: it can be used again.
+    ATTACK_ENDED, ///< The charge and animation of an attack ended.
+    MOVEMENT_READY, ///< The cooldown of a movement elapsed: it can be used again.
+    MOVEMENT_ENDED, ///< The animation of a movement ended.
+    JETPACK_READY, ///< The flight, landing and cooldown of the jetpack elapsed: it can be activated again.
+    HURT_ENDED, ///< The hurt animation of a character ended.
+    ATTACK_CHARGED ///< The wind-up of an attack ended and it strikes; its damage was dealt when it was used.
+};
+
+/**
+ * @struct TimerEvent
+ * @brief A state of a character that expired.
+ */
+struct TimerEvent {
+    int characterId; ///< The ID of the character.
+    TimerEventType type; ///< The state that expired.
+    int capability; ///< The index of the attack (Attacks) or movement (Movements), -1 for HURT_ENDED.
+};
+
+/**
+ * @class TimerWheel
+ * @brief Hierarchical timing wheel of TimerEvent.
+ *
+ * The wheel does not own the characters: an event may refer to a character that has since been
+ * removed, so the owner validates every drained event.
+ */
+class TimerWheel {
+public:
+    using TimePoint = std::chrono::time_point<std::chrono::steady_clock>; ///< Clock used by the capabilities.
+    using Tick = std::chrono::milliseconds; ///< Resolution of the wheel.
+
+    static constexpr int SLOT_BITS = 6; ///< Number of bits of a tick indexing the slots of a level.
+    static constexpr std::size_t SLOTS = std::size_t{1} << SLOT_BITS; ///< Number of slots per level, one bit each of a bitmap.
+    static constexpr int LEVELS = 4; ///< Number of levels, covering 2^24 ticks, about 4.6 hours.
+    static constexpr std::uint64_t HORIZON = std::uint64_t{1} << (SLOT_BITS * LEVELS); ///< Span of the levels, in ticks.
+
+private:
+    /**
+     * @struct Entry
+     * @brief A scheduled event with its due tick.
+     */
+    struct Entry {
+        std::uint64_t tick; ///< The tick at which the event falls due.
+        TimerEvent event; ///< The event.
+    };
+
+    std::array<std::array<std::vector<Entry>, SLOTS>, LEVELS> wheels; ///< Slots of every level.
+    std::array<std::uint64_t, LEVELS> occupied{}; ///< One bit per non-empty slot of each level.
+    std::vector<Entry> overflow; ///< Events due beyond the span of the highest level.
+    TimePoint origin; ///< The time of tick 0.
+    std::uint64_t current = 0; ///< The next tick to process; every earlier event was drained.
+    std::size_t count = 0; ///< Number of scheduled events.
+
+    /**
+     * @brief Stores an entry in the slot matching its tick, relative to the current tick.
+     * @param entry The entry, due at the current tick at the earliest.
+     */
+    void insert(const Entry&entry);
+
+    /**
+     * @brief Moves the entries of a slot to the lower levels, as the wheel enters that slot.
+     * @param level The level of the slot.
+     */
+    void cascade(int level);
+
+    /**
+     * @brief Finds the next tick after the current one at which an event falls due or must cascade.
+     * @return The tick, or UINT64_MAX if nothing is scheduled.
+     */
+    [[nodiscard]] std::uint64_t nextBusyTick() const;
+
+public:
+    /**
+     * @brief Constructs an empty wheel.
+     * @param origin The time of the first tick.
+     */
+    explicit TimerWheel(TimePoint origin = std::chrono::steady_clock::now());
+
+    /**
+     * @brief Schedules an event.
+     * @param event The event.
+     * @param dueAt The time at which the event falls due; an event already due is drained by the next advance.
+     */
+    void schedule(const TimerEvent&event, TimePoint dueAt);
+
+    /**
+     * @brief Advances the wheel up to a time, collecting the events that fell due.
+     * @param now The current time.
+     * @param due Receives the due events, appended in chronological order to the millisecond.
+     */
+    void advance(TimePoint now, std::vector<TimerEvent>&due);
+
+    /**
+     * @brief Retrieves the time up to which the events were drained.
+     * @return The time; an event due after it is still scheduled or was never scheduled.
+     */
+    [[nodiscard]] TimePoint getDrainedTime() const;
+
+    /**
+     * @brief Retrieves the number of scheduled events, stale ones included.
+     * @return The number of events.
+     */
+    [[nodiscard]] std::size_t size() const;
+
+    /**
+     * @brief Checks if nothing is scheduled.
+     * @return True if the wheel is empty, otherwise false.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Removes every scheduled event.
+     */
+    void clear();
+};
+#endif //TIMERWHEEL_HPP
@@ -0,0 +1,29 @@
+/**
+ * @file Vector2D.hpp
+ * @brief Defines the Vector2D struct, representing a position or a velocity in the game world.
+ *
+ * World coordinates are expressed in tiles: the x axis points right and the y axis points up,
+ * matching the Direction constants.
+ */
+#ifndef VECTOR2D_HPP
+#define VECTOR2D_HPP
+/**
+ * @struct Vector2D
+ * @brief Represents a 2D vector in world coordinates.
+ */
+struct Vector2D {
+    double x; ///< The horizontal component.
+    double y; ///< The vertical component.
+
+    /**
+     * @brief Computes the squared distance to another point, avoiding a square root.
+     * @param other The other point.
+     * @return The squared distance between the two points.
+     */
+    [[nodiscard]] double squaredDistanceTo(const Vector2D&other) const {
+        const double dx = other.x - x;
+        const double dy = other.y - y;
+        return dx * dx + dy * dy;
+    }
+};
+#endif //VECTOR2D_HPP
@@ -6,6 +6,7 @@
 #endif
 #include "pch.h"
 #include "Animation.hpp"
+#include <algorithm>
 
 Animation::Animation(const double duration) : duration(duration) {
 }
@@ -23,4 +24,13 @@ bool Animation::isPlaying() const {
 
 double Animation::getDuration() const {
     return duration;
-}
\ No newline at end of file
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Animation::getEndTime() const {
+    return lastUsage + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(duration));
+}
+
+double Animation::getRemainingTime(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    return std::max(0.0, std::chrono::duration<double>(getEndTime() - now).count());
+}
@@ -5,6 +5,8 @@
 #define PCH_H
 #endif
 #include "pch.h"
+#include <algorithm>
+#include <iterator>
 #include <random>
 #include "Direction.hpp"
 #include <utility>
@@ -86,16 +88,26 @@ Spawn& Area::get_spawn(int spawn_id) {
     throw std::invalid_argument("No spawn with id " + std::to_string(spawn_id));
 }
 
-bool Area::can_spawn(int spawd_id) {
+bool Area::can_spawn(int spawd_id, const std::chrono::time_point<std::chrono::steady_clock> now) {
     try {
-        return get_spawn(spawd_id).canSpawn(); 
+        return get_spawn(spawd_id).canSpawn(now); 
     } catch (std::invalid_argument&) {
         return false;
     }
 }
 
-void Area::spawn(int spawd_id) {
-    get_spawn(spawd_id).spawn();
+void Area::spawn(int spawd_id, const std::chrono::time_point<std::chrono::steady_clock> now) {
+    get_spawn(spawd_id).spawn(now);
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Area::get_next_spawn_time(const int spawn_id) const {
+    const auto it = std::ranges::find_if(spawns, [spawn_id](const Spawn& spawn) {
+        return spawn.getId() == spawn_id;
+    });
+    if (it == spawns.end()) {
+        throw std::invalid_argument("No spawn with id " + std::to_string(spawn_id));
+    }
+    return it->getNextSpawnTime();
 }
 
 std::vector<int> Area::get_spawn_ids() const {
@@ -107,6 +119,15 @@ std::vector<int> Area::get_spawn_ids() const {
     return ids;
 }
 
+std::vector<int> Area::get_chest_ids() const {
+    std::vector<int> ids;
+    ids.reserve(chests.size());
+    std::ranges::transform(chests, std::back_inserter(ids), [](const Chest& chest) {
+        return chest.getId();
+    });
+    return ids;
+}
+
 bool Area::canSpawnBoss() const {
     return std::ranges::any_of(spawns, [](const Spawn& spawn) {
         return spawn.canSpawnBoss();
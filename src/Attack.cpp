@@ -7,35 +7,85 @@
 #include "pch.h"
 #include "Attack.hpp"
 
+#include <algorithm>
+#include <stdexcept>
 #include <utility>
 
 Attack::Attack(std::string name, const int damage, const double cooldown, const double chargeTime,
-               const double animationTime) : name(std::move(name)), damage(damage), cooldown(cooldown), chargeTime(chargeTime),
-                                       animationTime(animationTime) {
+               const double animationTime, const double activeFraction) : name(std::move(name)), damage(damage),
+    cooldown(cooldown), chargeTime(chargeTime), animationTime(animationTime), activeFraction(activeFraction) {
+    if (!(activeFraction >= 0.0 && activeFraction <= 1.0)) {
+        throw std::invalid_argument("Active fraction must be between 0 and 1");
+    }
 }
 
 int Attack::use() {
     if (!canUse()) {
         throw std::runtime_error("Cannot use attack");
     }
+    const auto seconds = [](const double duration) {
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(duration));
+    };
     lastUsageTime = std::chrono::steady_clock::now();
+    chargedTime = lastUsageTime + seconds(chargeTime);
+    recoveryTime = chargedTime + seconds(animationTime * activeFraction);
+    endTime = lastUsageTime + seconds(chargeTime + animationTime);
+    readyTime = endTime + seconds(cooldown);
     return damage;
 }
 
 bool Attack::isUsing() const {
-    if (lastUsageTime.time_since_epoch().count() == 0) {
-        return false;
-    } 
-    return std::chrono::steady_clock::now() - lastUsageTime < std::chrono::duration<double>(animationTime) +
-           std::chrono::duration<double>(chargeTime);
+    return std::chrono::steady_clock::now() < endTime;
 }
 
 bool Attack::canUse() const {
-    if (lastUsageTime.time_since_epoch().count() == 0) {
-        return true;
+    // Never used, every deadline is at the epoch.
+    return std::chrono::steady_clock::now() > readyTime;
+}
+
+AttackPhases Attack::getPhase(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    if (now > readyTime) {
+        return IDLE;
+    }
+    if (now < chargedTime) {
+        return WINDUP;
+    }
+    if (now < recoveryTime) {
+        return ACTIVE;
+    }
+    if (now < endTime) {
+        return RECOVERING;
+    }
+    return COOLDOWN;
+}
+
+double Attack::getPhaseProgress(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    std::chrono::time_point<std::chrono::steady_clock> start;
+    std::chrono::time_point<std::chrono::steady_clock> end;
+    switch (getPhase(now)) {
+        case IDLE:
+            return 0.0;
+        case WINDUP:
+            start = lastUsageTime;
+            end = chargedTime;
+            break;
+        case ACTIVE:
+            start = chargedTime;
+            end = recoveryTime;
+            break;
+        case RECOVERING:
+            start = recoveryTime;
+            end = endTime;
+            break;
+        case COOLDOWN:
+            start = endTime;
+            end = readyTime;
+            break;
+    }
+    if (end <= start) {
+        return 1.0;
     }
-    return std::chrono::steady_clock::now() - lastUsageTime > std::chrono::duration<double>(animationTime) +
-           std::chrono::duration<double>(chargeTime) + std::chrono::duration<double>(cooldown);
+    return std::clamp(std::chrono::duration<double>(now - start) / std::chrono::duration<double>(end - start), 0.0, 1.0);
 }
 
 int Attack::getDamage() const {
@@ -58,13 +108,36 @@ double Attack::getAnimationTime() const {
     return animationTime;
 }
 
+double Attack::getActiveFraction() const {
+    return activeFraction;
+}
+
 std::chrono::time_point<std::chrono::steady_clock> Attack::getLastUsageTime() const {
     return lastUsageTime;
 }
 
-void Attack::increaseDamage(double amount) {
+std::chrono::time_point<std::chrono::steady_clock> Attack::getChargedTime() const {
+    return chargedTime;
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Attack::getEndTime() const {
+    return endTime;
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Attack::getReadyTime() const {
+    return readyTime;
+}
+
+double Attack::getRemainingTime(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    if (lastUsageTime.time_since_epoch().count() == 0) {
+        return 0.0;
+    }
+    return std::max(0.0, std::chrono::duration<double>(getReadyTime() - now).count());
+}
+
+void Attack::setDamage(const int amount) {
     if (amount < 0) {
         throw std::invalid_argument("Amount must be positive");
     }
-    damage += amount;
+    damage = amount;
 }
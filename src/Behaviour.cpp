@@ -0,0 +1,250 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "Behaviour.hpp"
+#include "BehaviourScheduler.hpp"
+#include "Game.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    constexpr double STEER_INTERVAL = 0.2; ///< Time between two decisions of a chasing enemy, in seconds.
+    constexpr double ATTACK_PAUSE = 0.5; ///< Pause of an enemy after an attack, in seconds.
+    constexpr double BOSS_ENRAGE_HEALTH = 0.5; ///< Fraction of its health below which a boss enrages.
+    constexpr double BOSS_ENRAGE_MULTIPLIER = 1.5; ///< Multiplier of the damage and run force of an enraged boss.
+    constexpr double BOSS_ENRAGE_TIME = 5.0; ///< Duration of a burst of rage, in seconds.
+    constexpr double BOSS_ENRAGE_INTERVAL = 15.0; ///< Time between the starts of two bursts of rage, in seconds.
+    constexpr double BOSS_ENRAGED_PAUSE = 0.1; ///< Pause of an enraged boss after an attack, in seconds.
+
+    /**
+     * @brief Converts a duration in seconds to the resolution of the game clock.
+     * @param seconds The duration.
+     * @return The duration.
+     */
+    std::chrono::steady_clock::duration toDuration(const double seconds) {
+        return std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    /**
+     * @brief Runs toward the player within the follow range, and attacks once it is within reach.
+     * @param context The enemy.
+     * @return The behaviour.
+     */
+    Behaviour chase(const BehaviourContext context) {
+        while (context.isAlive()) {
+            co_await context.untilWithin(context.followRange);
+            if (!context.isAlive()) {
+                break;
+            }
+            if (!context.canReachPlayer()) {
+                context.runTowardPlayer();
+                co_await context.wait(STEER_INTERVAL);
+                continue;
+            }
+            context.stop();
+            if (context.attack()) {
+                co_await context.untilAttackEnds();
+                co_await context.wait(ATTACK_PAUSE);
+            }
+            else {
+                co_await context.wait(STEER_INTERVAL);
+            }
+        }
+        context.stop();
+    }
+
+    /**
+     * @brief Chases like chase, then enrages by bursts once its health fell below BOSS_ENRAGE_HEALTH.
+     * @param context The boss.
+     * @return The behaviour.
+     */
+    Behaviour boss(const BehaviourContext context) {
+        BehaviourContext::TimePoint nextRage{};
+        while (context.isAlive()) {
+            co_await context.untilWithin(context.followRange);
+            if (!context.isAlive()) {
+                break;
+            }
+            const BehaviourContext::TimePoint now = context.scheduler->getTime();
+            const bool enraged = context.getHealthRatio() <= BOSS_ENRAGE_HEALTH;
+            if (enraged && now >= nextRage) {
+                context.buff(ATTACK_DAMAGE, BOSS_ENRAGE_MULTIPLIER, BOSS_ENRAGE_TIME);
+                context.buff(RUN_FORCE, BOSS_ENRAGE_MULTIPLIER, BOSS_ENRAGE_TIME);
+                nextRage = now + toDuration(BOSS_ENRAGE_INTERVAL);
+            }
+            if (!context.canReachPlayer()) {
+                context.runTowardPlayer();
+                co_await context.wait(STEER_INTERVAL);
+                continue;
+            }
+            context.stop();
+            if (context.attack()) {
+                co_await context.untilAttackEnds();
+                co_await context.wait(enraged ? BOSS_ENRAGED_PAUSE : ATTACK_PAUSE);
+            }
+            else {
+                co_await context.wait(STEER_INTERVAL);
+            }
+        }
+        context.stop();
+    }
+}
+
+bool BehaviourContext::Sleep::await_ready() const noexcept {
+    return due <= scheduler->getTime();
+}
+
+void BehaviourContext::Sleep::await_suspend(std::coroutine_handle<>) const {
+    scheduler->sleepUntil(due);
+}
+
+BehaviourContext::Range::Range(const BehaviourContext* context, const double distance, const bool within)
+    : context(context), distance(distance), within(within) {
+}
+
+bool BehaviourContext::Range::isReady() const {
+    if (!context->isAlive()) {
+        return true;
+    }
+    return (context->distanceToPlayer() <= distance) == within;
+}
+
+bool BehaviourContext::Range::await_ready() const {
+    return isReady();
+}
+
+void BehaviourContext::Range::await_suspend(std::coroutine_handle<>) const {
+    context->scheduler->watch(*this);
+}
+
+bool BehaviourContext::isAlive() const {
+    return game->isAValidId(id) && game->getCharacter(id).getHealth().current > 0;
+}
+
+int BehaviourContext::getTarget() const {
+    const int target = game->getEnemyTarget(id);
+    return target >= 0 ? target : game->getPlayerId();
+}
+
+double BehaviourContext::distanceToPlayer() const {
+    const Vector2D position = game->getCharacter(id).getPosition();
+    return std::sqrt(position.squaredDistanceTo(game->getCharacter(getTarget()).getPosition()));
+}
+
+double BehaviourContext::getHealthRatio() const {
+    const Health health = game->getCharacter(id).getHealth();
+    return health.max > 0 ? static_cast<double>(health.current) / health.max : 0.0;
+}
+
+bool BehaviourContext::canReachPlayer() const {
+    return game->canCharacterReach(id, getTarget());
+}
+
+bool BehaviourContext::attack() const {
+    const int target = getTarget();
+    if (!game->getCharacter(id).canUse(attackName) || !game->canCharacterReach(id, target)) {
+        return false;
+    }
+    game->attack(id, attackName, target);
+    return true;
+}
+
+void BehaviourContext::runTowardPlayer() const {
+    const double offset = game->getCharacter(getTarget()).getPosition().x - game->getCharacter(id).getPosition().x;
+    game->setCharacterRunInput(id, offset >= 0 ? 1.0 : -1.0);
+}
+
+void BehaviourContext::stop() const {
+    game->setCharacterRunInput(id, 0.0);
+}
+
+void BehaviourContext::buff(const Stats stat, const double multiplier, const double seconds) const {
+    game->addCharacterBuff(id, stat, 0.0, multiplier, seconds);
+}
+
+BehaviourContext::Sleep BehaviourContext::wait(const double seconds) const {
+    return {scheduler, scheduler->getTime() + toDuration(seconds)};
+}
+
+BehaviourContext::Sleep BehaviourContext::untilAttackReady() const {
+    return {scheduler, game->getCharacter(id).getAttack(attackName).getReadyTime()};
+}
+
+BehaviourContext::Sleep BehaviourContext::untilAttackEnds() const {
+    return {scheduler, game->getCharacter(id).getAttack(attackName).getEndTime()};
+}
+
+BehaviourContext::Range BehaviourContext::untilWithin(const double distance) const {
+    return {this, distance, true};
+}
+
+BehaviourContext::Range BehaviourContext::untilBeyond(const double distance) const {
+    return {this, distance, false};
+}
+
+void* Behaviour::promise_type::operator new(const std::size_t size, const BehaviourContext&context) {
+    return context.scheduler->getFrames().allocate(size);
+}
+
+void Behaviour::promise_type::operator delete(void* frame, const std::size_t size) {
+    FramePool::deallocate(frame, size);
+}
+
+Behaviour Behaviour::promise_type::get_return_object() {
+    return Behaviour(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+Behaviour::Behaviour(const std::coroutine_handle<promise_type> handle) : handle(handle) {
+}
+
+Behaviour::Behaviour(Behaviour&&other) noexcept : handle(std::exchange(other.handle, {})) {
+}
+
+Behaviour& Behaviour::operator=(Behaviour&&other) noexcept {
+    if (this != &other) {
+        if (handle) {
+            handle.destroy();
+        }
+        handle = std::exchange(other.handle, {});
+    }
+    return *this;
+}
+
+Behaviour::~Behaviour() {
+    if (handle) {
+        handle.destroy();
+    }
+}
+
+void Behaviour::resume() const {
+    handle.resume();
+}
+
+bool Behaviour::done() const {
+    return !handle || handle.done();
+}
+
+std::exception_ptr Behaviour::getException() const {
+    return handle ? handle.promise().exception : nullptr;
+}
+
+int Behaviour::getScript() const {
+    return handle ? handle.promise().script : -1;
+}
+
+Behaviour Behaviour::create(const Behaviours behaviour, const BehaviourContext&context) {
+    Behaviour created;
+    switch (behaviour) {
+        case CHASE:
+            created = chase(context);
+            break;
+        case BOSS:
+            created = boss(context);
+            break;
+        default:
+            throw std::invalid_argument("Invalid behaviour");
+    }
+    created.handle.promise().script = behaviour;
+    return created;
+}
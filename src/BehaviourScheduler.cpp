@@ -0,0 +1,143 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "BehaviourScheduler.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace {
+    /**
+     * @brief Orders the sleepers of the heap, the earliest due time on top.
+     */
+    constexpr auto LATER = [](const auto&a, const auto&b) {
+        return a.due > b.due;
+    };
+}
+
+bool BehaviourScheduler::isFresh(const Waiting&waiting) const {
+    return slots[waiting.slot].generation == waiting.generation;
+}
+
+void BehaviourScheduler::release(const std::uint32_t slot) {
+    slotOf.erase(slots[slot].characterId);
+    slots[slot].behaviour = Behaviour();
+    slots[slot].characterId = -1;
+    ++slots[slot].generation;
+    freeSlots.push_back(slot);
+}
+
+FramePool& BehaviourScheduler::getFrames() {
+    return frames;
+}
+
+void BehaviourScheduler::spawn(const int characterId, Behaviour behaviour) {
+    stop(characterId);
+    std::uint32_t slot;
+    if (freeSlots.empty()) {
+        slot = static_cast<std::uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+    else {
+        slot = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    slots[slot].behaviour = std::move(behaviour);
+    slots[slot].characterId = characterId;
+    slotOf[characterId] = slot;
+    ready.push_back({slot, slots[slot].generation});
+}
+
+void BehaviourScheduler::tick(const TimePoint time) {
+    now = time;
+    resuming.swap(ready);
+    ready.clear();
+    while (!sleepers.empty() && sleepers.front().due <= now) {
+        std::ranges::pop_heap(sleepers, LATER);
+        resuming.push_back(sleepers.back().waiting);
+        sleepers.pop_back();
+    }
+    std::erase_if(watchers, [this](const Watcher&watcher) {
+        if (!isFresh(watcher.waiting)) {
+            return true;
+        }
+        if (watcher.condition->isReady()) {
+            resuming.push_back(watcher.waiting);
+            return true;
+        }
+        return false;
+    });
+    std::exception_ptr exception;
+    for (const Waiting&waiting: resuming) {
+        if (!isFresh(waiting)) {
+            continue;
+        }
+        current = waiting.slot;
+        slots[waiting.slot].behaviour.resume();
+        current = NONE;
+        const Behaviour&behaviour = slots[waiting.slot].behaviour;
+        if (behaviour.done()) {
+            if (!exception) {
+                exception = behaviour.getException();
+            }
+            release(waiting.slot);
+        }
+    }
+    resuming.clear();
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
+
+void BehaviourScheduler::sleepUntil(const TimePoint due) {
+    if (current == NONE) {
+        throw std::logic_error("No behaviour is running");
+    }
+    sleepers.push_back({due, {current, slots[current].generation}});
+    std::ranges::push_heap(sleepers, LATER);
+}
+
+void BehaviourScheduler::watch(const ConditionAwaiter&condition) {
+    if (current == NONE) {
+        throw std::logic_error("No behaviour is running");
+    }
+    watchers.push_back({&condition, {current, slots[current].generation}});
+}
+
+BehaviourScheduler::TimePoint BehaviourScheduler::getTime() const {
+    return now;
+}
+
+bool BehaviourScheduler::stop(const int characterId) {
+    const auto it = slotOf.find(characterId);
+    if (it == slotOf.end()) {
+        return false;
+    }
+    if (it->second == current) {
+        throw std::logic_error("A behaviour cannot stop itself");
+    }
+    release(it->second);
+    return true;
+}
+
+bool BehaviourScheduler::isRunning(const int characterId) const {
+    return slotOf.contains(characterId);
+}
+
+int BehaviourScheduler::getScript(const int characterId) const {
+    const auto slot = slotOf.find(characterId);
+    return slot == slotOf.end() ? -1 : slots[slot->second].behaviour.getScript();
+}
+
+std::size_t BehaviourScheduler::size() const {
+    return slotOf.size();
+}
+
+void BehaviourScheduler::clear() {
+    while (!slotOf.empty()) {
+        release(slotOf.begin()->second);
+    }
+    sleepers.clear();
+    watchers.clear();
+    ready.clear();
+}
@@ -17,6 +17,36 @@ Capabilities::Capabilities(std::vector<Attack> attacks, std::set<std::shared_ptr
     std::ranges::for_each(movements, [this](const std::shared_ptr<Movement>&movement) {
         this->movements.emplace(movement->getName(), movement);
     });
+    indexMovements();
+}
+
+Capabilities::Capabilities(const Capabilities&other) : attacks(other.attacks), jetPack(other.jetPack) {
+    for (const auto&[name, movement]: other.movements) {
+        movements.emplace_hint(movements.end(), name, movement->clone());
+    }
+    indexMovements();
+}
+
+void Capabilities::indexMovements() {
+    // Moving the map keeps its nodes, and so the movements they point to: only a copy indexes them again.
+    byKind.fill(nullptr);
+    for (const auto&[name, movement]: movements) {
+        if (const auto kind = magic_enum::enum_cast<Movements>(name)) {
+            byKind[*kind] = movement.get();
+        }
+    }
+}
+
+const Movement* Capabilities::findMovement(const Movements movement) const {
+    return byKind[movement];
+}
+
+Capabilities& Capabilities::operator=(const Capabilities&other) {
+    if (this != &other) {
+        Capabilities copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
 }
 
 std::chrono::time_point<std::chrono::steady_clock> Capabilities::getLastAttackTime() const {
@@ -29,6 +59,17 @@ std::chrono::time_point<std::chrono::steady_clock> Capabilities::getLastAttackTi
     return lastAttackTime;
 }
 
+const Attack* Capabilities::getLastUsedAttack() const {
+    const Attack* last = nullptr;
+    for (const Attack&attack: attacks) {
+        if (attack.getLastUsageTime().time_since_epoch().count() != 0 &&
+            (last == nullptr || attack.getLastUsageTime() > last->getLastUsageTime())) {
+            last = &attack;
+        }
+    }
+    return last;
+}
+
 bool Capabilities::hasThisAttack(std::string name) const {
     return std::ranges::find_if(attacks, [&name](const Attack&attack) {
         return attack.getName() == name;
@@ -112,18 +153,12 @@ int Capabilities::isMoving() const {
     return -1;
 }
 
-void Capabilities::increaseAttackDamage(double amount, std::string&attacksName) {
-    const auto it = std::ranges::find_if(attacks, [&attacksName](const Attack& attack) {
-        return attack.getName() == attacksName;
-    });
-    if (it != attacks.end()) {
-        it->increaseDamage(amount);
+void Capabilities::setAttackDamages(const std::vector<int>&damages) {
+    if (damages.size() != attacks.size()) {
+        throw std::invalid_argument("There must be one damage per attack");
     }
-}
-
-void Capabilities::increaseMovementForce(const std::string& movementName, double amount) {
-    if (const auto it = movements.find(movementName); it != movements.end()) {
-        it->second->increaseForce(amount);
+    for (std::size_t i = 0; i < attacks.size(); ++i) {
+        attacks[i].setDamage(damages[i]);
     }
 }
 
@@ -8,6 +8,7 @@
 #include "Character.hpp"
 
 #include "GameOverException.hpp"
+#include <algorithm>
 #include <random>
 
 #include "Items.hpp"
@@ -24,7 +25,17 @@ int Character::nextId = 0;
 Character::Character(std::string type, const int max_health, const double hurtTime,
                      Capabilities capabilities) : type(std::move(type)), id(nextId++),
                                                   health(max_health, max_health),
-                                                  capabilities(std::move(capabilities)), onGround(true), hurtAnimation(hurtTime) {
+                                                  capabilities(std::move(capabilities)), onGround(true), hurtAnimation(hurtTime),
+                                                  baseMaxHealth(max_health) {
+    if (this->capabilities.hasThisMovement("RUN")) {
+        baseRunForce = this->capabilities.getMovement("RUN")->getForce();
+    }
+    if (this->capabilities.hasThisMovement("JUMP")) {
+        baseJumpCount = std::dynamic_pointer_cast<Jump>(this->capabilities.getMovement("JUMP"))->getMaxUsage();
+    }
+    for (std::size_t i = 0; i < this->capabilities.getCharacterAttacksName().size(); ++i) {
+        baseAttackDamages.push_back(this->capabilities.getAttackAt(static_cast<int>(i)).getDamage());
+    }
 }
 
 Character::Character(const std::string&type, const int max_health) : Character(type, max_health, DEF_HURT_TIME, {
@@ -50,6 +61,18 @@ std::shared_ptr<Movement> Character::getMovement(const std::string&name) const {
     return capabilities.getMovement(name);
 }
 
+bool Character::hasMovement(const std::string&name) const {
+    return capabilities.hasThisMovement(name);
+}
+
+const Movement* Character::findMovement(const Movements movement) const {
+    return capabilities.findMovement(movement);
+}
+
+bool Character::hasAttack(const std::string&name) const {
+    return capabilities.hasThisAttack(name);
+}
+
 JetPack Character::getJetPack() const {
     return capabilities.getJetPack();
 }
@@ -79,12 +102,60 @@ void Character::increaseHealth(const int amount) {
     health.current += amount;
 }
 
-void Character::increaseMaxHealth(const int amount) {
-    if (amount < 0) {
-        throw std::invalid_argument("Amount must be positive");
+void Character::applyModifiers() {
+    const int maxHealth = std::max(1, static_cast<int>(modifiers.apply(MAX_HEALTH, baseMaxHealth)));
+    if (maxHealth > health.max && health.current > 0) {
+        // Only the gain is healed, so that a buff of the maximum health is not a full heal.
+        health.current += maxHealth - health.max;
+    }
+    health.current = std::min(health.current, maxHealth);
+    health.max = maxHealth;
+    if (capabilities.hasThisMovement("RUN")) {
+        capabilities.getMovement("RUN")->setForce(std::max(0.0, modifiers.apply(RUN_FORCE, baseRunForce)));
+    }
+    if (capabilities.hasThisMovement("JUMP")) {
+        std::dynamic_pointer_cast<Jump>(capabilities.getMovement("JUMP"))->setMaxUsage(
+            std::max(0, static_cast<int>(modifiers.apply(JUMP_COUNT, baseJumpCount))));
+    }
+    std::vector<int> damages;
+    damages.reserve(baseAttackDamages.size());
+    for (const int damage: baseAttackDamages) {
+        damages.push_back(std::max(0, static_cast<int>(modifiers.apply(ATTACK_DAMAGE, damage))));
+    }
+    capabilities.setAttackDamages(damages);
+}
+
+void Character::addModifier(const Modifier&modifier) {
+    modifiers.add(modifier);
+    applyModifiers();
+    // A health boost item is a full heal on top of the gain, unlike a buff.
+    if (modifier.source == ITEM && modifier.stat == MAX_HEALTH && health.current > 0) {
+        health.current = health.max;
+    }
+}
+
+bool Character::refreshModifier(const Modifier&modifier) {
+    if (modifiers.refresh(modifier)) {
+        return false;
+    }
+    addModifier(modifier);
+    return true;
+}
+
+bool Character::expireModifiers(const ModifierStack::TimePoint now) {
+    if (!modifiers.expire(now)) {
+        return false;
     }
-    health.max += amount;
-    health.current = health.max;
+    applyModifiers();
+    return true;
+}
+
+double Character::getDamageTakenFactor() const {
+    return std::max(0.0, modifiers.apply(DAMAGE_TAKEN, 1.0));
+}
+
+const ModifierStack& Character::getModifiers() const {
+    return modifiers;
 }
 
 bool Character::hasJetPack() const {
@@ -103,6 +174,10 @@ void Character::move(const std::string& movementName) {
         throw std::invalid_argument("This movement cannot be used");
     }
     capabilities.use(movementName);
+    if (movementName == "JUMP") {
+        velocity.y = capabilities.getMovement(movementName)->getForce();
+        onGround = false;
+    }
 }
 
 bool Character::canUseJetpack() const {
@@ -165,7 +240,51 @@ bool Character::isBusy() const {
     return hurtAnimation.isPlaying();
 }
 
+AttackState Character::getAttackState(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    const Attack* attack = capabilities.getLastUsedAttack();
+    if (attack == nullptr) {
+        return {};
+    }
+    return {DefinedAttacks::getAttackValue(attack->getName()), attack->getPhase(now), attack->getPhaseProgress(now)};
+}
+
+void Character::getRemainingTimes(const std::chrono::time_point<std::chrono::steady_clock> now,
+                                  const std::span<double> times) const {
+    std::ranges::fill(times, NO_CAPABILITY);
+    const double hurt = hurtAnimation.getRemainingTime(now);
+    double busy = hurt;
+    if (capabilities.hasThisMovement("DASH")) {
+        const auto dash = capabilities.getMovement("DASH");
+        if (dash->isUsing(now)) {
+            busy = std::max(busy, std::chrono::duration<double>(dash->getEndTime() - now).count());
+        }
+    }
+    for (const std::string&name: capabilities.getCharacterAttacksName()) {
+        times[DefinedAttacks::getAttackValue(name)] = std::max(busy, getAttack(name).getRemainingTime(now));
+    }
+    const std::span<double> movements = times.subspan(DefinedAttacks::size(), DefinedMovements::size());
+    for (int movement = 0; movement < DefinedMovements::size(); ++movement) {
+        const std::string name = DefinedMovements::getMovementName(movement);
+        if (movement == JETPACK) {
+            if (hasJetPack()) {
+                movements[movement] = std::max(busy, capabilities.getJetPack().getRemainingTime(now));
+            }
+        }
+        else if (capabilities.hasThisMovement(name)) {
+            movements[movement] = std::max(busy, capabilities.getMovement(name)->getRemainingTime(now));
+        }
+    }
+    times.back() = hurt;
+}
+
 void Character::hurt(const int damage) {
+    loseHealth(damage);
+    if (!hurtAnimation.isPlaying()) {
+        hurtAnimation.start();
+    }
+}
+
+void Character::loseHealth(const int damage) {
     if (damage < 0) {
         throw std::invalid_argument("Damage must be positive");
     }
@@ -175,9 +294,6 @@ void Character::hurt(const int damage) {
     } else {
         health.current -= damage; 
     }
-    if (!hurtAnimation.isPlaying()) {
-        hurtAnimation.start();
-    }
 }
 
 std::string Character::getType() const {
@@ -213,21 +329,6 @@ void Character::addItem(const Item& item) {
     }
 }
 
-void Character::increaseMovementForce(const std::string& movementName, const double amount) {
-    if (movementName == "JUMP") {
-        const std::shared_ptr<Jump> jump = std::dynamic_pointer_cast<Jump>(capabilities.getMovement(movementName));
-        jump->increaseForce(amount);
-        return;
-    }
-    capabilities.increaseMovementForce(movementName, amount);
-}
-
-void Character::increaseAttackDamage(const double amount, const std::vector<std::string>& attackName) {
-    for (auto attack_name : attackName) {
-        capabilities.increaseAttackDamage(amount, attack_name);
-    }
-}
-
 std::vector<std::string> Character::getAllAttackName() const {
     return capabilities.getCharacterAttacksName();
 }
@@ -246,3 +347,42 @@ int Character::getNumberOfItem(int item_id) const {
 Attack Character::getAttackAt(const int attackIndex) const {
     return capabilities.getAttackAt(attackIndex);
 }
+
+Vector2D Character::getPosition() const {
+    return position;
+}
+
+void Character::setPosition(const Vector2D&newPosition) {
+    position = newPosition;
+}
+
+Vector2D Character::getVelocity() const {
+    return velocity;
+}
+
+void Character::setVelocity(const Vector2D&newVelocity) {
+    velocity = newVelocity;
+}
+
+double Character::getRunInput() const {
+    return runInput;
+}
+
+void Character::setRunInput(const double input) {
+    runInput = std::clamp(input, -1.0, 1.0);
+    if (runInput != 0.0) {
+        facing = runInput > 0.0 ? 1 : -1;
+    }
+}
+
+int Character::getFacing() const {
+    return facing;
+}
+
+bool Character::isUsingMovement(const std::string&movementName,
+                                const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    if (movementName == "JETPACK") {
+        return hasJetPack() && capabilities.getJetPack().isUsing(now);
+    }
+    return capabilities.hasThisMovement(movementName) && capabilities.getMovement(movementName)->isUsing(now);
+}
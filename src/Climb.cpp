@@ -21,10 +21,14 @@ void Climb::stop() {
     climbing = false;
 }
 
-bool Climb::isUsing() const {
+bool Climb::isUsing(std::chrono::time_point<std::chrono::steady_clock>) const {
     return climbing;
 }
 
 bool Climb::canUse() const {
     return true;
 }
+
+std::shared_ptr<Movement> Climb::clone() const {
+    return std::make_shared<Climb>(*this);
+}
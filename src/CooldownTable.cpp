@@ -0,0 +1,71 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "CooldownTable.hpp"
+#include <cmath>
+#include <stdexcept>
+
+CooldownTable::CooldownTable(const TimePoint origin) : origin(origin) {
+}
+
+std::int64_t CooldownTable::toTick(const TimePoint time) const {
+    return std::chrono::floor<std::chrono::milliseconds>(time - origin).count();
+}
+
+void CooldownTable::update(const std::size_t slot, const Character&character, const TimePoint now) {
+    if (slot > masks.size()) {
+        throw std::out_of_range("Cooldown rows must be appended in slot order");
+    }
+    if (slot == masks.size()) {
+        for (auto&ticks: readyAt) {
+            ticks.push_back(NEVER);
+        }
+        masks.push_back(0);
+    }
+    std::array<double, Character::REMAINING_TIME_COUNT> remaining{};
+    character.getRemainingTimes(now, remaining);
+    const std::int64_t tick = toTick(now);
+    for (std::size_t capability = 0; capability < CAPABILITIES; ++capability) {
+        const double seconds = remaining[capability];
+        readyAt[capability][slot] = seconds < 0 || std::isinf(seconds)
+                                        ? NEVER
+                                        : tick + static_cast<std::int64_t>(std::ceil(seconds * 1000.0));
+    }
+}
+
+void CooldownTable::truncate(const std::size_t count) {
+    if (count >= masks.size()) {
+        return;
+    }
+    for (auto&ticks: readyAt) {
+        ticks.resize(count);
+    }
+    masks.resize(count);
+}
+
+void CooldownTable::computeMasks(const TimePoint now) {
+    const std::int64_t tick = toTick(now);
+    const std::size_t count = masks.size();
+    std::ranges::fill(masks, 0);
+    Mask* const out = masks.data();
+    for (std::size_t capability = 0; capability < CAPABILITIES; ++capability) {
+        const std::int64_t* const ticks = readyAt[capability].data();
+        const Mask flag = bit(capability);
+        for (std::size_t slot = 0; slot < count; ++slot) {
+            out[slot] |= static_cast<Mask>(ticks[slot] <= tick ? flag : 0);
+        }
+    }
+}
+
+CooldownTable::Mask CooldownTable::getMask(const std::size_t slot) const {
+    return masks.at(slot);
+}
+
+const std::vector<CooldownTable::Mask>& CooldownTable::getMasks() const {
+    return masks;
+}
+
+std::size_t CooldownTable::size() const {
+    return masks.size();
+}
@@ -0,0 +1,54 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "DamageBuffer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+void DamageBuffer::push(const DamageHit&hit) {
+    if (hit.damage < 0) {
+        throw std::invalid_argument("Damage must be positive");
+    }
+    hits.push_back(hit);
+}
+
+std::span<const DamageHit> DamageBuffer::sortByTarget() {
+    std::ranges::stable_sort(hits, {}, &DamageHit::targetId);
+    return hits;
+}
+
+bool DamageBuffer::empty() const {
+    return hits.empty();
+}
+
+std::size_t DamageBuffer::size() const {
+    return hits.size();
+}
+
+void DamageBuffer::clear() {
+    hits.clear();
+}
+
+std::size_t DamageBuffer::endOfTarget(const std::span<const DamageHit> hits, const std::size_t first) {
+    std::size_t last = first;
+    while (last < hits.size() && hits[last].targetId == hits[first].targetId) {
+        ++last;
+    }
+    return last;
+}
+
+DamageResult DamageBuffer::total(const Character&target, const std::span<const DamageHit> hits) {
+    const double factor = target.getDamageTakenFactor();
+    const int health = target.getHealth().current;
+    int damage = 0;
+    int killerId = -1;
+    for (const DamageHit&hit: hits) {
+        damage += static_cast<int>(std::lround(hit.damage * factor));
+        if (killerId < 0 && health > 0 && damage >= health) {
+            killerId = hit.sourceId;
+        }
+    }
+    return {target.getId(), damage, killerId, !target.getHurtAnimation().isPlaying()};
+}
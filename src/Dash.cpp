@@ -12,4 +12,8 @@ Dash::Dash() : Movement("DASH", DEF_FORCE, DEF_ANIMATION_TIME, DEF_COOLDOWN) {
 }
 
 Dash::Dash(const double force, const double animationTime, const double cooldown) : Movement("DASH", force, animationTime, cooldown) {
-}
\ No newline at end of file
+}
+
+std::shared_ptr<Movement> Dash::clone() const {
+    return std::make_shared<Dash>(*this);
+}
@@ -0,0 +1,144 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "EnemyAI.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+void EnemyPerception::add(const int id, const Vector2D&position, const double follow, const double attack,
+                          const int ready, const int preferred, const std::uint32_t inSight) {
+    ids.push_back(id);
+    x.push_back(position.x);
+    y.push_back(position.y);
+    followRange.push_back(follow);
+    attackRange.push_back(attack);
+    readyAttack.push_back(static_cast<std::int8_t>(ready));
+    preferredTarget.push_back(static_cast<std::int8_t>(preferred));
+    targetsInSight.push_back(inSight);
+}
+
+void EnemyPerception::reserve(const std::size_t capacity) {
+    ids.reserve(capacity);
+    x.reserve(capacity);
+    y.reserve(capacity);
+    followRange.reserve(capacity);
+    attackRange.reserve(capacity);
+    readyAttack.reserve(capacity);
+    preferredTarget.reserve(capacity);
+    targetsInSight.reserve(capacity);
+}
+
+std::size_t EnemyPerception::size() const {
+    return ids.size();
+}
+
+void EnemyPerception::clear() {
+    ids.clear();
+    x.clear();
+    y.clear();
+    followRange.clear();
+    attackRange.clear();
+    readyAttack.clear();
+    preferredTarget.clear();
+    targetsInSight.clear();
+}
+
+void EnemyCommands::resize(const std::size_t count) {
+    runInputs.resize(count);
+    attacks.resize(count);
+    targets.resize(count);
+}
+
+std::size_t EnemyCommands::size() const {
+    return runInputs.size();
+}
+
+EnemyAI::EnemyAI(const unsigned workers, const std::size_t minBatch) : workers(workers), minBatch(minBatch) {
+    if (workers == 0) {
+        throw std::invalid_argument("Number of workers must be strictly positive");
+    }
+    if (minBatch == 0) {
+        throw std::invalid_argument("Batch size must be strictly positive");
+    }
+}
+
+void EnemyAI::setWorkers(const unsigned count) {
+    if (count == 0) {
+        throw std::invalid_argument("Number of workers must be strictly positive");
+    }
+    workers = count;
+}
+
+unsigned EnemyAI::getWorkers() const {
+    return workers;
+}
+
+void EnemyAI::decide(const EnemyPerception&perception, const Vector2D&target, EnemyCommands&commands) const {
+    decide(perception, std::span(&target, 1), commands);
+}
+
+void EnemyAI::decide(const EnemyPerception&perception, const std::span<const Vector2D> targets,
+                     EnemyCommands&commands) const {
+    const std::size_t count = perception.size();
+    commands.resize(count);
+    const std::size_t threads = std::min<std::size_t>(workers, std::max<std::size_t>(1, count / minBatch));
+    if (threads <= 1) {
+        decide(perception, targets, commands, 0, count);
+        return;
+    }
+    std::vector<std::jthread> pool;
+    pool.reserve(threads - 1);
+    for (std::size_t t = 1; t < threads; ++t) {
+        pool.emplace_back([&perception, targets, &commands, count, threads, t] {
+            decide(perception, targets, commands, count * t / threads, count * (t + 1) / threads);
+        });
+    }
+    decide(perception, targets, commands, 0, count / threads);
+}
+
+void EnemyAI::decide(const EnemyPerception&perception, const std::span<const Vector2D> targets,
+                     EnemyCommands&commands, const std::size_t begin, const std::size_t end) {
+    const double* x = perception.x.data();
+    const double* y = perception.y.data();
+    const double* follow = perception.followRange.data();
+    const double* reach = perception.attackRange.data();
+    const std::int8_t* ready = perception.readyAttack.data();
+    const std::int8_t* preferred = perception.preferredTarget.data();
+    const std::uint32_t* inSight = perception.targetsInSight.data();
+    double* runInputs = commands.runInputs.data();
+    std::int8_t* attacks = commands.attacks.data();
+    int* chosen = commands.targets.data();
+    if (targets.empty()) {
+        std::fill(runInputs + begin, runInputs + end, 0.0);
+        std::fill(attacks + begin, attacks + end, static_cast<std::int8_t>(-1));
+        std::fill(chosen + begin, chosen + end, -1);
+        return;
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+        const bool forced = preferred[i] >= 0 && static_cast<std::size_t>(preferred[i]) < targets.size();
+        int nearest = forced ? preferred[i] : 0;
+        double dx = targets[nearest].x - x[i];
+        double dy = targets[nearest].y - y[i];
+        double squared = dx * dx + dy * dy;
+        for (std::size_t t = 1; !forced && t < targets.size(); ++t) {
+            const double tx = targets[t].x - x[i];
+            const double ty = targets[t].y - y[i];
+            const double candidate = tx * tx + ty * ty;
+            if (candidate < squared) {
+                dx = tx;
+                dy = ty;
+                squared = candidate;
+                nearest = static_cast<int>(t);
+            }
+        }
+        const bool seen = static_cast<std::size_t>(nearest) < EnemyPerception::MAX_TARGETS_IN_SIGHT &&
+                          (inSight[i] >> nearest & 1u) != 0;
+        const bool inReach = seen && squared <= reach[i] * reach[i];
+        const bool following = !inReach && squared <= follow[i] * follow[i];
+        attacks[i] = inReach ? ready[i] : static_cast<std::int8_t>(-1);
+        runInputs[i] = following ? (dx >= 0 ? 1.0 : -1.0) : 0.0;
+        chosen[i] = inReach || squared <= follow[i] * follow[i] ? nearest : -1;
+    }
+}
@@ -0,0 +1,79 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "FlowField.hpp"
+#include <cmath>
+#include "GridCell.hpp"
+
+bool FlowField::update(NavigationGraph&navigation, const TileMap&tileMap, const Vector2D&position) {
+    if (!std::isfinite(position.x) || !std::isfinite(position.y)) {
+        return false;
+    }
+    target = position;
+    length = navigation.getLength();
+    height = navigation.getHeight();
+    areaSize = tileMap.getAreaTiles();
+    const int x = floorToCell(position.x / areaSize);
+    const int y = floorToCell(position.y / areaSize);
+    const std::size_t areas = static_cast<std::size_t>(length) * height;
+    if (x == targetX && y == targetY && waypoints.size() == areas) {
+        return false;
+    }
+    targetX = x;
+    targetY = y;
+    waypoints.assign(areas, {0.0, 0.0});
+    guided.assign(areas, 0);
+    for (int areaX = 0; areaX < length; ++areaX) {
+        for (int areaY = 0; areaY < height; ++areaY) {
+            const Direction2D gateway = navigation.getNextGateway(areaX, areaY, targetX, targetY);
+            if (gateway == Direction2D{0, 0}) {
+                continue;
+            }
+            // Aim half a tile past the border, so that reaching the waypoint means entering the next area.
+            const Vector2D center = tileMap.getGatewayCenter(areaX, areaY, gateway);
+            const std::size_t index = static_cast<std::size_t>(areaX) * height + areaY;
+            waypoints[index] = {center.x + 0.5 * gateway.first, center.y + 0.5 * gateway.second};
+            guided[index] = 1;
+        }
+    }
+    ++rebuilds;
+    return true;
+}
+
+Vector2D FlowField::getDirection(const Vector2D&position) const {
+    if (areaSize <= 0.0 || !std::isfinite(position.x) || !std::isfinite(position.y)) {
+        return {0.0, 0.0};
+    }
+    const int x = floorToCell(position.x / areaSize);
+    const int y = floorToCell(position.y / areaSize);
+    Vector2D waypoint = target;
+    if (x != targetX || y != targetY) {
+        if (x < 0 || y < 0 || x >= length || y >= height) {
+            return {0.0, 0.0};
+        }
+        const std::size_t index = static_cast<std::size_t>(x) * height + y;
+        if (!guided[index]) {
+            return {0.0, 0.0};
+        }
+        waypoint = waypoints[index];
+    }
+    const double dx = waypoint.x - position.x;
+    const double dy = waypoint.y - position.y;
+    const double norm = std::sqrt(dx * dx + dy * dy);
+    if (norm == 0.0) {
+        return {0.0, 0.0};
+    }
+    return {dx / norm, dy / norm};
+}
+
+void FlowField::getDirections(const std::vector<Vector2D>&positions, std::vector<Vector2D>&directions) const {
+    directions.resize(positions.size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        directions[i] = getDirection(positions[i]);
+    }
+}
+
+std::size_t FlowField::getRebuildCount() const {
+    return rebuilds;
+}
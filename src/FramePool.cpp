@@ -0,0 +1,74 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "FramePool.hpp"
+#include <new>
+#include <stdexcept>
+
+FramePool::FramePool(const std::size_t blockSize) : blockSize(blockSize) {
+    if (blockSize < HEADER_SIZE + sizeof(void*)) {
+        throw std::invalid_argument("Block size must hold the header and a pointer");
+    }
+}
+
+void FramePool::grow() {
+    // Rounded up so that every block stays aligned.
+    const std::size_t stride = (blockSize + HEADER_SIZE - 1) / HEADER_SIZE * HEADER_SIZE;
+    auto chunk = std::make_unique<std::byte[]>(stride * BLOCKS_PER_CHUNK);
+    for (std::size_t i = BLOCKS_PER_CHUNK; i-- > 0;) {
+        void* block = chunk.get() + i * stride;
+        *static_cast<void**>(block) = freeBlocks;
+        freeBlocks = block;
+    }
+    chunks.push_back(std::move(chunk));
+    capacity += BLOCKS_PER_CHUNK;
+}
+
+void* FramePool::allocate(const std::size_t size) {
+    void* block;
+    if (size + HEADER_SIZE > blockSize) {
+        block = ::operator new(size + HEADER_SIZE);
+        ++overflows;
+    }
+    else {
+        if (freeBlocks == nullptr) {
+            grow();
+        }
+        block = freeBlocks;
+        freeBlocks = *static_cast<void**>(block);
+        ++used;
+    }
+    *static_cast<FramePool**>(block) = this;
+    return static_cast<std::byte*>(block) + HEADER_SIZE;
+}
+
+void FramePool::deallocate(void* frame, const std::size_t size) {
+    void* block = static_cast<std::byte*>(frame) - HEADER_SIZE;
+    FramePool* pool = *static_cast<FramePool**>(block);
+    if (size + HEADER_SIZE > pool->blockSize) {
+        ::operator delete(block);
+        return;
+    }
+    *static_cast<void**>(block) = pool->freeBlocks;
+    pool->freeBlocks = block;
+    --pool->used;
+}
+
+void FramePool::reserve(const std::size_t blocks) {
+    while (capacity < blocks) {
+        grow();
+    }
+}
+
+std::size_t FramePool::getUsedBlocks() const {
+    return used;
+}
+
+std::size_t FramePool::getCapacity() const {
+    return capacity;
+}
+
+std::size_t FramePool::getOverflowCount() const {
+    return overflows;
+}
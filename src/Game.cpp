@@ -9,17 +9,122 @@
 #include "Game.hpp"
 
 #include "GameOverException.hpp"
-Game::Game(const int primaryAttack, const int secondaryAttack, const int tertiaryAttack) : activeLevel(-1), player(primaryAttack, secondaryAttack, tertiaryAttack), over(false) {
+#include "Snapshot.hpp"
+#include <array>
+Game::Game(const int primaryAttack, const int secondaryAttack, const int tertiaryAttack) : activeLevel(-1), over(false),
+    timeSinceDifficultyUpdate(std::chrono::steady_clock::now()) {
+    players.reserve(MAX_PLAYERS);
+    players.emplace_back(primaryAttack, secondaryAttack, tertiaryAttack);
+    playerIndex.emplace(players.front().getId(), 0);
+    threat.addPlayer(players.front().getId());
+    lastEnemyAIUpdate = std::chrono::steady_clock::now();
     next_level();
 }
 
+Player* Game::findPlayer(const int id) {
+    const auto it = playerIndex.find(id);
+    return it == playerIndex.end() ? nullptr : &players[it->second];
+}
+
+const Player* Game::findPlayer(const int id) const {
+    const auto it = playerIndex.find(id);
+    return it == playerIndex.end() ? nullptr : &players[it->second];
+}
+
+void Game::gatherTargets() {
+    targetIds.clear();
+    targetPositions.clear();
+    for (const Player&player: players) {
+        if (player.getHealth().current > 0) {
+            targetIds.push_back(player.getId());
+            targetPositions.push_back(player.getPosition());
+        }
+    }
+}
+
+void Game::onPlayerDeath(const int fallen) {
+    over = std::ranges::none_of(players, [fallen](const Player&player) {
+        return player.getId() != fallen && player.getHealth().current > 0;
+    });
+}
+
+int Game::addPlayer(const int primaryAttack, const int secondaryAttack, const int tertiaryAttack) {
+    const int attackCount = DefinedAttacks::size();
+    for (const int attack: {primaryAttack, secondaryAttack, tertiaryAttack}) {
+        if (attack < 0 || attack >= attackCount) {
+            return -1;
+        }
+    }
+    if (players.size() >= MAX_PLAYERS) {
+        return -1;
+    }
+    Player&player = players.emplace_back(primaryAttack, secondaryAttack, tertiaryAttack);
+    player.setPosition(players.front().getPosition());
+    playerIndex.emplace(player.getId(), players.size() - 1);
+    threat.addPlayer(player.getId());
+    return player.getId();
+}
+
+bool Game::removePlayer(const int id) {
+    const auto it = playerIndex.find(id);
+    if (it == playerIndex.end() || it->second == 0) {
+        return false;
+    }
+    const std::size_t index = it->second;
+    playerIndex.erase(it);
+    players.erase(players.begin() + static_cast<std::ptrdiff_t>(index));
+    for (std::size_t i = index; i < players.size(); ++i) {
+        playerIndex[players[i].getId()] = i;
+    }
+    threat.removePlayer(id);
+    statusEffects.removeCharacter(id);
+    // The game is over if the player leaving was the last one alive.
+    over = std::ranges::none_of(players, [](const Player&player) {
+        return player.getHealth().current > 0;
+    });
+    return true;
+}
+
+bool Game::isPlayer(const int id) const {
+    return playerIndex.contains(id);
+}
+
+std::vector<int> Game::getPlayerIds() const {
+    std::vector<int> ids;
+    ids.reserve(players.size());
+    for (const Player&player: players) {
+        ids.push_back(player.getId());
+    }
+    return ids;
+}
+
+std::size_t Game::getPlayerCount() const {
+    return players.size();
+}
+
+int Game::getNearestPlayer(const Vector2D&position) const {
+    int nearest = -1;
+    double best = 0.0;
+    for (const Player&player: players) {
+        if (player.getHealth().current <= 0) {
+            continue;
+        }
+        const double distance = player.getPosition().squaredDistanceTo(position);
+        if (nearest < 0 || distance < best) {
+            nearest = player.getId();
+            best = distance;
+        }
+    }
+    return nearest;
+}
+
 
 double Game::getCharacterSpeed(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getMovement("RUN")->getForce();
+    if (auto* player = findPlayer(id)) {
+        return player->getMovement("RUN")->getForce();
     }
     return levels.at(activeLevel).getEnemy(id).getMovement("RUN")->getForce();
 }
@@ -28,8 +133,8 @@ double Game::getCharacterJumpForce(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getMovement("JUMP")->getForce();
+    if (auto* player = findPlayer(id)) {
+        return player->getMovement("JUMP")->getForce();
     }
     return levels.at(activeLevel).getEnemy(id).getMovement("JUMP")->getForce();
 }
@@ -55,8 +160,8 @@ int Game::getDamage(const int id, const std::string&attackName) const {
     if (!isAValidAttackName(attackName)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getAttack(attackName).getDamage();
+    if (auto* player = findPlayer(id)) {
+        return player->getAttack(attackName).getDamage();
     }
     return levels.at(activeLevel).getEnemy(id).getAttack(attackName).getDamage();
 }
@@ -68,8 +173,8 @@ double Game::getChargeTime(const int id, const std::string&attackName) const {
     if (!isAValidAttackName(attackName)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getAttack(attackName).getChargeTime();
+    if (auto* player = findPlayer(id)) {
+        return player->getAttack(attackName).getChargeTime();
     }
     return levels.at(activeLevel).getEnemy(id).getAttack(attackName).getChargeTime();
 }
@@ -78,8 +183,8 @@ double Game::getCharacterHurtTime(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getHurtAnimation().getDuration();
+    if (auto* player = findPlayer(id)) {
+        return player->getHurtAnimation().getDuration();
     }
     return levels.at(activeLevel).getEnemy(id).getHurtAnimation().getDuration();
 }
@@ -88,8 +193,8 @@ int Game::getCharacterHealth(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getHealth().current;
+    if (auto* player = findPlayer(id)) {
+        return player->getHealth().current;
     }
     return levels.at(activeLevel).getEnemy(id).getHealth().current;
 }
@@ -98,8 +203,8 @@ int Game::getCharacterMaxHealth(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getHealth().max;
+    if (auto* player = findPlayer(id)) {
+        return player->getHealth().max;
     }
     return levels.at(activeLevel).getEnemy(id).getHealth().max;
 }
@@ -112,8 +217,8 @@ double Game::getCharacterAttackTime(const int id, const std::string& attackName)
         return -1;
     }
     try {
-        if (player.getId() == id) {
-            return player.getAttack(attackName).getAnimationTime();
+        if (auto* player = findPlayer(id)) {
+            return player->getAttack(attackName).getAnimationTime();
         }
         return levels.at(activeLevel).getEnemy(id).getAttack(attackName).getAnimationTime();
     }
@@ -129,8 +234,8 @@ double Game::getCharacterCoolDownAttack(const int id, const std::string& attackN
     if (!isAValidAttackName(attackName)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getAttack(attackName).getCooldown();
+    if (auto* player = findPlayer(id)) {
+        return player->getAttack(attackName).getCooldown();
     }
     return levels.at(activeLevel).getEnemy(id).getAttack(attackName).getCooldown();
 }
@@ -142,11 +247,28 @@ void Game::add_level(const Level&level) {
 }
 
 void Game::next_level() {
-    auto level = Level(++activeLevel);
-    levels.push_back(level.generate());
+    enterLevel(Level(activeLevel + 1).generate());
+}
+
+void Game::enterLevel(const Level&level) {
+    if (!level.isLoaded()) {
+        throw std::invalid_argument("The level must be loaded");
+    }
+    if (level.getId() != activeLevel + 1) {
+        throw std::invalid_argument("The level must follow the active level");
+    }
+    levels.push_back(level);
+    ++activeLevel;
     if (activeLevel != 0) {
         levels.at(activeLevel - 1).unload();
     }
+    spawnDirector.reset();
+    integrator.reset();
+    const std::vector<int> ids = getPlayerIds();
+    statusEffects.retainOnly(ids);
+    damageBuffer.clear();
+    behaviours.clear();
+    threat.clearEnemies();
 }
 
 Level Game::getActiveLevel() {
@@ -161,7 +283,7 @@ Level Game::getActiveLevel() {
 }
 
 int Game::get_area_guid_current_level(int x, int y) const {
-    if (!Level::isValidCoordinates(x, y)) {
+    if (!levels.at(activeLevel).isValidCoordinates(x, y)) {
         return -1;
     }
     if (!levels.at(activeLevel).isLoaded()) {
@@ -171,19 +293,24 @@ int Game::get_area_guid_current_level(int x, int y) const {
 }
 
 int Game::getPlayerMaxHealth() const {
-    return player.getHealth().max;
+    return players.front().getHealth().max;
 }
 
 int Game::getPlayerCurrentHealth() const {
-    return player.getHealth().current;
+    return players.front().getHealth().current;
 }
 
 void Game::takePlayerDamage(int damage) {
-    player.hurt(damage);
+    Player&host = players.front();
+    const bool wasHurt = host.getHurtAnimation().isPlaying();
+    host.hurt(damage);
+    if (!wasHurt) {
+        scheduleHurtTimer(host);
+    }
 }
 
 int Game::ifCanSpawnCurrentLevelSpawnAt(const int areaX, const int areaY, const int spawnId) {
-    if (!Level::isValidCoordinates(areaX, areaY)) {
+    if (!levels.at(activeLevel).isValidCoordinates(areaX, areaY)) {
         return -1;
     }
     if (levels.at(activeLevel).can_spawn_at(areaX, areaY, spawnId)) {
@@ -192,11 +319,598 @@ int Game::ifCanSpawnCurrentLevelSpawnAt(const int areaX, const int areaY, const
     return -1; // can't spawn
 }
 
+std::vector<SpawnEvent> Game::drainSpawnEvents(const int maxEvents) {
+    return levels.at(activeLevel).drainSpawnEvents(std::chrono::steady_clock::now(), maxEvents);
+}
+
+std::vector<TimerEvent> Game::drainTimerEvents(const int maxEvents) {
+    timers.advance(std::chrono::steady_clock::now(), dueTimers);
+    std::vector<TimerEvent> events;
+    std::size_t popped = 0;
+    for (; popped < dueTimers.size() && static_cast<int>(events.size()) < maxEvents; ++popped) {
+        if (isAValidId(dueTimers[popped].characterId)) {
+            events.push_back(dueTimers[popped]);
+        }
+    }
+    dueTimers.erase(dueTimers.begin(), dueTimers.begin() + static_cast<std::ptrdiff_t>(popped));
+    return events;
+}
+
+bool Game::getCharacterRemainingTimes(const int id, std::vector<double>&times) const {
+    if (!isAValidId(id)) {
+        times.clear();
+        return false;
+    }
+    times.resize(Character::REMAINING_TIME_COUNT);
+    const auto now = std::chrono::steady_clock::now();
+    if (auto* player = findPlayer(id)) {
+        player->getRemainingTimes(now, times);
+    }
+    else {
+        levels.at(activeLevel).getEnemy(id).getRemainingTimes(now, times);
+    }
+    return true;
+}
+
+void Game::getRemainingTimes(std::vector<int>&ids, std::vector<double>&times) const {
+    const Level&level = levels.at(activeLevel);
+    ids = getPlayerIds();
+    const std::vector<int> enemyIds = level.getEnemyIds();
+    ids.insert(ids.end(), enemyIds.begin(), enemyIds.end());
+    times.resize(ids.size() * Character::REMAINING_TIME_COUNT);
+    const auto now = std::chrono::steady_clock::now();
+    const std::span<double> rows(times);
+    for (std::size_t i = 0; i < players.size(); ++i) {
+        players[i].getRemainingTimes(now, rows.subspan(i * Character::REMAINING_TIME_COUNT,
+                                                       Character::REMAINING_TIME_COUNT));
+    }
+    for (std::size_t i = players.size(); i < ids.size(); ++i) {
+        level.getEnemy(ids[i]).getRemainingTimes(now, rows.subspan(i * Character::REMAINING_TIME_COUNT,
+                                                                   Character::REMAINING_TIME_COUNT));
+    }
+}
+
+void Game::getAttackStates(std::vector<int>&ids, std::vector<AttackState>&states) const {
+    const Level&level = levels.at(activeLevel);
+    ids = getPlayerIds();
+    const std::vector<int> enemyIds = level.getEnemyIds();
+    ids.insert(ids.end(), enemyIds.begin(), enemyIds.end());
+    const auto now = std::chrono::steady_clock::now();
+    states.clear();
+    for (const Player&player: players) {
+        states.push_back(player.getAttackState(now));
+    }
+    level.getEnemyAttackStates(now, states);
+}
+
+const Character& Game::getCharacter(const int id) const {
+    if (auto* player = findPlayer(id)) {
+        return *player;
+    }
+    return levels.at(activeLevel).findEnemy(id);
+}
+
+bool Game::startBehaviour(const int id, const int behaviour) {
+    const auto script = magic_enum::enum_cast<Behaviours>(behaviour);
+    if (!script.has_value() || isPlayer(id) || !isAValidId(id)) {
+        return false;
+    }
+    const Enemy&enemy = levels.at(activeLevel).findEnemy(id);
+    if (enemy.getHealth().current <= 0) {
+        return false;
+    }
+    std::string attackName;
+    for (int attack = 0; attack < DefinedAttacks::size() && attackName.empty(); ++attack) {
+        if (enemy.hasAttack(DefinedAttacks::getAttackName(attack))) {
+            attackName = DefinedAttacks::getAttackName(attack);
+        }
+    }
+    const BehaviourContext context{this, &behaviours, id, attackName, enemy.getFollowRange(), enemy.getAttackRange()};
+    behaviours.spawn(id, Behaviour::create(script.value(), context));
+    return true;
+}
+
+bool Game::stopBehaviour(const int id) {
+    if (behaviours.stop(id)) {
+        setCharacterRunInput(id, 0.0);
+        return true;
+    }
+    return false;
+}
+
+bool Game::hasBehaviour(const int id) const {
+    return behaviours.isRunning(id);
+}
+
+void Game::scheduleAttackTimers(const Character&character, const std::string&attackName) {
+    const Attack attack = character.getAttack(attackName);
+    const int capability = DefinedAttacks::getAttackValue(attackName);
+    timers.schedule({character.getId(), ATTACK_CHARGED, capability}, attack.getChargedTime());
+    timers.schedule({character.getId(), ATTACK_ENDED, capability}, attack.getEndTime());
+    timers.schedule({character.getId(), ATTACK_READY, capability}, attack.getReadyTime());
+}
+
+void Game::scheduleMovementTimers(const Character&character, const std::string&movementName) {
+    const int capability = DefinedMovements::getMovementIndex(movementName);
+    if (movementName == "JETPACK") {
+        timers.schedule({character.getId(), JETPACK_READY, capability}, character.getJetPack().getReadyTime());
+        return;
+    }
+    const auto movement = character.getMovement(movementName);
+    if (movement->getAnimationTime() <= 0 && movement->getCooldown() <= 0) {
+        return;
+    }
+    timers.schedule({character.getId(), MOVEMENT_ENDED, capability}, movement->getEndTime());
+    timers.schedule({character.getId(), MOVEMENT_READY, capability}, movement->getReadyTime());
+}
+
+void Game::scheduleHurtTimer(const Character&character) {
+    timers.schedule({character.getId(), HURT_ENDED, -1}, character.getHurtAnimation().getEndTime());
+}
+
+std::vector<int> Game::spawnReadyEnemies(const int budget) {
+    return levels.at(activeLevel).spawnReady(std::chrono::steady_clock::now(), budget, getDifficulty());
+}
+
+std::vector<int> Game::updateSpawnDirector(const int budget) {
+    updateGameDifficulty();
+    return spawnDirector.update(levels.at(activeLevel), std::chrono::steady_clock::now(), getDifficulty(), budget);
+}
+
+bool Game::getCharacterPosition(const int id, Vector2D&position) const {
+    if (!isAValidId(id)) {
+        return false;
+    }
+    if (auto* player = findPlayer(id)) {
+        position = player->getPosition();
+    }
+    else {
+        position = levels.at(activeLevel).getEnemy(id).getPosition();
+    }
+    return true;
+}
+
+void Game::setCharacterPosition(const int id, const Vector2D&position) {
+    if (isAValidId(id)) {
+        if (auto* player = findPlayer(id)) {
+            player->setPosition(position);
+        }
+        else {
+            levels.at(activeLevel).setEnemyPosition(id, position);
+        }
+    }
+}
+
+bool Game::getCharacterVelocity(const int id, Vector2D&velocity) const {
+    if (!isAValidId(id)) {
+        return false;
+    }
+    if (auto* player = findPlayer(id)) {
+        velocity = player->getVelocity();
+    }
+    else {
+        velocity = levels.at(activeLevel).getEnemy(id).getVelocity();
+    }
+    return true;
+}
+
+void Game::setCharacterVelocity(const int id, const Vector2D&velocity) {
+    if (isAValidId(id)) {
+        if (auto* player = findPlayer(id)) {
+            player->setVelocity(velocity);
+        }
+        else {
+            levels.at(activeLevel).setEnemyVelocity(id, velocity);
+        }
+    }
+}
+
+std::vector<int> Game::getEnemiesInFollowRange(const int targetId) const {
+    Vector2D target{};
+    if (!getCharacterPosition(targetId, target)) {
+        return {};
+    }
+    return levels.at(activeLevel).getEnemiesInFollowRange(target);
+}
+
+std::vector<int> Game::getEnemiesInAttackRange(const int targetId) const {
+    Vector2D target{};
+    if (!getCharacterPosition(targetId, target)) {
+        return {};
+    }
+    return levels.at(activeLevel).getEnemiesInAttackRange(target);
+}
+
+bool Game::canCharacterReach(const int id, const int targetId) const {
+    Vector2D from{};
+    Vector2D to{};
+    if (!getCharacterPosition(id, from) || !getCharacterPosition(targetId, to)) {
+        return false;
+    }
+    // Only enemies have an attack range, the reach of a player is only bounded by the tiles.
+    if (!isPlayer(id)) {
+        const double range = levels.at(activeLevel).getEnemy(id).getAttackRange();
+        if (from.squaredDistanceTo(to) > range * range) {
+            return false;
+        }
+    }
+    return levels.at(activeLevel).hasLineOfSight(from, to);
+}
+
+std::vector<int> Game::getEnemiesInReach(const int targetId) const {
+    Vector2D target{};
+    if (!getCharacterPosition(targetId, target)) {
+        return {};
+    }
+    return levels.at(activeLevel).getEnemiesInReach(target);
+}
+
+std::vector<int> Game::getEnemiesReadyToAttack(const int targetId) const {
+    Vector2D target{};
+    if (!getCharacterPosition(targetId, target)) {
+        return {};
+    }
+    return levels.at(activeLevel).getEnemiesReadyToAttack(target);
+}
+
+void Game::getEnemyReadiness(std::vector<int>&ids, std::vector<CooldownTable::Mask>&masks) const {
+    levels.at(activeLevel).getEnemyReadiness(ids, masks);
+}
+
+int Game::getEnemyTarget(const int enemyId) const {
+    if (isPlayer(enemyId) || !isAValidId(enemyId)) {
+        return -1;
+    }
+    const int target = threat.getTarget(enemyId);
+    if (const Player* player = findPlayer(target); player != nullptr && player->getHealth().current > 0) {
+        return target;
+    }
+    return getNearestPlayer(levels.at(activeLevel).findEnemy(enemyId).getPosition());
+}
+
+void Game::getEnemyTargets(std::vector<int>&ids, std::vector<int>&targets) const {
+    const Level&level = levels.at(activeLevel);
+    ids = level.getEnemyIds();
+    threat.getTargets(ids, targets);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        const Player* player = findPlayer(targets[i]);
+        if (player == nullptr || player->getHealth().current <= 0) {
+            targets[i] = getNearestPlayer(level.findEnemy(ids[i]).getPosition());
+        }
+    }
+}
+
+bool Game::taunt(const int playerId, const int enemyId) {
+    if (!isPlayer(playerId) || isPlayer(enemyId) || !isAValidId(enemyId)) {
+        return false;
+    }
+    threat.taunt(enemyId, playerId);
+    return true;
+}
+
+double Game::getThreat(const int enemyId, const int playerId) const {
+    return threat.getThreat(enemyId, playerId);
+}
+
+int Game::getAreaDistance(const int id, const int targetId) {
+    Vector2D from{};
+    Vector2D to{};
+    if (!getCharacterPosition(id, from) || !getCharacterPosition(targetId, to)) {
+        return -1;
+    }
+    const auto [fromX, fromY] = Level::getAreaAt(from);
+    const auto [toX, toY] = Level::getAreaAt(to);
+    return levels.at(activeLevel).getAreaDistance(fromX, fromY, toX, toY);
+}
+
+Direction2D Game::getNextGateway(const int id, const int targetId) {
+    Vector2D from{};
+    Vector2D to{};
+    if (!getCharacterPosition(id, from) || !getCharacterPosition(targetId, to)) {
+        return {0, 0};
+    }
+    const auto [fromX, fromY] = Level::getAreaAt(from);
+    const auto [toX, toY] = Level::getAreaAt(to);
+    return levels.at(activeLevel).getNextGateway(fromX, fromY, toX, toY);
+}
+
+void Game::getEnemyNextGateways(const int targetId, std::vector<int>&ids, std::vector<Direction2D>&gateways) {
+    Vector2D target{};
+    if (!getCharacterPosition(targetId, target)) {
+        ids.clear();
+        gateways.clear();
+        return;
+    }
+    levels.at(activeLevel).getEnemyNextGateways(target, ids, gateways);
+}
+
+void Game::getChaseDirections(const int targetId, std::vector<int>&ids, std::vector<Vector2D>&directions) {
+    Vector2D target{};
+    if (!getCharacterPosition(targetId, target)) {
+        ids.clear();
+        directions.clear();
+        return;
+    }
+    levels.at(activeLevel).getChaseDirections(target, ids, directions);
+}
+
+std::vector<LedgeLink> Game::planRoute(const int id, const int targetId) {
+    Vector2D from{};
+    Vector2D to{};
+    if (!getCharacterPosition(id, from) || !getCharacterPosition(targetId, to)) {
+        return {};
+    }
+    Level&level = levels.at(activeLevel);
+    const Player* player = findPlayer(id);
+    const MovementProfile profile = player != nullptr
+                                        ? MovementProfile::of(*player)
+                                        : MovementProfile::of(level.getEnemy(id));
+    return level.planRoute(profile, from, to);
+}
+
+bool Game::setActivationRadius(const int radius) {
+    if (radius < 0 && radius != InterestManager::UNLIMITED) {
+        return false;
+    }
+    activationRadius = radius;
+    return true;
+}
+
+int Game::getActivationRadius() const {
+    return activationRadius;
+}
+
+bool Game::isCharacterAwake(const int id) const {
+    if (!isAValidId(id)) {
+        return false;
+    }
+    return isPlayer(id) || levels.at(activeLevel).isEnemyAwake(id);
+}
+
+std::size_t Game::getAwakeEnemyCount() {
+    return levels.at(activeLevel).getAwakeEnemyCount();
+}
+
+std::vector<int> Game::getEnemyIds() const {
+    return levels.at(activeLevel).getEnemyIds();
+}
+
+void Game::setCharacterRunInput(const int id, const double input) {
+    if (isAValidId(id)) {
+        if (auto* player = findPlayer(id)) {
+            player->setRunInput(input);
+        }
+        else {
+            levels.at(activeLevel).setEnemyRunInput(id, input);
+        }
+    }
+}
+
+bool Game::addCharacterBuff(const int id, const int stat, const double added, const double multiplier,
+                            const double duration) {
+    const auto buffed = magic_enum::enum_cast<Stats>(stat);
+    if (!isAValidId(id) || !buffed.has_value() || multiplier < 0 || duration <= 0) {
+        return false;
+    }
+    const Modifier buff{
+        buffed.value(), BUFF, added, multiplier,
+        std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(duration))
+    };
+    if (auto* player = findPlayer(id)) {
+        player->addModifier(buff);
+    }
+    else {
+        levels.at(activeLevel).addEnemyModifier(id, buff);
+    }
+    return true;
+}
+
+int Game::applyStatusEffect(const std::vector<int>&ids, const int type, const double magnitude,
+                            const double duration) {
+    const auto effect = magic_enum::enum_cast<StatusEffectTypes>(type);
+    if (!effect.has_value() || magnitude < 0 || duration <= 0) {
+        return 0;
+    }
+    Level&level = levels.at(activeLevel);
+    const auto now = std::chrono::steady_clock::now();
+    const auto expiresAt = now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                               std::chrono::duration<double>(duration));
+    int affected = 0;
+    for (const int id: ids) {
+        if (!isAValidId(id)) {
+            continue;
+        }
+        statusEffects.apply(id, effect.value(), magnitude, now, expiresAt);
+        ++affected;
+        if (effect.value() == BURN) {
+            continue;
+        }
+        // A refreshed effect keeps its magnitude: its modifier is the one to extend.
+        const Modifier modifier = StatusEffectPool::modifierOf(*statusEffects.find(id, effect.value()));
+        if (auto* player = findPlayer(id)) {
+            player->refreshModifier(modifier);
+        }
+        else {
+            level.refreshEnemyModifier(id, modifier);
+        }
+    }
+    return affected;
+}
+
+double Game::getCharacterStatusEffectTime(const int id, const int type) const {
+    const auto effect = magic_enum::enum_cast<StatusEffectTypes>(type);
+    if (!isAValidId(id) || !effect.has_value()) {
+        return -1;
+    }
+    const StatusEffect* active = statusEffects.find(id, effect.value());
+    if (active == nullptr) {
+        return 0;
+    }
+    return std::max(0.0, std::chrono::duration<double>(active->expiresAt - std::chrono::steady_clock::now()).count());
+}
+
+void Game::getStatusEffects(std::vector<int>&ids, std::vector<int>&types, std::vector<double>&times) const {
+    const auto now = std::chrono::steady_clock::now();
+    const auto&effects = statusEffects.getEffects();
+    ids.resize(effects.size());
+    types.resize(effects.size());
+    times.resize(effects.size());
+    for (std::size_t i = 0; i < effects.size(); ++i) {
+        ids[i] = effects[i].characterId;
+        types[i] = effects[i].type;
+        times[i] = std::max(0.0, std::chrono::duration<double>(effects[i].expiresAt - now).count());
+    }
+}
+
+void Game::tickStatusEffects(const std::chrono::time_point<std::chrono::steady_clock> now) {
+    statusEffects.tick(now, statusTicks);
+    Level&level = levels.at(activeLevel);
+    for (const auto&[id, damage]: statusTicks) {
+        if (!isPlayer(id) && level.isAValidEnemyId(id)) {
+            level.bleedEnemy(id, damage);
+            if (level.findEnemy(id).getHealth().current <= 0) {
+                threat.removeEnemy(id);
+            }
+        }
+    }
+    for (Player&player: players) {
+        int playerDamage = 0;
+        for (const auto&[id, damage]: statusTicks) {
+            if (id == player.getId()) {
+                playerDamage += damage;
+            }
+        }
+        if (playerDamage > 0) {
+            try {
+                player.loseHealth(playerDamage);
+            } catch (GameOverException&) {
+                onPlayerDeath(player.getId());
+            }
+        }
+    }
+}
+
+int Game::updateEnemyAI() {
+    gatherTargets();
+    if (targetIds.empty()) {
+        return 0;
+    }
+    Level&level = levels.at(activeLevel);
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsed = std::min(std::chrono::duration<double>(now - lastEnemyAIUpdate).count(), MAX_THREAT_STEP);
+    lastEnemyAIUpdate = now;
+    level.updateReadiness(now);
+    perception.clear();
+    level.gatherEnemyPerception(perception, targetPositions, [this](const int id) { return behaviours.isRunning(id); });
+    // An enemy prefers the living player with the most threat on it.
+    threat.getTargets(perception.ids, threatTargets);
+    for (std::size_t i = 0; i < perception.size(); ++i) {
+        const auto preferred = std::ranges::find(targetIds, threatTargets[i]);
+        perception.preferredTarget[i] = static_cast<std::int8_t>(
+            threatTargets[i] >= 0 && preferred != targetIds.end() ? preferred - targetIds.begin() : -1);
+    }
+    enemyAI.decide(perception, targetPositions, enemyCommands);
+    level.applyEnemyRunInputs(perception, enemyCommands);
+    for (std::size_t i = 0; i < perception.size(); ++i) {
+        if (enemyCommands.targets[i] >= 0) {
+            threat.addThreat(perception.ids[i], targetIds[enemyCommands.targets[i]], ThreatTable::PROXIMITY_RATE * elapsed);
+        }
+    }
+    const bool deferred = deferredDamage;
+    deferredDamage = true;
+    int attacks = 0;
+    for (std::size_t i = 0; i < perception.size(); ++i) {
+        if (enemyCommands.attacks[i] >= 0) {
+            attack(perception.ids[i], DefinedAttacks::getAttackName(enemyCommands.attacks[i]),
+                   targetIds[enemyCommands.targets[i]]);
+            ++attacks;
+        }
+    }
+    deferredDamage = deferred;
+    if (!deferredDamage) {
+        resolveDamage();
+    }
+    return attacks;
+}
+
+void Game::setEnemyAI(const bool enabled) {
+    enemyAIEnabled = enabled;
+}
+
+bool Game::setEnemyAIWorkers(const int workers) {
+    if (workers <= 0) {
+        return false;
+    }
+    enemyAI.setWorkers(static_cast<unsigned>(workers));
+    return true;
+}
+
+int Game::stepPhysics(const double elapsedSeconds) {
+    resolveDamage();
+    Level&level = levels.at(activeLevel);
+    const auto now = std::chrono::steady_clock::now();
+    tickStatusEffects(now);
+    threat.advance(now);
+    playerPositions.clear();
+    for (Player&player: players) {
+        player.expireModifiers(now);
+        playerPositions.push_back(player.getPosition());
+    }
+    level.expireEnemyModifiers(now);
+    behaviours.tick(now);
+    level.setActivationRadius(activationRadius);
+    level.focusOn(playerPositions);
+    if (enemyAIEnabled) {
+        updateEnemyAI();
+    }
+    bodies.clear();
+    bodies.reserve(level.getEnemyCount() + players.size());
+    for (const Player&player: players) {
+        KinematicIntegrator::gather(player, level.getGroundHeight(player.getPosition()), bodies, now);
+    }
+    level.gatherEnemyBodies(bodies, now);
+    const int steps = integrator.advance(bodies, elapsedSeconds);
+    if (steps > 0) {
+        for (std::size_t i = 0; i < players.size(); ++i) {
+            KinematicIntegrator::scatter(bodies, i, players[i]);
+        }
+        level.scatterEnemyBodies(bodies, players.size());
+    }
+    projectileHits.clear();
+    gatherTargets();
+    level.stepProjectiles(elapsedSeconds, targetIds, targetPositions, projectileHits);
+    for (const DamageHit&hit: projectileHits) {
+        damageBuffer.push(hit);
+    }
+    if (!deferredDamage) {
+        resolveDamage();
+    }
+    level.updateReadiness(now);
+    return steps;
+}
+
+Tile Game::getTileAt(const int x, const int y) const {
+    return levels.at(activeLevel).getTileMap().at(x, y);
+}
+
+bool Game::overlapsSolidTile(const AABB&box) const {
+    return levels.at(activeLevel).getTileMap().overlapsSolid(box);
+}
+
+RayHit Game::raycast(const RaySegment&ray) const {
+    return levels.at(activeLevel).getTileMap().raycast(ray);
+}
+
+void Game::raycast(const std::vector<RaySegment>&rays, std::vector<RayHit>&hits) const {
+    levels.at(activeLevel).getTileMap().raycast(rays, hits);
+}
+
 int Game::getCharacterType(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
+    if (isPlayer(id)) {
         return 0;
     }
     try {
@@ -214,8 +928,8 @@ bool Game::canCharacterAttack(const int id, const std::string&attackName) const
     if (!isAValidAttackName(attackName)) {
         return false;
     }
-    if (player.getId() == id) {
-        return player.canUse(attackName);
+    if (auto* player = findPlayer(id)) {
+        return player->canUse(attackName);
     }
     return levels.at(activeLevel).getEnemy(id).canUse(attackName);
 }
@@ -224,38 +938,38 @@ bool Game::isCharacterBusy(const int id) const {
     if (!isAValidId(id)) {
         return false;
     }
-    if (player.getId() == id) {
-        return player.isBusy();
+    if (auto* player = findPlayer(id)) {
+        return player->isBusy();
     }
     return levels.at(activeLevel).getEnemy(id).isBusy();
 }
 
 double Game::getPlayerDashForce() const {
-    return player.getMovement("DASH")->getForce();
+    return players.front().getMovement("DASH")->getForce();
 }
 
 double Game::getJetPackForce() const {
-    return player.getJetPack().getForce();
+    return players.front().getJetPack().getForce();
 }
 
 double Game::getJetPackMaxTime() const {
-    return player.getJetPack().getMaxTime();
+    return players.front().getJetPack().getMaxTime();
 }
 
 double Game::getPlayerLandingTime() const {
-    return player.getJetPack().getLandAnimationTime();
+    return players.front().getJetPack().getLandAnimationTime();
 }
 
 double Game::getPlayerDashTime() const {
-    return player.getMovement("DASH")->getAnimationTime();
+    return players.front().getMovement("DASH")->getAnimationTime();
 }
 
 bool Game::isPlayerDashing() const {
-    return player.getMovement("DASH")->isUsing();
+    return players.front().getMovement("DASH")->isUsing();
 }
 
 bool Game::isPlayerUsingJetpack() const {
-    return player.getJetPack().isUsing();
+    return players.front().getJetPack().isUsing();
 }
 
 bool Game::canCharacterMove(const int id, const std::string&movementName) const {
@@ -265,21 +979,18 @@ bool Game::canCharacterMove(const int id, const std::string&movementName) const
     if (!isAValidMovementName(movementName)) {
         return false;
     }
-    if (player.getId() == id) {
-        return player.canMove(movementName);
+    if (auto* player = findPlayer(id)) {
+        return player->canMove(movementName);
     }
     return levels.at(activeLevel).getEnemy(id).canMove(movementName);
 }
 
 bool Game::isAValidId(const int id) const {
-    if (player.getId() == id) {
-        return true;
-    }
-    return levels.at(activeLevel).isAValidEnemyId(id);
+    return isPlayer(id) || levels.at(activeLevel).isAValidEnemyId(id);
 }
 
 int Game::getPlayerId() const {
-    return player.getId();
+    return players.front().getId();
 }
 
 std::tuple<std::tuple<int, int>, int> Game::getExistingSpawn() const {
@@ -303,11 +1014,13 @@ void Game::attack(const int id, const std::string& attackName, const int targetI
         throw std::invalid_argument("Invalid id");
     }
     if (targetId == -1) {
-        if (player.getId() == id) {
-            player.attack(attackName);
+        if (auto* player = findPlayer(id)) {
+            player->attack(attackName);
+            scheduleAttackTimers(*player, attackName);
             return;
         }
         levels.at(activeLevel).attackEnemy(id, attackName);
+        scheduleAttackTimers(levels.at(activeLevel).getEnemy(id), attackName);
         return;
     }
     if (!isAValidId(targetId)) {
@@ -316,22 +1029,204 @@ void Game::attack(const int id, const std::string& attackName, const int targetI
     if (!isAValidAttackName(attackName)) {
         throw std::invalid_argument("Invalid attack name");
     }
-    if (player.getId() == id) {
-        if (player.canUse(attackName)) {
-            const int damage = player.attack(attackName);
-            levels.at(activeLevel).hurtEnemy(targetId, damage);
+    if (auto* player = findPlayer(id)) {
+        // The players only hurt the enemies, never each other nor themselves.
+        if (isPlayer(targetId)) {
+            throw std::invalid_argument("A player cannot attack a player");
+        }
+        if (player->canUse(attackName)) {
+            const int damage = player->attack(attackName);
+            scheduleAttackTimers(*player, attackName);
+            damageBuffer.push({id, targetId, damage});
         }
     }
     else {
-        if (levels.at(activeLevel).getEnemy(id).canUse(attackName)) {
+        const Enemy&attacker = levels.at(activeLevel).findEnemy(id);
+        if (attacker.canUse(attackName)) {
+            // An enemy only hurts the players; when aimed at another enemy it hits its own target.
+            const int victim = isPlayer(targetId) ? targetId : getEnemyTarget(id);
             const int damage = levels.at(activeLevel).attackEnemy(id, attackName);
-            try {
-                player.hurt(damage);
-            } catch (GameOverException&) {
-                over = true;
+            scheduleAttackTimers(attacker, attackName);
+            if (victim >= 0) {
+                damageBuffer.push({id, victim, damage});
             }
         }
     }
+    if (!deferredDamage) {
+        resolveDamage();
+    }
+}
+
+std::vector<AreaHit> Game::attackArea(const int id, const std::string&attackName) {
+    if (!isAValidId(id)) {
+        throw std::invalid_argument("Invalid id");
+    }
+    if (!isAValidAttackName(attackName)) {
+        throw std::invalid_argument("Invalid attack name");
+    }
+    const AreaOfEffect area = DefinedAttacks::getAreaOfEffect(attackName);
+    if (area.shape == SINGLE_TARGET) {
+        throw std::invalid_argument("Not an area attack");
+    }
+    Level&level = levels.at(activeLevel);
+    std::vector<AreaHit> hits;
+    if (auto* player = findPlayer(id)) {
+        if (!player->canUse(attackName)) {
+            return hits;
+        }
+        const int damage = player->attack(attackName);
+        scheduleAttackTimers(*player, attackName);
+        level.findEnemiesInArea(player->getPosition(), player->getFacing(), area, damage, hits);
+        for (const AreaHit&hit: hits) {
+            damageBuffer.push({id, hit.characterId, hit.damage});
+        }
+        if (!deferredDamage) {
+            resolveDamage();
+        }
+        return hits;
+    }
+    if (!level.getEnemy(id).canUse(attackName)) {
+        return hits;
+    }
+    const int damage = level.attackEnemy(id, attackName);
+    const Enemy&attacker = level.getEnemy(id);
+    scheduleAttackTimers(attacker, attackName);
+    for (const Player&player: players) {
+        const Vector2D offset{player.getPosition().x - attacker.getPosition().x, player.getPosition().y - attacker.getPosition().y};
+        if (player.getHealth().current <= 0 || !area.contains(offset, attacker.getFacing())) {
+            continue;
+        }
+        hits.push_back({player.getId(), area.damageAt(damage, std::sqrt(player.getPosition().squaredDistanceTo(attacker.getPosition())))});
+        damageBuffer.push({id, player.getId(), hits.back().damage});
+    }
+    if (hits.empty()) {
+        return hits;
+    }
+    if (!deferredDamage) {
+        resolveDamage();
+    }
+    return hits;
+}
+
+int Game::shoot(const int id, const std::string&attackName, const Vector2D&direction) {
+    if (!isAValidId(id)) {
+        throw std::invalid_argument("Invalid id");
+    }
+    if (!isAValidAttackName(attackName)) {
+        throw std::invalid_argument("Invalid attack name");
+    }
+    const RangedProfile ranged = DefinedAttacks::getRangedProfile(attackName);
+    if (ranged.speed <= 0) {
+        throw std::invalid_argument("Not a ranged attack");
+    }
+    Level&level = levels.at(activeLevel);
+    Player* shooter = findPlayer(id);
+    if (!(shooter ? shooter->canUse(attackName) : level.findEnemy(id).canUse(attackName))) {
+        return -1;
+    }
+    int damage;
+    Vector2D position{};
+    int facing;
+    if (shooter) {
+        damage = shooter->attack(attackName);
+        scheduleAttackTimers(*shooter, attackName);
+        position = shooter->getPosition();
+        facing = shooter->getFacing();
+    }
+    else {
+        damage = level.attackEnemy(id, attackName);
+        const Enemy&shooter = level.getEnemy(id);
+        scheduleAttackTimers(shooter, attackName);
+        position = shooter.getPosition();
+        facing = shooter.getFacing();
+    }
+    const double length = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    const Vector2D unit = length > 0 ? Vector2D{direction.x / length, direction.y / length}
+                                     : Vector2D{static_cast<double>(facing), 0.0};
+    const Vector2D origin{position.x, position.y + ProjectilePool::HIT_HEIGHT};
+    return level.fireProjectile(id, shooter == nullptr, origin, {unit.x * ranged.speed, unit.y * ranged.speed}, damage,
+                                ranged.lifetime);
+}
+
+const ProjectilePool& Game::getProjectiles() const {
+    return levels.at(activeLevel).getProjectiles();
+}
+
+void Game::setDeferredDamage(const bool deferred) {
+    deferredDamage = deferred;
+    if (!deferred) {
+        resolveDamage();
+    }
+}
+
+bool Game::isDamageDeferred() const {
+    return deferredDamage;
+}
+
+void Game::resolveDamage() {
+    if (damageBuffer.empty()) {
+        return;
+    }
+    const std::span<const DamageHit> hits = damageBuffer.sortByTarget();
+    // The hits on each player form one group among the hits on the enemies; the runs between them go to the level.
+    std::array<std::pair<std::size_t, std::size_t>, MAX_PLAYERS> playerGroups;
+    std::size_t playerGroupCount = 0;
+    Level&level = levels.at(activeLevel);
+    damageResults.clear();
+    std::size_t enemyFirst = 0;
+    for (std::size_t first = 0; first < hits.size();) {
+        std::size_t last = first + 1;
+        while (last < hits.size() && hits[last].targetId == hits[first].targetId) {
+            ++last;
+        }
+        if (isPlayer(hits[first].targetId)) {
+            level.resolveEnemyHits(hits.subspan(enemyFirst, first - enemyFirst), damageResults);
+            playerGroups[playerGroupCount++] = {first, last};
+            enemyFirst = last;
+        }
+        first = last;
+    }
+    level.resolveEnemyHits(hits.subspan(enemyFirst), damageResults);
+    threat.addDamage(hits, damageResults);
+    for (const DamageResult&result: damageResults) {
+        if (result.hurtStarted) {
+            scheduleHurtTimer(level.getEnemy(result.targetId));
+        }
+        if (result.killerId >= 0) {
+            deaths.push_back({result.targetId, result.killerId});
+        }
+        // Only the alive enemies are hit: any of them without health died of these hits.
+        if (level.findEnemy(result.targetId).getHealth().current <= 0) {
+            threat.removeEnemy(result.targetId);
+        }
+    }
+    for (std::size_t group = 0; group < playerGroupCount; ++group) {
+        const auto [first, last] = playerGroups[group];
+        Player&player = *findPlayer(hits[first].targetId);
+        const DamageResult result = DamageBuffer::total(player, hits.subspan(first, last - first));
+        bool fallen = false;
+        try {
+            player.hurt(result.damage);
+        } catch (GameOverException&) {
+            fallen = true;
+            onPlayerDeath(player.getId());
+        }
+        if (result.hurtStarted && !fallen) {
+            scheduleHurtTimer(player);
+        }
+        // A teddy bear may have revived the player.
+        if (result.killerId >= 0 && player.getHealth().current <= 0) {
+            deaths.push_back({player.getId(), result.killerId});
+        }
+    }
+    damageBuffer.clear();
+}
+
+std::vector<DeathEvent> Game::drainDeathEvents(const int maxEvents) {
+    const auto count = static_cast<std::ptrdiff_t>(std::clamp(maxEvents, 0, static_cast<int>(deaths.size())));
+    std::vector<DeathEvent> events(deaths.begin(), deaths.begin() + count);
+    deaths.erase(deaths.begin(), deaths.begin() + count);
+    return events;
 }
 
 void Game::move(const int id, const std::string&movementName) {
@@ -341,15 +1236,14 @@ void Game::move(const int id, const std::string&movementName) {
     if (!isAValidMovementName(movementName)) {
         throw std::invalid_argument("Invalid movement name");
     }
-    if (player.getId() == id) {
-        if (player.canMove(movementName)) {
-            player.move(movementName);
+    if (auto* player = findPlayer(id)) {
+        if (player->canMove(movementName)) {
+            player->move(movementName);
+            scheduleMovementTimers(*player, movementName);
         }
     }
-    else {
-        if (levels.at(activeLevel).getEnemy(id).canMove(movementName)) {
-            levels.at(activeLevel).getEnemy(id).move(movementName);
-        }
+    else if (levels.at(activeLevel).moveEnemy(id, movementName)) {
+        scheduleMovementTimers(levels.at(activeLevel).getEnemy(id), movementName);
     }
 }
 
@@ -357,27 +1251,27 @@ bool Game::isCharacterOnGround(const int id) const {
     if (!isAValidId(id)) {
         return false;
     }
-    if (player.getId() == id) {
-        return player.isLanded();
+    if (auto* player = findPlayer(id)) {
+        return player->isLanded();
     }
     return levels.at(activeLevel).getEnemy(id).isLanded();
 }
 
 void Game::landCharacter(const int id) {
     if (isAValidId(id)) {
-        if (player.getId() == id) {
-            player.land();
+        if (auto* player = findPlayer(id)) {
+            player->land();
         }
         else {
-            levels.at(activeLevel).getEnemy(id).land();
+            levels.at(activeLevel).landEnemy(id);
         }
     }
 }
 
 void Game::takeOffCharacter(const int id) {
     if (isAValidId(id)) {
-        if (player.getId() == id) {
-            player.takeOff();
+        if (auto* player = findPlayer(id)) {
+            player->takeOff();
         }
         else {
             levels.at(activeLevel).getEnemy(id).takeOff();
@@ -389,8 +1283,8 @@ int Game::getMovingType(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.isMoving();
+    if (auto* player = findPlayer(id)) {
+        return player->isMoving();
     }
     return levels.at(activeLevel).getEnemy(id).isMoving();
 }
@@ -399,8 +1293,8 @@ int Game::isMoving(const int id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.isMoving();
+    if (auto* player = findPlayer(id)) {
+        return player->isMoving();
     }
     return levels.at(activeLevel).getEnemy(id).isMoving();
 }
@@ -409,8 +1303,8 @@ void Game::stopMoving(const int id, const std::string& type) {
     if (!isAValidId(id)) {
         return;
     }
-    if (player.getId() == id) {
-        player.stopMoving(type);
+    if (auto* player = findPlayer(id)) {
+        player->stopMoving(type);
     }
     else {
         levels.at(activeLevel).getEnemy(id).stopMoving(type);
@@ -435,11 +1329,11 @@ double Game::getCharacterCoolDownMovementTime(const int id, const std::string&st
     if (!isAValidMovementName(string)) {
         throw std::invalid_argument("Invalid movement name");
     }
-    if (player.getId() == id) {
+    if (auto* player = findPlayer(id)) {
         if (string == "JETPACK") {
-            return player.getJetPack().getCoolDown();
+            return player->getJetPack().getCoolDown();
         }
-        return player.getMovement(string)->getCooldown();
+        return player->getMovement(string)->getCooldown();
     }
     if (string == "JETPACK") {
         return levels.at(activeLevel).getEnemy(id).getJetPack().getCoolDown();
@@ -448,22 +1342,30 @@ double Game::getCharacterCoolDownMovementTime(const int id, const std::string&st
 }
 
 int Game::openChest(const int area_x, const int area_y, const int chest_id) {
+    return openChest(players.front().getId(), area_x, area_y, chest_id);
+}
+
+int Game::openChest(const int playerId, const int area_x, const int area_y, const int chest_id) {
+    Player* player = findPlayer(playerId);
+    if (player == nullptr) {
+        return -1;
+    }
     Item item = levels.at(activeLevel).openChest(area_x, area_y, chest_id);
     switch (DefinedItems::getId(item.getName())) {
         case HEALTH_POTION:
             // nop
             break;
         case HEALTH_BOOST:
-            player.increaseMaxHealth(item.use());
+            player->addModifier({MAX_HEALTH, ITEM, item.use()});
             break;
         case SPEED_BOOST:
-            player.increaseMovementForce("RUN", item.use());
+            player->addModifier({RUN_FORCE, ITEM, item.use()});
             break;
         case DAMAGE_BOOST:
-            player.increaseAttackDamage(item.use(), player.getAllAttackName());
+            player->addModifier({ATTACK_DAMAGE, ITEM, item.use()});
             break;
         case EXTRA_JUMP:
-            player.increaseMovementForce("JUMP", item.use());
+            player->addModifier({JUMP_COUNT, ITEM, item.use()});
             break;
         case TEDDY_BEAR:
             // nop
@@ -471,7 +1373,7 @@ int Game::openChest(const int area_x, const int area_y, const int chest_id) {
         default:
             throw std::invalid_argument("Invalid item");
     }
-    player.addItem(item);
+    player->addItem(item);
     return DefinedItems::getId(item.getName());
 }
 
@@ -483,8 +1385,8 @@ int Game::getNumberOfItem(const int id, const int item_id) const {
     if (!isAValidId(id)) {
         return -1;
     }
-    if (player.getId() == id) {
-        return player.getNumberOfItem(item_id);
+    if (auto* player = findPlayer(id)) {
+        return player->getNumberOfItem(item_id);
     }
     return levels.at(activeLevel).getEnemy(id).getNumberOfItem(item_id);
 }
@@ -512,15 +1414,15 @@ bool Game::isOver() const {
 }
 
 int Game::getPrimaryPlayerAttack() const {
-    return DefinedAttacks::getAttackValue(player.getAttackAt(0).getName());
+    return DefinedAttacks::getAttackValue(players.front().getAttackAt(0).getName());
 }
 
 int Game::getSecondaryPlayerAttack() const {
-    return DefinedAttacks::getAttackValue(player.getAttackAt(1).getName());
+    return DefinedAttacks::getAttackValue(players.front().getAttackAt(1).getName());
 }
 
 int Game::getTertiaryPlayerAttack() const {
-    return DefinedAttacks::getAttackValue(player.getAttackAt(2).getName());
+    return DefinedAttacks::getAttackValue(players.front().getAttackAt(2).getName());
 }
 
 bool Game::canEndCurrentLevel(const int bossId) const {
@@ -541,9 +1443,30 @@ void Game::nextLevel(const int bossId) {
     next_level();
 }
 
+void Game::saveSnapshot(const std::string&path) const {
+    Snapshot::save(*this, path);
+}
+
+void Game::loadSnapshot(const std::string&path) {
+    Snapshot::load(*this, path);
+}
+
+void Game::saveState(GameState&state) const {
+    Snapshot::capture(*this, state);
+}
+
+bool Game::restoreState(const GameState&state) {
+    return Snapshot::restore(*this, state);
+}
+
 void Game::useHealthPotionIfAvailable() {
-    if (player.getNumberOfItem(0) > 0 && player.getHealth().current < player.getHealth().max) {
-        player.useHealthPotion();
+    useHealthPotionIfAvailable(players.front().getId());
+}
+
+void Game::useHealthPotionIfAvailable(const int playerId) {
+    Player* player = findPlayer(playerId);
+    if (player != nullptr && player->getNumberOfItem(0) > 0 && player->getHealth().current < player->getHealth().max) {
+        player->useHealthPotion();
     }
 }
 
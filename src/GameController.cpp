@@ -6,7 +6,9 @@
 #endif
 #include "pch.h"
 #include "GameController.hpp"
+#include "GameState.hpp"
 #include "Movements.hpp"
+#include <algorithm>
 GameController::GameController(const int primaryAttack, const int secondaryAttack, const int tertiaryAttack) : game_(primaryAttack, secondaryAttack, tertiaryAttack) {
     
 }
@@ -31,6 +33,329 @@ int GameController::ifCanSpawnCurrentLevelSpawnAt(const int x, const int y, cons
     return game_.ifCanSpawnCurrentLevelSpawnAt(x, y, id);
 }
 
+int GameController::drainSpawnEvents(int* areaX, int* areaY, int* spawnIds, const int capacity) {
+    const auto events = game_.drainSpawnEvents(capacity);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        areaX[i] = events[i].areaX;
+        areaY[i] = events[i].areaY;
+        spawnIds[i] = events[i].spawnId;
+    }
+    return static_cast<int>(events.size());
+}
+
+int GameController::drainTimerEvents(int* characterIds, int* types, int* capabilities, const int capacity) {
+    const auto events = game_.drainTimerEvents(capacity);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        characterIds[i] = events[i].characterId;
+        types[i] = events[i].type;
+        capabilities[i] = events[i].capability;
+    }
+    return static_cast<int>(events.size());
+}
+
+bool GameController::getCharacterRemainingTimes(const int id, double* times) const {
+    std::vector<double> remaining;
+    if (!game_.getCharacterRemainingTimes(id, remaining)) {
+        return false;
+    }
+    std::ranges::copy(remaining, times);
+    return true;
+}
+
+int GameController::getRemainingTimes(int* ids, double* times, const int capacity) const {
+    std::vector<int> characters;
+    std::vector<double> remaining;
+    game_.getRemainingTimes(characters, remaining);
+    const int count = std::min(capacity, static_cast<int>(characters.size()));
+    std::copy_n(characters.begin(), count, ids);
+    std::copy_n(remaining.begin(), count * Character::REMAINING_TIME_COUNT, times);
+    return count;
+}
+
+int GameController::getAttackPhases(int* ids, int* attacks, int* phases, double* progress, const int capacity) const {
+    std::vector<int> characters;
+    std::vector<AttackState> states;
+    game_.getAttackStates(characters, states);
+    const int count = std::min(capacity, static_cast<int>(characters.size()));
+    for (int i = 0; i < count; ++i) {
+        ids[i] = characters[i];
+        attacks[i] = states[i].attack;
+        phases[i] = states[i].phase;
+        progress[i] = states[i].progress;
+    }
+    return count;
+}
+
+bool GameController::startBehaviour(const int id, const int behaviour) {
+    return game_.startBehaviour(id, behaviour);
+}
+
+bool GameController::stopBehaviour(const int id) {
+    return game_.stopBehaviour(id);
+}
+
+bool GameController::hasBehaviour(const int id) const {
+    return game_.hasBehaviour(id);
+}
+
+bool GameController::addCharacterBuff(const int id, const int stat, const double added, const double multiplier,
+                                      const double duration) {
+    return game_.addCharacterBuff(id, stat, added, multiplier, duration);
+}
+
+int GameController::applyStatusEffect(const int* ids, const int count, const int type, const double magnitude,
+                                      const double duration) {
+    return game_.applyStatusEffect(std::vector<int>(ids, ids + count), type, magnitude, duration);
+}
+
+double GameController::getCharacterStatusEffectTime(const int id, const int type) const {
+    return game_.getCharacterStatusEffectTime(id, type);
+}
+
+int GameController::getStatusEffects(int* ids, int* types, double* times, const int capacity) const {
+    std::vector<int> characters;
+    std::vector<int> effects;
+    std::vector<double> remaining;
+    game_.getStatusEffects(characters, effects, remaining);
+    const int count = std::min(capacity, static_cast<int>(characters.size()));
+    std::copy_n(characters.begin(), count, ids);
+    std::copy_n(effects.begin(), count, types);
+    std::copy_n(remaining.begin(), count, times);
+    return count;
+}
+
+int GameController::spawnReadyEnemies(int* enemyIds, const int budget) {
+    const auto ids = game_.spawnReadyEnemies(budget);
+    std::ranges::copy(ids, enemyIds);
+    return static_cast<int>(ids.size());
+}
+
+int GameController::updateSpawnDirector(int* enemyIds, const int budget) {
+    const auto ids = game_.updateSpawnDirector(budget);
+    std::ranges::copy(ids, enemyIds);
+    return static_cast<int>(ids.size());
+}
+
+bool GameController::getCharacterPosition(const int id, double* x, double* y) const {
+    Vector2D position{};
+    if (!game_.getCharacterPosition(id, position)) {
+        return false;
+    }
+    *x = position.x;
+    *y = position.y;
+    return true;
+}
+
+void GameController::setCharacterPosition(const int id, const double x, const double y) {
+    game_.setCharacterPosition(id, {x, y});
+}
+
+bool GameController::getCharacterVelocity(const int id, double* vx, double* vy) const {
+    Vector2D velocity{};
+    if (!game_.getCharacterVelocity(id, velocity)) {
+        return false;
+    }
+    *vx = velocity.x;
+    *vy = velocity.y;
+    return true;
+}
+
+void GameController::setCharacterVelocity(const int id, const double vx, const double vy) {
+    game_.setCharacterVelocity(id, {vx, vy});
+}
+
+int GameController::getEnemiesInFollowRange(const int targetId, int* enemyIds, const int capacity) const {
+    const auto ids = game_.getEnemiesInFollowRange(targetId);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    std::copy_n(ids.begin(), count, enemyIds);
+    return count;
+}
+
+int GameController::getEnemiesInAttackRange(const int targetId, int* enemyIds, const int capacity) const {
+    const auto ids = game_.getEnemiesInAttackRange(targetId);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    std::copy_n(ids.begin(), count, enemyIds);
+    return count;
+}
+
+int GameController::getEnemyPositions(int* enemyIds, double* xs, double* ys, const int capacity) const {
+    const auto ids = game_.getEnemyIds();
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    for (int i = 0; i < count; ++i) {
+        Vector2D position{};
+        game_.getCharacterPosition(ids[i], position);
+        enemyIds[i] = ids[i];
+        xs[i] = position.x;
+        ys[i] = position.y;
+    }
+    return count;
+}
+
+void GameController::setCharacterRunInput(const int id, const double input) {
+    game_.setCharacterRunInput(id, input);
+}
+
+int GameController::updateEnemyAI() {
+    return game_.updateEnemyAI();
+}
+
+void GameController::setEnemyAI(const bool enabled) {
+    game_.setEnemyAI(enabled);
+}
+
+bool GameController::setEnemyAIWorkers(const int workers) {
+    return game_.setEnemyAIWorkers(workers);
+}
+
+int GameController::stepPhysics(const double elapsedSeconds) {
+    return game_.stepPhysics(elapsedSeconds);
+}
+
+int GameController::getTileAt(const int x, const int y) const {
+    return game_.getTileAt(x, y).getBits();
+}
+
+bool GameController::boxOverlapsSolid(const double minX, const double minY, const double maxX, const double maxY) const {
+    return game_.overlapsSolidTile({{minX, minY}, {maxX, maxY}});
+}
+
+bool GameController::raycast(const double fromX, const double fromY, const double toX, const double toY, double* hitX,
+                             double* hitY) const {
+    const RayHit hit = game_.raycast({{fromX, fromY}, {toX, toY}});
+    *hitX = hit.point.x;
+    *hitY = hit.point.y;
+    return hit.blocked;
+}
+
+void GameController::raycastBatch(const double* segments, int* blocked, const int count) const {
+    std::vector<RaySegment> rays;
+    rays.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const double* segment = segments + 4 * i;
+        rays.push_back({{segment[0], segment[1]}, {segment[2], segment[3]}});
+    }
+    std::vector<RayHit> hits;
+    game_.raycast(rays, hits);
+    for (int i = 0; i < count; ++i) {
+        blocked[i] = hits[i].blocked;
+    }
+}
+
+bool GameController::canCharacterReach(const int id, const int targetId) const {
+    return game_.canCharacterReach(id, targetId);
+}
+
+int GameController::getEnemiesInReach(const int targetId, int* enemyIds, const int capacity) const {
+    const auto ids = game_.getEnemiesInReach(targetId);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    std::copy_n(ids.begin(), count, enemyIds);
+    return count;
+}
+
+int GameController::getEnemiesReadyToAttack(const int targetId, int* enemyIds, const int capacity) const {
+    const auto ids = game_.getEnemiesReadyToAttack(targetId);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    std::copy_n(ids.begin(), count, enemyIds);
+    return count;
+}
+
+int GameController::getEnemyReadiness(int* enemyIds, int* masks, const int capacity) const {
+    std::vector<int> ids;
+    std::vector<CooldownTable::Mask> readiness;
+    game_.getEnemyReadiness(ids, readiness);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    std::copy_n(ids.begin(), count, enemyIds);
+    std::copy_n(readiness.begin(), count, masks);
+    return count;
+}
+
+int GameController::getEnemyTarget(const int enemyId) const {
+    return game_.getEnemyTarget(enemyId);
+}
+
+int GameController::getEnemyTargets(int* enemyIds, int* playerIds, const int capacity) const {
+    std::vector<int> ids;
+    std::vector<int> targets;
+    game_.getEnemyTargets(ids, targets);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    std::copy_n(ids.begin(), count, enemyIds);
+    std::copy_n(targets.begin(), count, playerIds);
+    return count;
+}
+
+bool GameController::taunt(const int playerId, const int enemyId) {
+    return game_.taunt(playerId, enemyId);
+}
+
+double GameController::getThreat(const int enemyId, const int playerId) const {
+    return game_.getThreat(enemyId, playerId);
+}
+
+int GameController::getAreaDistance(const int id, const int targetId) {
+    return game_.getAreaDistance(id, targetId);
+}
+
+bool GameController::getNextGateway(const int id, const int targetId, int* directionX, int* directionY) {
+    const Direction2D gateway = game_.getNextGateway(id, targetId);
+    *directionX = gateway.first;
+    *directionY = gateway.second;
+    return gateway != Direction2D{0, 0};
+}
+
+int GameController::getEnemyNextGateways(const int targetId, int* enemyIds, int* directionsX, int* directionsY,
+                                         const int capacity) {
+    std::vector<int> ids;
+    std::vector<Direction2D> gateways;
+    game_.getEnemyNextGateways(targetId, ids, gateways);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    for (int i = 0; i < count; ++i) {
+        enemyIds[i] = ids[i];
+        directionsX[i] = gateways[i].first;
+        directionsY[i] = gateways[i].second;
+    }
+    return count;
+}
+
+int GameController::getChaseDirections(const int targetId, int* enemyIds, double* directionsX, double* directionsY,
+                                       const int capacity) {
+    std::vector<int> ids;
+    std::vector<Vector2D> directions;
+    game_.getChaseDirections(targetId, ids, directions);
+    const int count = std::min(capacity, static_cast<int>(ids.size()));
+    for (int i = 0; i < count; ++i) {
+        enemyIds[i] = ids[i];
+        directionsX[i] = directions[i].x;
+        directionsY[i] = directions[i].y;
+    }
+    return count;
+}
+
+int GameController::planRoute(const int id, const int targetId, int* movements, double* points, const int capacity) {
+    const auto route = game_.planRoute(id, targetId);
+    const int count = std::min(capacity, static_cast<int>(route.size()));
+    for (int i = 0; i < count; ++i) {
+        movements[i] = route[i].movement;
+        double* point = points + 4 * i;
+        point[0] = route[i].takeoff.x;
+        point[1] = route[i].takeoff.y;
+        point[2] = route[i].landing.x;
+        point[3] = route[i].landing.y;
+    }
+    return count;
+}
+
+bool GameController::setActivationRadius(const int radius) {
+    return game_.setActivationRadius(radius);
+}
+
+bool GameController::isCharacterAwake(const int id) const {
+    return game_.isCharacterAwake(id);
+}
+
+int GameController::getAwakeEnemyCount() {
+    return static_cast<int>(game_.getAwakeEnemyCount());
+}
+
 int GameController::getCharacterType(const int id) const {
     return game_.getCharacterType(id);
 }
@@ -123,6 +448,49 @@ void GameController::attack(const int id, const int attackIndex, int targetId) {
     game_.attack(id, getAttackName(attackIndex), targetId);
 }
 
+int GameController::attackArea(const int id, const int attackIndex, int* ids, int* damages, const int capacity) {
+    const auto hits = game_.attackArea(id, getAttackName(attackIndex));
+    const int count = std::min(capacity, static_cast<int>(hits.size()));
+    for (int i = 0; i < count; ++i) {
+        ids[i] = hits[i].characterId;
+        damages[i] = hits[i].damage;
+    }
+    return count;
+}
+
+void GameController::setDeferredDamage(const bool deferred) {
+    game_.setDeferredDamage(deferred);
+}
+
+void GameController::resolveDamage() {
+    game_.resolveDamage();
+}
+
+int GameController::drainDeathEvents(int* victims, int* killers, const int capacity) {
+    const auto events = game_.drainDeathEvents(capacity);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        victims[i] = events[i].victimId;
+        killers[i] = events[i].killerId;
+    }
+    return static_cast<int>(events.size());
+}
+
+int GameController::shoot(const int id, const int attackIndex, const double directionX, const double directionY) {
+    return game_.shoot(id, getAttackName(attackIndex), {directionX, directionY});
+}
+
+int GameController::getProjectiles(int* ids, double* xs, double* ys, double* velocitiesX, double* velocitiesY,
+                                   const int capacity) const {
+    const ProjectilePool&projectiles = game_.getProjectiles();
+    const int count = std::min(capacity, static_cast<int>(projectiles.size()));
+    std::copy_n(projectiles.getIds().begin(), count, ids);
+    std::copy_n(projectiles.getPositionsX().begin(), count, xs);
+    std::copy_n(projectiles.getPositionsY().begin(), count, ys);
+    std::copy_n(projectiles.getVelocitiesX().begin(), count, velocitiesX);
+    std::copy_n(projectiles.getVelocitiesY().begin(), count, velocitiesY);
+    return count;
+}
+
 void GameController::move(const int id, const int attackIndex) {
     game_.move(id, getMovementName(attackIndex));
 }
@@ -131,6 +499,25 @@ int GameController::getPlayerId() const {
     return game_.getPlayerId();
 }
 
+int GameController::addPlayer(const int primaryAttack, const int secondaryAttack, const int tertiaryAttack) {
+    return game_.addPlayer(primaryAttack, secondaryAttack, tertiaryAttack);
+}
+
+bool GameController::removePlayer(const int id) {
+    return game_.removePlayer(id);
+}
+
+int GameController::getPlayerIds(int* ids, const int capacity) const {
+    const auto playerIds = game_.getPlayerIds();
+    const int count = std::min(capacity, static_cast<int>(playerIds.size()));
+    std::copy_n(playerIds.begin(), count, ids);
+    return count;
+}
+
+int GameController::getPlayerCount() const {
+    return static_cast<int>(game_.getPlayerCount());
+}
+
 bool GameController::isCharacterBusy(const int id) const {
     return game_.isCharacterBusy(id);
 }
@@ -175,6 +562,10 @@ int GameController::openChest(const int areaX, const int areaY, const int chestI
     return game_.openChest(areaX, areaY, chestId);
 }
 
+int GameController::openChestForPlayer(const int playerId, const int areaX, const int areaY, const int chestId) {
+    return game_.openChest(playerId, areaX, areaY, chestId);
+}
+
 int GameController::getNumberOfItem(const int id, const int itemId) const {
     return game_.getNumberOfItem(id, itemId);
 }
@@ -203,6 +594,10 @@ void GameController::useHealthPotionIfAvailable() {
     game_.useHealthPotionIfAvailable();   
 }
 
+void GameController::useHealthPotionForPlayer(const int playerId) {
+    game_.useHealthPotionIfAvailable(playerId);
+}
+
 GameController* newGame(int primaryAttack, int secondaryAttack, int tertiaryAttack) {
     return new GameController(primaryAttack, secondaryAttack, tertiaryAttack);
 }
@@ -231,6 +626,200 @@ int ifCanSpawnCurrentLevelSpawnAt(GameController* game_controller, int x, int y,
     return game_controller->ifCanSpawnCurrentLevelSpawnAt(x, y, id);
 }
 
+int drainSpawnEvents(GameController* game_controller, int* areaX, int* areaY, int* spawnIds, int capacity) {
+    return game_controller->drainSpawnEvents(areaX, areaY, spawnIds, capacity);
+}
+
+int drainTimerEvents(GameController* game_controller, int* characterIds, int* types, int* capabilities, int capacity) {
+    return game_controller->drainTimerEvents(characterIds, types, capabilities, capacity);
+}
+
+int getRemainingTimeCount() {
+    return static_cast<int>(Character::REMAINING_TIME_COUNT);
+}
+
+bool getCharacterRemainingTimes(const GameController* game_controller, int id, double* times) {
+    return game_controller->getCharacterRemainingTimes(id, times);
+}
+
+int getRemainingTimes(const GameController* game_controller, int* ids, double* times, int capacity) {
+    return game_controller->getRemainingTimes(ids, times, capacity);
+}
+
+int getAttackPhases(const GameController* game_controller, int* ids, int* attacks, int* phases, double* progress,
+                    int capacity) {
+    return game_controller->getAttackPhases(ids, attacks, phases, progress, capacity);
+}
+
+bool startBehaviour(GameController* game_controller, int id, int behaviour) {
+    return game_controller->startBehaviour(id, behaviour);
+}
+
+bool stopBehaviour(GameController* game_controller, int id) {
+    return game_controller->stopBehaviour(id);
+}
+
+bool hasBehaviour(const GameController* game_controller, int id) {
+    return game_controller->hasBehaviour(id);
+}
+
+bool addCharacterBuff(GameController* game_controller, int id, int stat, double added, double multiplier,
+                      double duration) {
+    return game_controller->addCharacterBuff(id, stat, added, multiplier, duration);
+}
+
+int applyStatusEffect(GameController* game_controller, const int* ids, int count, int type, double magnitude,
+                      double duration) {
+    return game_controller->applyStatusEffect(ids, count, type, magnitude, duration);
+}
+
+double getCharacterStatusEffectTime(const GameController* game_controller, int id, int type) {
+    return game_controller->getCharacterStatusEffectTime(id, type);
+}
+
+int getStatusEffects(const GameController* game_controller, int* ids, int* types, double* times, int capacity) {
+    return game_controller->getStatusEffects(ids, types, times, capacity);
+}
+
+int spawnReadyEnemies(GameController* game_controller, int* enemyIds, int budget) {
+    return game_controller->spawnReadyEnemies(enemyIds, budget);
+}
+
+int updateSpawnDirector(GameController* game_controller, int* enemyIds, int budget) {
+    return game_controller->updateSpawnDirector(enemyIds, budget);
+}
+
+bool getCharacterPosition(const GameController* game_controller, int id, double* x, double* y) {
+    return game_controller->getCharacterPosition(id, x, y);
+}
+
+void setCharacterPosition(GameController* game_controller, int id, double x, double y) {
+    game_controller->setCharacterPosition(id, x, y);
+}
+
+bool getCharacterVelocity(const GameController* game_controller, int id, double* vx, double* vy) {
+    return game_controller->getCharacterVelocity(id, vx, vy);
+}
+
+void setCharacterVelocity(GameController* game_controller, int id, double vx, double vy) {
+    game_controller->setCharacterVelocity(id, vx, vy);
+}
+
+int getEnemiesInFollowRange(const GameController* game_controller, int targetId, int* enemyIds, int capacity) {
+    return game_controller->getEnemiesInFollowRange(targetId, enemyIds, capacity);
+}
+
+int getEnemiesInAttackRange(const GameController* game_controller, int targetId, int* enemyIds, int capacity) {
+    return game_controller->getEnemiesInAttackRange(targetId, enemyIds, capacity);
+}
+
+int getEnemyPositions(const GameController* game_controller, int* enemyIds, double* xs, double* ys, int capacity) {
+    return game_controller->getEnemyPositions(enemyIds, xs, ys, capacity);
+}
+
+void setCharacterRunInput(GameController* game_controller, int id, double input) {
+    game_controller->setCharacterRunInput(id, input);
+}
+
+int updateEnemyAI(GameController* game_controller) {
+    return game_controller->updateEnemyAI();
+}
+
+void setEnemyAI(GameController* game_controller, bool enabled) {
+    game_controller->setEnemyAI(enabled);
+}
+
+bool setEnemyAIWorkers(GameController* game_controller, int workers) {
+    return game_controller->setEnemyAIWorkers(workers);
+}
+
+int stepPhysics(GameController* game_controller, double elapsedSeconds) {
+    return game_controller->stepPhysics(elapsedSeconds);
+}
+
+int getTileAt(const GameController* game_controller, int x, int y) {
+    return game_controller->getTileAt(x, y);
+}
+
+bool boxOverlapsSolid(const GameController* game_controller, double minX, double minY, double maxX, double maxY) {
+    return game_controller->boxOverlapsSolid(minX, minY, maxX, maxY);
+}
+
+bool raycast(const GameController* game_controller, double fromX, double fromY, double toX, double toY, double* hitX,
+             double* hitY) {
+    return game_controller->raycast(fromX, fromY, toX, toY, hitX, hitY);
+}
+
+void raycastBatch(const GameController* game_controller, const double* segments, int* blocked, int count) {
+    game_controller->raycastBatch(segments, blocked, count);
+}
+
+bool canCharacterReach(const GameController* game_controller, int id, int targetId) {
+    return game_controller->canCharacterReach(id, targetId);
+}
+
+int getEnemiesInReach(const GameController* game_controller, int targetId, int* enemyIds, int capacity) {
+    return game_controller->getEnemiesInReach(targetId, enemyIds, capacity);
+}
+
+int getEnemiesReadyToAttack(const GameController* game_controller, int targetId, int* enemyIds, int capacity) {
+    return game_controller->getEnemiesReadyToAttack(targetId, enemyIds, capacity);
+}
+
+int getEnemyReadiness(const GameController* game_controller, int* enemyIds, int* masks, int capacity) {
+    return game_controller->getEnemyReadiness(enemyIds, masks, capacity);
+}
+
+int getEnemyTarget(const GameController* game_controller, int enemyId) {
+    return game_controller->getEnemyTarget(enemyId);
+}
+
+int getEnemyTargets(const GameController* game_controller, int* enemyIds, int* playerIds, int capacity) {
+    return game_controller->getEnemyTargets(enemyIds, playerIds, capacity);
+}
+
+bool taunt(GameController* game_controller, int playerId, int enemyId) {
+    return game_controller->taunt(playerId, enemyId);
+}
+
+double getThreat(const GameController* game_controller, int enemyId, int playerId) {
+    return game_controller->getThreat(enemyId, playerId);
+}
+
+int getAreaDistance(GameController* game_controller, int id, int targetId) {
+    return game_controller->getAreaDistance(id, targetId);
+}
+
+bool getNextGateway(GameController* game_controller, int id, int targetId, int* directionX, int* directionY) {
+    return game_controller->getNextGateway(id, targetId, directionX, directionY);
+}
+
+int getEnemyNextGateways(GameController* game_controller, int targetId, int* enemyIds, int* directionsX,
+                         int* directionsY, int capacity) {
+    return game_controller->getEnemyNextGateways(targetId, enemyIds, directionsX, directionsY, capacity);
+}
+
+int getChaseDirections(GameController* game_controller, int targetId, int* enemyIds, double* directionsX,
+                       double* directionsY, int capacity) {
+    return game_controller->getChaseDirections(targetId, enemyIds, directionsX, directionsY, capacity);
+}
+
+int planRoute(GameController* game_controller, int id, int targetId, int* movements, double* points, int capacity) {
+    return game_controller->planRoute(id, targetId, movements, points, capacity);
+}
+
+bool setActivationRadius(GameController* game_controller, int radius) {
+    return game_controller->setActivationRadius(radius);
+}
+
+bool isCharacterAwake(const GameController* game_controller, int id) {
+    return game_controller->isCharacterAwake(id);
+}
+
+int getAwakeEnemyCount(GameController* game_controller) {
+    return game_controller->getAwakeEnemyCount();
+}
+
 int getCharacterType(const GameController* game_controller, int id) {
     return game_controller->getCharacterType(id);
 }
@@ -307,10 +896,51 @@ int getPlayerId(const GameController* game_controller) {
     return game_controller->getPlayerId();
 }
 
+int addPlayer(GameController* game_controller, int primaryAttack, int secondaryAttack, int tertiaryAttack) {
+    return game_controller->addPlayer(primaryAttack, secondaryAttack, tertiaryAttack);
+}
+
+bool removePlayer(GameController* game_controller, int id) {
+    return game_controller->removePlayer(id);
+}
+
+int getPlayerIds(const GameController* game_controller, int* ids, int capacity) {
+    return game_controller->getPlayerIds(ids, capacity);
+}
+
+int getPlayerCount(const GameController* game_controller) {
+    return game_controller->getPlayerCount();
+}
+
 void attack(GameController* game_controller, int id, int attackIndex, int targetId) {
     game_controller->attack(id, attackIndex, targetId);
 }
 
+int attackArea(GameController* game_controller, int id, int attackIndex, int* ids, int* damages, int capacity) {
+    return game_controller->attackArea(id, attackIndex, ids, damages, capacity);
+}
+
+void setDeferredDamage(GameController* game_controller, bool deferred) {
+    game_controller->setDeferredDamage(deferred);
+}
+
+void resolveDamage(GameController* game_controller) {
+    game_controller->resolveDamage();
+}
+
+int drainDeathEvents(GameController* game_controller, int* victims, int* killers, int capacity) {
+    return game_controller->drainDeathEvents(victims, killers, capacity);
+}
+
+int shoot(GameController* game_controller, int id, int attackIndex, double directionX, double directionY) {
+    return game_controller->shoot(id, attackIndex, directionX, directionY);
+}
+
+int getProjectiles(const GameController* game_controller, int* ids, double* xs, double* ys, double* velocitiesX,
+                   double* velocitiesY, int capacity) {
+    return game_controller->getProjectiles(ids, xs, ys, velocitiesX, velocitiesY, capacity);
+}
+
 void move(GameController* game_controller, int id, int attackIndex) {
     game_controller->move(id, attackIndex);
 }
@@ -393,6 +1023,10 @@ int openChest(GameController* game_controller, int areaX, int areaY, int chestId
     return game_controller->openChest(areaX, areaY, chestId);
 }
 
+int openChestForPlayer(GameController* game_controller, int playerId, int areaX, int areaY, int chestId) {
+    return game_controller->openChestForPlayer(playerId, areaX, areaY, chestId);
+}
+
 int getNumberOfItem(GameController* game_controller, int id, int itemId) {
     return game_controller->getNumberOfItem(id, itemId);
 }
@@ -420,3 +1054,62 @@ void nextLevel(GameController* game_controller, int bossId) {
 void useHealthPotionIfAvailable(GameController* game_controller) {
     game_controller->useHealthPotionIfAvailable();
 }
+
+void useHealthPotionForPlayer(GameController* game_controller, int playerId) {
+    game_controller->useHealthPotionForPlayer(playerId);
+}
+
+bool GameController::saveSnapshot(const char* path) const {
+    try {
+        game_.saveSnapshot(path);
+        return true;
+    }
+    catch (std::runtime_error&) {
+        return false;
+    }
+}
+
+bool GameController::loadSnapshot(const char* path) {
+    try {
+        game_.loadSnapshot(path);
+        return true;
+    }
+    catch (std::runtime_error&) {
+        return false;
+    }
+    catch (std::invalid_argument&) {
+        return false;
+    }
+}
+
+void GameController::saveState(GameState* state) const {
+    game_.saveState(*state);
+}
+
+bool GameController::restoreState(const GameState* state) {
+    return game_.restoreState(*state);
+}
+
+bool saveSnapshot(const GameController* game_controller, const char* path) {
+    return game_controller->saveSnapshot(path);
+}
+
+bool loadSnapshot(GameController* game_controller, const char* path) {
+    return game_controller->loadSnapshot(path);
+}
+
+GameState* newGameState() {
+    return new GameState();
+}
+
+void destroyGameState(const GameState* state) {
+    delete state;
+}
+
+void saveGameState(const GameController* game_controller, GameState* state) {
+    game_controller->saveState(state);
+}
+
+bool restoreGameState(GameController* game_controller, const GameState* state) {
+    return game_controller->restoreState(state);
+}
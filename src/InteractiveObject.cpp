@@ -5,4 +5,24 @@
 #define PCH_H
 #endif
 #include "pch.h"
-#include "InterractiveObject.hpp"
\ No newline at end of file
+#include "InterractiveObject.hpp"
+
+InterractiveObject::InterractiveObject(const InterractiveObjectKind kind, const int id, const int tileX,
+                                       const int tileY) : kind(kind), id(id), tileX(tileX), tileY(tileY) {
+}
+
+InterractiveObjectKind InterractiveObject::getKind() const {
+    return kind;
+}
+
+int InterractiveObject::getId() const {
+    return id;
+}
+
+int InterractiveObject::getTileX() const {
+    return tileX;
+}
+
+int InterractiveObject::getTileY() const {
+    return tileY;
+}
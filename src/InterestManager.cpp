@@ -0,0 +1,202 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "InterestManager.hpp"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+InterestManager::InterestManager(const std::size_t areaCount) : activeAreas(areaCount, 0), areaEnemies(areaCount) {
+}
+
+void InterestManager::setRadius(const int activationRadius) {
+    if (activationRadius < 0 && activationRadius != UNLIMITED) {
+        throw std::invalid_argument("The activation radius must be positive or unlimited");
+    }
+    if (activationRadius == radius) {
+        return;
+    }
+    radius = activationRadius;
+    focused = false;
+    for (const std::size_t area: activeAreaList) {
+        activeAreas[area] = 0;
+    }
+    activeAreaList.clear();
+    summoned.clear();
+    if (radius == UNLIMITED) {
+        std::ranges::fill(awake, 1);
+    }
+    dirty = true;
+}
+
+int InterestManager::getRadius() const {
+    return radius;
+}
+
+bool InterestManager::setAwake(const std::size_t slot, const std::uint8_t state) {
+    if (awake[slot] == state) {
+        return false;
+    }
+    awake[slot] = state;
+    dirty = true;
+    return state == 1;
+}
+
+void InterestManager::focusOn(NavigationGraph&navigation, const int areaX, const int areaY,
+                              std::vector<std::size_t>&woken) {
+    const std::pair<int, int> area{areaX, areaY};
+    focusOn(navigation, std::span(&area, 1), woken);
+}
+
+void InterestManager::focusOn(NavigationGraph&navigation, const std::span<const std::pair<int, int>> areas,
+                              std::vector<std::size_t>&woken) {
+    woken.clear();
+    if (radius == UNLIMITED) {
+        return;
+    }
+    nextFoci.clear();
+    for (const auto&[x, y]: areas) {
+        nextFoci.push_back(navigation.contains(x, y) ? static_cast<std::int64_t>(x) * navigation.getHeight() + y
+                                                     : OUTSIDE);
+    }
+    std::ranges::sort(nextFoci);
+    nextFoci.erase(std::ranges::unique(nextFoci).begin(), nextFoci.end());
+    if (focused && nextFoci == foci) {
+        return;
+    }
+    const std::vector<std::size_t> previous = std::move(activeAreaList);
+    activeAreaList.clear();
+    for (const std::size_t active: previous) {
+        activeAreas[active] = 0;
+    }
+    for (const auto&[x, y]: areas) {
+        navigation.collectAreasWithin(x, y, radius, reached);
+        for (const std::size_t active: reached) {
+            if (!activeAreas[active]) {
+                activeAreas[active] = 1;
+                activeAreaList.push_back(active);
+            }
+        }
+    }
+    if (!focused) {
+        // Coming from another radius, the awake enemies are not tied to the previous areas: visit them all.
+        for (std::size_t slot = 0; slot < awake.size(); ++slot) {
+            if (setAwake(slot, enemyAreas[slot] != OUTSIDE && activeAreas[enemyAreas[slot]])) {
+                woken.push_back(slot);
+            }
+        }
+    }
+    for (const std::size_t inactive: previous) {
+        if (!activeAreas[inactive]) {
+            for (const std::size_t slot: areaEnemies[inactive]) {
+                setAwake(slot, 0);
+            }
+        }
+    }
+    for (const std::size_t slot: summoned) {
+        setAwake(slot, enemyAreas[slot] != OUTSIDE && activeAreas[enemyAreas[slot]]);
+    }
+    summoned.clear();
+    for (const std::size_t active: activeAreaList) {
+        for (const std::size_t slot: areaEnemies[active]) {
+            if (setAwake(slot, 1)) {
+                woken.push_back(slot);
+            }
+        }
+    }
+    foci.swap(nextFoci);
+    focused = true;
+}
+
+bool InterestManager::place(const std::size_t slot, std::int64_t area) {
+    if (area < 0 || area >= static_cast<std::int64_t>(areaEnemies.size())) {
+        area = OUTSIDE;
+    }
+    if (slot == enemyAreas.size()) {
+        enemyAreas.push_back(area);
+        awake.push_back(radius == UNLIMITED || (area != OUTSIDE && activeAreas[area]));
+        if (area != OUTSIDE) {
+            areaEnemies[area].push_back(slot);
+        }
+        dirty = true;
+        return false;
+    }
+    const std::int64_t previous = enemyAreas.at(slot);
+    if (previous == area) {
+        return false;
+    }
+    if (previous != OUTSIDE) {
+        auto&bucket = areaEnemies[previous];
+        *std::ranges::find(bucket, slot) = bucket.back();
+        bucket.pop_back();
+    }
+    if (area != OUTSIDE) {
+        areaEnemies[area].push_back(slot);
+    }
+    enemyAreas[slot] = area;
+    if (radius == UNLIMITED) {
+        return false;
+    }
+    if (area != OUTSIDE && activeAreas[area]) {
+        return setAwake(slot, 1);
+    }
+    if (std::ranges::find(summoned, slot) == summoned.end()) {
+        setAwake(slot, 0);
+    }
+    return false;
+}
+
+bool InterestManager::wake(const std::size_t slot) {
+    if (awake.at(slot) || radius == UNLIMITED) {
+        return false;
+    }
+    summoned.push_back(slot);
+    return setAwake(slot, 1);
+}
+
+void InterestManager::truncate(const std::size_t count) {
+    for (std::size_t slot = count; slot < enemyAreas.size(); ++slot) {
+        if (enemyAreas[slot] != OUTSIDE) {
+            std::erase(areaEnemies[enemyAreas[slot]], slot);
+        }
+    }
+    if (count < enemyAreas.size()) {
+        enemyAreas.resize(count);
+        awake.resize(count);
+        std::erase_if(summoned, [count](const std::size_t slot) { return slot >= count; });
+        dirty = true;
+    }
+}
+
+bool InterestManager::isAwake(const std::size_t slot) const {
+    return awake.at(slot) != 0;
+}
+
+const std::vector<std::size_t>& InterestManager::getAwakeEnemies() {
+    if (!dirty) {
+        return awakeEnemies;
+    }
+    awakeEnemies.clear();
+    if (radius == UNLIMITED) {
+        awakeEnemies.resize(awake.size());
+        std::iota(awakeEnemies.begin(), awakeEnemies.end(), 0);
+    }
+    else {
+        for (const std::size_t area: activeAreaList) {
+            for (const std::size_t slot: areaEnemies[area]) {
+                if (awake[slot]) {
+                    awakeEnemies.push_back(slot);
+                }
+            }
+        }
+        for (const std::size_t slot: summoned) {
+            if (awake[slot] && (enemyAreas[slot] == OUTSIDE || !activeAreas[enemyAreas[slot]])) {
+                awakeEnemies.push_back(slot);
+            }
+        }
+        std::ranges::sort(awakeEnemies);
+    }
+    dirty = false;
+    return awakeEnemies;
+}
@@ -6,6 +6,7 @@
 #endif
 #include "pch.h"
 #include "JetPack.hpp"
+#include <algorithm>
 
 JetPack::JetPack(const double force, const double maxTime, const double cooldown, const double landingAnimationTime) : force(force),
     maxTime(maxTime), cooldown(cooldown), landingAnimationTime(landingAnimationTime) {
@@ -27,11 +28,11 @@ bool JetPack::canActivate() const {
            std::chrono::duration<double>(cooldown) + std::chrono::duration<double>(landingAnimationTime);
 }
 
-bool JetPack::isUsing() const {
+bool JetPack::isUsing(const std::chrono::time_point<std::chrono::steady_clock> now) const {
     if (lastJetpackUse.time_since_epoch().count() == 0) {
         return false;
     }
-    return inUse && std::chrono::steady_clock::now() - lastJetpackUse < std::chrono::duration<double>(maxTime);
+    return inUse && now - lastJetpackUse < std::chrono::duration<double>(maxTime);
 }
 
 double JetPack::getForce() const {
@@ -53,3 +54,15 @@ void JetPack::stop() {
 double JetPack::getCoolDown() const {
     return cooldown;
 }
+
+std::chrono::time_point<std::chrono::steady_clock> JetPack::getReadyTime() const {
+    return lastJetpackUse + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(maxTime + cooldown + landingAnimationTime));
+}
+
+double JetPack::getRemainingTime(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    if (lastJetpackUse.time_since_epoch().count() == 0) {
+        return 0.0;
+    }
+    return std::max(0.0, std::chrono::duration<double>(getReadyTime() - now).count());
+}
@@ -6,6 +6,8 @@
 #endif
 #include "pch.h"
 #include "Jump.hpp"
+#include <limits>
+#include <stdexcept>
 
 Jump::Jump(const double force, const int maxUsage) : Movement("JUMP", force, 0.0, 0.0), maxUsage(maxUsage), currentUsage(0) {
 }
@@ -25,6 +27,21 @@ void Jump::reset() {
     currentUsage = 0;
 }
 
-void Jump::increaseForce(const double amount) {
-    maxUsage += amount;
-}
\ No newline at end of file
+int Jump::getMaxUsage() const {
+    return maxUsage;
+}
+
+void Jump::setMaxUsage(const int amount) {
+    if (amount < 0) {
+        throw std::invalid_argument("Amount must be positive");
+    }
+    maxUsage = amount;
+}
+
+double Jump::getRemainingTime(std::chrono::time_point<std::chrono::steady_clock>) const {
+    return canUse() ? 0.0 : std::numeric_limits<double>::infinity();
+}
+
+std::shared_ptr<Movement> Jump::clone() const {
+    return std::make_shared<Jump>(*this);
+}
@@ -0,0 +1,160 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "KinematicIntegrator.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+void KinematicBodies::add(const int id, const Vector2D&position, const Vector2D&velocity,
+                          const Vector2D&acceleration, const double gravity, const double ground) {
+    ids.push_back(id);
+    x.push_back(position.x);
+    y.push_back(position.y);
+    vx.push_back(velocity.x);
+    vy.push_back(velocity.y);
+    ax.push_back(acceleration.x);
+    ay.push_back(acceleration.y);
+    gravityScale.push_back(gravity);
+    groundHeight.push_back(ground);
+    grounded.push_back(position.y <= ground ? 1 : 0);
+}
+
+void KinematicBodies::reserve(const std::size_t capacity) {
+    ids.reserve(capacity);
+    x.reserve(capacity);
+    y.reserve(capacity);
+    vx.reserve(capacity);
+    vy.reserve(capacity);
+    ax.reserve(capacity);
+    ay.reserve(capacity);
+    gravityScale.reserve(capacity);
+    groundHeight.reserve(capacity);
+    grounded.reserve(capacity);
+}
+
+std::size_t KinematicBodies::size() const {
+    return ids.size();
+}
+
+void KinematicBodies::clear() {
+    ids.clear();
+    x.clear();
+    y.clear();
+    vx.clear();
+    vy.clear();
+    ax.clear();
+    ay.clear();
+    gravityScale.clear();
+    groundHeight.clear();
+    grounded.clear();
+}
+
+KinematicIntegrator::KinematicIntegrator() : KinematicIntegrator(DEF_TIMESTEP, DEF_GRAVITY) {
+}
+
+KinematicIntegrator::KinematicIntegrator(const double timestep, const double gravity) : timestep(timestep),
+    gravity(gravity) {
+    if (timestep <= 0) {
+        throw std::invalid_argument("Timestep must be strictly positive");
+    }
+    if (gravity < 0) {
+        throw std::invalid_argument("Gravity must be positive");
+    }
+}
+
+void KinematicIntegrator::step(KinematicBodies&bodies) const {
+    const std::size_t count = bodies.size();
+    double* __restrict x = bodies.x.data();
+    double* __restrict y = bodies.y.data();
+    double* __restrict vx = bodies.vx.data();
+    double* __restrict vy = bodies.vy.data();
+    const double* __restrict ax = bodies.ax.data();
+    const double* __restrict ay = bodies.ay.data();
+    const double* __restrict gravityScale = bodies.gravityScale.data();
+    const double* __restrict ground = bodies.groundHeight.data();
+    std::uint8_t* __restrict grounded = bodies.grounded.data();
+    const double dt = timestep;
+    const double g = gravity;
+    // Branch-free semi-implicit Euler, so that the compiler can vectorize the loop.
+    for (std::size_t i = 0; i < count; ++i) {
+        vx[i] += ax[i] * dt;
+        vy[i] += (ay[i] - g * gravityScale[i]) * dt;
+        x[i] += vx[i] * dt;
+        const double nextY = y[i] + vy[i] * dt;
+        const bool landed = nextY <= ground[i];
+        y[i] = landed ? ground[i] : nextY;
+        vy[i] = landed ? std::max(vy[i], 0.0) : vy[i];
+        grounded[i] = landed;
+    }
+}
+
+int KinematicIntegrator::advance(KinematicBodies&bodies, const double elapsedSeconds) {
+    if (elapsedSeconds < 0) {
+        throw std::invalid_argument("Elapsed time must be positive");
+    }
+    accumulator += elapsedSeconds;
+    int steps = 0;
+    while (accumulator >= timestep && steps < MAX_STEPS_PER_ADVANCE) {
+        step(bodies);
+        accumulator -= timestep;
+        ++steps;
+    }
+    if (steps == MAX_STEPS_PER_ADVANCE && accumulator >= timestep) {
+        const double remainder = std::fmod(accumulator, timestep);
+        dropped += accumulator - remainder;
+        accumulator = remainder;
+    }
+    return steps;
+}
+
+void KinematicIntegrator::gather(const Character&character, const double ground, KinematicBodies&bodies,
+                                 const std::chrono::time_point<std::chrono::steady_clock> now) {
+    Vector2D velocity = character.getVelocity();
+    Vector2D acceleration{0.0, 0.0};
+    double gravityScale = 1.0;
+    const Movement* dash = character.findMovement(DASH);
+    if (dash != nullptr && dash->isUsing(now)) {
+        velocity = {character.getFacing() * dash->getForce() * DASH_SPEED_SCALE, 0.0};
+        gravityScale = 0.0;
+    }
+    else {
+        // A character without a RUN movement does not run, whatever its run input.
+        const Movement* run = character.findMovement(RUN);
+        velocity.x = run != nullptr ? character.getRunInput() * run->getForce() : 0.0;
+        const Movement* climb = character.findMovement(CLIMB);
+        if (climb != nullptr && climb->isUsing(now)) {
+            velocity.y = climb->getForce();
+            gravityScale = 0.0;
+        }
+        if (const JetPack jetPack = character.getJetPack(); jetPack.getForce() > 0 && jetPack.isUsing(now)) {
+            acceleration.y = jetPack.getForce();
+        }
+    }
+    bodies.add(character.getId(), character.getPosition(), velocity, acceleration, gravityScale, ground);
+}
+
+void KinematicIntegrator::scatter(const KinematicBodies&bodies, const std::size_t index, Character&character) {
+    character.setPosition({bodies.x[index], bodies.y[index]});
+    character.setVelocity({bodies.vx[index], bodies.vy[index]});
+    if (bodies.grounded[index] && !character.isLanded()) {
+        character.land();
+    }
+    else if (!bodies.grounded[index] && character.isLanded()) {
+        character.takeOff();
+    }
+}
+
+double KinematicIntegrator::getTimestep() const {
+    return timestep;
+}
+
+double KinematicIntegrator::getDroppedTime() const {
+    return dropped;
+}
+
+void KinematicIntegrator::reset() {
+    accumulator = 0.0;
+    dropped = 0.0;
+}
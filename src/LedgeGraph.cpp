@@ -0,0 +1,308 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "LedgeGraph.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "GridCell.hpp"
+#include "Jump.hpp"
+#include "KinematicIntegrator.hpp"
+
+namespace {
+    constexpr double EPSILON = 1e-9; ///< Tolerance when locating feet standing exactly on a floor.
+    constexpr double GRAVITY = KinematicIntegrator::DEF_GRAVITY; ///< Gravity the characters fall with.
+
+    /**
+     * @brief Computes the take-off speed needed to jump a height.
+     * @param height The height, in tiles.
+     * @return The speed.
+     */
+    double jumpSpeed(const int height) {
+        return std::sqrt(2.0 * GRAVITY * height);
+    }
+
+    /**
+     * @brief Checks if the tiles of a column are all free.
+     * @param map The tile map.
+     * @param x The x-coordinate of the column.
+     * @param bottom The y-coordinate of the lowest tile.
+     * @param top The y-coordinate of the highest tile.
+     * @return True if no tile of the column is solid, otherwise false.
+     */
+    bool isColumnClear(const TileMap&map, const int x, const int bottom, const int top) {
+        for (int y = bottom; y <= top; ++y) {
+            if (map.at(x, y).isSolid()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Checks if the tiles of a row between two columns are all free.
+     * @param map The tile map.
+     * @param from The x-coordinate of one end of the row.
+     * @param to The x-coordinate of the other end of the row.
+     * @param y The y-coordinate of the row.
+     * @return True if no tile of the row is solid, otherwise false.
+     */
+    bool isRowClear(const TileMap&map, const int from, const int to, const int y) {
+        for (int x = std::min(from, to); x <= std::max(from, to); ++x) {
+            if (map.at(x, y).isSolid()) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+MovementProfile MovementProfile::of(const Character&character) {
+    constexpr double ALWAYS = std::numeric_limits<double>::infinity();
+    MovementProfile profile;
+    if (character.hasMovement("RUN")) {
+        profile.strengths[RUN] = ALWAYS;
+    }
+    if (character.hasMovement("JUMP")) {
+        const auto jump = std::dynamic_pointer_cast<Jump>(character.getMovement("JUMP"));
+        // Consecutive jumps each restart from the take-off speed, adding up their heights.
+        profile.strengths[JUMP] = jump->getForce() * std::sqrt(std::max(jump->getMaxUsage(), 0));
+    }
+    if (character.hasMovement("DASH")) {
+        const auto dash = character.getMovement("DASH");
+        profile.strengths[DASH] = dash->getForce() * KinematicIntegrator::DASH_SPEED_SCALE * dash->getAnimationTime();
+    }
+    if (character.hasMovement("CLIMB")) {
+        profile.strengths[CLIMB] = ALWAYS;
+    }
+    if (character.hasJetPack()) {
+        const JetPack jetPack = character.getJetPack();
+        const double lift = jetPack.getForce() - GRAVITY;
+        if (lift > 0) {
+            const double speed = lift * jetPack.getMaxTime();
+            profile.strengths[JETPACK] = lift * jetPack.getMaxTime() * jetPack.getMaxTime() / 2 +
+                                         speed * speed / (2 * GRAVITY);
+        }
+    }
+    return profile;
+}
+
+bool MovementProfile::allows(const Movements movement, const double threshold) const {
+    const double strength = strengths.at(movement);
+    return strength > 0 && strength >= threshold;
+}
+
+LedgeGraph::LedgeGraph(const TileMap&map) {
+    const int width = map.getWidth();
+    const int height = map.getHeight();
+    rowOffsets.assign(static_cast<std::size_t>(height) + 1, 0);
+    std::vector<Tile> below;
+    std::vector<Tile> row;
+    map.getRow(0, below);
+    // The bottom row stands on the outside of the grid, which is never a floor to stand on.
+    for (int y = 1; y < height; ++y) {
+        rowOffsets[y] = static_cast<std::uint32_t>(ledges.size());
+        map.getRow(y, row);
+        int start = -1;
+        for (int x = 0; x <= width; ++x) {
+            const bool standable = x < width && !row[x].isSolid() && below[x].isFloor();
+            if (standable && start < 0) {
+                start = x;
+            }
+            else if (!standable && start >= 0) {
+                ledges.push_back({y, start, x - 1});
+                start = -1;
+            }
+        }
+        std::swap(row, below);
+    }
+    rowOffsets[height] = static_cast<std::uint32_t>(ledges.size());
+    linkLedges(map);
+    for (const LedgeLink&candidate: links) {
+        thresholds[candidate.movement].push_back(candidate.threshold);
+    }
+    for (std::vector<double>&values: thresholds) {
+        std::ranges::sort(values);
+        values.erase(std::ranges::unique(values).begin(), values.end());
+    }
+}
+
+void LedgeGraph::linkLedges(const TileMap&map) {
+    const int rows = static_cast<int>(rowOffsets.size()) - 1;
+    for (int from = 0; from < static_cast<int>(ledges.size()); ++from) {
+        const Ledge&a = ledges[from];
+        const auto link = [this, from](const int to, const Movements movement, const double threshold,
+                                       const Vector2D&takeoff, const Vector2D&landing) {
+            links.push_back({from, to, movement, threshold, takeoff, landing});
+        };
+        for (int y = std::max(1, a.row - MAX_LINK_HEIGHT); y <= std::min(rows - 1, a.row + MAX_LINK_HEIGHT); ++y) {
+            // The ledges of a row are disjoint, sorted by both of their ends.
+            const auto first = std::lower_bound(ledges.begin() + rowOffsets[y], ledges.begin() + rowOffsets[y + 1],
+                                                a.left - MAX_JUMP_GAP - 1, [](const Ledge&candidate, const int value) {
+                                                    return candidate.right < value;
+                                                });
+            for (auto to = static_cast<std::uint32_t>(first - ledges.begin()); to < rowOffsets[y + 1]; ++to) {
+                const Ledge&b = ledges[to];
+                if (b.left > a.right + MAX_JUMP_GAP + 1) {
+                    break;
+                }
+                if (static_cast<int>(to) == from) {
+                    continue;
+                }
+                const int dy = b.row - a.row;
+                if (dy == 0) {
+                    // Same row: jump or dash over the pit between both ledges.
+                    const int takeoffX = b.left > a.right ? a.right : a.left;
+                    const int landingX = b.left > a.right ? b.left : b.right;
+                    if (isRowClear(map, takeoffX, landingX, a.row)) {
+                        const Vector2D takeoff{takeoffX + 0.5, static_cast<double>(a.row)};
+                        const Vector2D landing{landingX + 0.5, static_cast<double>(b.row)};
+                        link(static_cast<int>(to), JUMP, jumpSpeed(1), takeoff, landing);
+                        link(static_cast<int>(to), DASH, std::abs(landingX - takeoffX), takeoff, landing);
+                    }
+                    continue;
+                }
+                // Between two rows, the path follows a column of the lower ledge up to the row of the
+                // upper ledge, then steps sideways onto it; going down follows the same path backward.
+                // One-way platforms let the column through. The column with the shortest step is kept.
+                const Ledge&lower = dy > 0 ? a : b;
+                const Ledge&upper = dy > 0 ? b : a;
+                int column = -1;
+                int edge = -1;
+                for (int x = std::max(lower.left, upper.left - MAX_JUMP_GAP - 1);
+                     x <= std::min(lower.right, upper.right + MAX_JUMP_GAP + 1); ++x) {
+                    const int candidate = std::clamp(x, upper.left, upper.right);
+                    if ((column < 0 || std::abs(candidate - x) < std::abs(edge - column)) &&
+                        isColumnClear(map, x, lower.row, upper.row - 1) && isRowClear(map, x, candidate, upper.row)) {
+                        column = x;
+                        edge = candidate;
+                    }
+                }
+                if (column < 0) {
+                    continue;
+                }
+                const int step = std::abs(edge - column);
+                const Vector2D bottom{column + 0.5, static_cast<double>(lower.row)};
+                const Vector2D top{edge + 0.5, static_cast<double>(upper.row)};
+                if (dy > 0) {
+                    link(static_cast<int>(to), JUMP, jumpSpeed(dy), bottom, top);
+                    link(static_cast<int>(to), JETPACK, dy, bottom, top);
+                    if (step <= 1) {
+                        link(static_cast<int>(to), CLIMB, 0.0, bottom, top);
+                    }
+                }
+                else if (step <= MAX_DROP_GAP + 1) {
+                    link(static_cast<int>(to), RUN, 0.0, top, bottom);
+                }
+                else {
+                    link(static_cast<int>(to), JUMP, jumpSpeed(1), top, bottom);
+                    link(static_cast<int>(to), DASH, step, top, bottom);
+                }
+            }
+        }
+    }
+}
+
+LedgeGraph::ProfileKey LedgeGraph::keyOf(const MovementProfile&profile) const {
+    ProfileKey key{};
+    for (std::size_t movement = 0; movement < key.size(); ++movement) {
+        const double strength = profile.strengths[movement];
+        // A missing movement allows no link, even those without a threshold.
+        if (strength > 0) {
+            const std::vector<double>&values = thresholds[movement];
+            key[movement] = static_cast<std::uint32_t>(std::ranges::upper_bound(values, strength) - values.begin());
+        }
+    }
+    return key;
+}
+
+const LedgeGraph::Adjacency& LedgeGraph::adjacency(const MovementProfile&profile) {
+    const ProfileKey key = keyOf(profile);
+    const auto cached = profiles.find(key);
+    if (cached != profiles.end()) {
+        return cached->second;
+    }
+    if (profiles.size() >= MAX_CACHED_PROFILES) {
+        profiles.clear();
+    }
+    Adjacency usable{std::vector<std::uint32_t>(ledges.size() + 1, 0), {}};
+    for (std::uint32_t i = 0; i < links.size(); ++i) {
+        if (profile.allows(links[i].movement, links[i].threshold)) {
+            usable.links.push_back(i);
+            ++usable.offsets[links[i].from + 1];
+        }
+    }
+    for (std::size_t ledge = 1; ledge < usable.offsets.size(); ++ledge) {
+        usable.offsets[ledge] += usable.offsets[ledge - 1];
+    }
+    return profiles.emplace(key, std::move(usable)).first->second;
+}
+
+int LedgeGraph::findLedge(const Vector2D&feet) const {
+    const int row = floorToCell(feet.y + EPSILON);
+    const int x = floorToCell(feet.x);
+    if (row < 0 || row + 1 >= static_cast<int>(rowOffsets.size())) {
+        return -1;
+    }
+    const auto first = ledges.begin() + rowOffsets[row];
+    const auto last = ledges.begin() + rowOffsets[row + 1];
+    const auto ledge = std::upper_bound(first, last, x, [](const int value, const Ledge&candidate) {
+        return value < candidate.left;
+    });
+    if (ledge == first || std::prev(ledge)->right < x) {
+        return -1;
+    }
+    return static_cast<int>(std::prev(ledge) - ledges.begin());
+}
+
+const Ledge& LedgeGraph::getLedge(const int index) const {
+    return ledges.at(index);
+}
+
+std::size_t LedgeGraph::getLedgeCount() const {
+    return ledges.size();
+}
+
+const std::vector<LedgeLink>& LedgeGraph::getLinks() const {
+    return links;
+}
+
+std::size_t LedgeGraph::getUsableLinkCount(const MovementProfile&profile) {
+    return adjacency(profile).links.size();
+}
+
+std::vector<LedgeLink> LedgeGraph::findRoute(const MovementProfile&profile, const int from, const int to) {
+    const int count = static_cast<int>(ledges.size());
+    if (from < 0 || to < 0 || from >= count || to >= count || from == to) {
+        return {};
+    }
+    const Adjacency&usable = adjacency(profile);
+    constexpr std::int32_t UNVISITED = -1;
+    std::vector<std::int32_t> via(ledges.size(), UNVISITED);
+    std::vector<int> queue{from};
+    via[from] = static_cast<std::int32_t>(links.size());
+    for (std::size_t head = 0; head < queue.size() && via[to] == UNVISITED; ++head) {
+        const int current = queue[head];
+        for (std::uint32_t i = usable.offsets[current]; i < usable.offsets[current + 1]; ++i) {
+            const int next = links[usable.links[i]].to;
+            if (via[next] == UNVISITED) {
+                via[next] = static_cast<std::int32_t>(usable.links[i]);
+                queue.push_back(next);
+            }
+        }
+    }
+    if (via[to] == UNVISITED) {
+        return {};
+    }
+    std::vector<LedgeLink> route;
+    for (int ledge = to; ledge != from; ledge = links[via[ledge]].from) {
+        route.push_back(links[via[ledge]]);
+    }
+    std::ranges::reverse(route);
+    return route;
+}
+
+std::size_t LedgeGraph::getCachedProfileCount() const {
+    return profiles.size();
+}
@@ -6,6 +6,7 @@
 #endif
 #include "pch.h"
 #include "Level.hpp"
+#include "GridCell.hpp"
 
 #include "Enemies.hpp"
 
@@ -14,10 +15,19 @@
 #include <stdexcept>
 #include <functional>
 #include <utility>
+#include <algorithm>
+#include <bit>
+#include <cmath>
 
 Level::Level(const int id): id(id) {
 }
 
+Level::Level(const int id, const int length, const int height): id(id), length(length), height(height) {
+    if (length < 2 || height < 2) {
+        throw std::invalid_argument("A level grid must be at least 2 areas long and high");
+    }
+}
+
 Level::Level(const int id, const std::vector<std::vector<Area>>&areas): id(id) {
     loadFromAreas(areas);
 }
@@ -33,6 +43,23 @@ void Level::loadFromAreas(const std::vector<std::vector<Area>>&areas) {
     for (const auto&area: areas) {
         this->areas.push_back(area);
     }
+    length = static_cast<int>(this->areas.size());
+    height = static_cast<int>(this->areas[0].size());
+    tileMap = TileMap(this->areas, AREA_TILES);
+    navigation = NavigationGraph(this->areas);
+    ledges = LedgeGraph(tileMap);
+    const int radius = interest.getRadius();
+    interest = InterestManager(static_cast<std::size_t>(length) * height);
+    interest.setRadius(radius);
+    scheduleAllSpawns();
+}
+
+int Level::getLength() const {
+    return length;
+}
+
+int Level::getHeight() const {
+    return height;
 }
 
 bool Level::isLoaded() const {
@@ -43,17 +70,17 @@ Level Level::generate() {
     if (this->isLoaded()) {
         throw std::runtime_error("Cannot generate an already loaded level : Level generate()");
     }
-    areas.resize(LENGTH);
-    for (int i = 0; i < LENGTH; ++i) {
-        areas[i].resize(HEIGHT);
+    areas.resize(length);
+    for (int i = 0; i < length; ++i) {
+        areas[i].resize(height);
     }
 
     std::random_device rd;
     std::mt19937 gen(rd());
     std::uniform_real_distribution<> dis(0.0, 1.0);
 
-    for (int i = 0; i < LENGTH; ++i) {
-        for (int j = 0; j < HEIGHT; ++j) {
+    for (int i = 0; i < length; ++i) {
+        for (int j = 0; j < height; ++j) {
             if (dis(gen) < FILL_PROBABILITY) {
                 areas[i][j] = Area(0, 1, {});
             }
@@ -64,8 +91,8 @@ Level Level::generate() {
     areas[1][1] = DefinedAreas::get(A4URDL).area;
 
     std::function<bool(int, int)> backtrack = [&](int x, int y) {
-        if (x == LENGTH) return true;
-        if (y == HEIGHT) return backtrack(x + 1, 0);
+        if (x == length) return true;
+        if (y == height) return backtrack(x + 1, 0);
 
         if (areas[x][y].get_type() == 0 || areas[x][y].get_type() == 40) return backtrack(x, y + 1);
 
@@ -80,13 +107,13 @@ Level Level::generate() {
             else {
                 compatible &= candidate.isCompatible(Direction::LEFT, Area(0, 1, {}));
             }
-            if (y < HEIGHT - 1 && areas[x][y + 1].get_type() != 0) {
+            if (y < height - 1 && areas[x][y + 1].get_type() != 0) {
                 compatible &= candidate.isCompatible(Direction::UP, areas[x][y + 1]);
             }
             else {
                 compatible &= candidate.isCompatible(Direction::UP, Area(0, 1, {}));
             }
-            if (x < LENGTH - 1 && areas[x + 1][y].get_type() != 0) {
+            if (x < length - 1 && areas[x + 1][y].get_type() != 0) {
                 compatible &= candidate.isCompatible(Direction::RIGHT, areas[x + 1][y]);
             }
             else {
@@ -115,8 +142,8 @@ Level Level::generate() {
     };
 
     if (!backtrack(0, 0)) {
-        for (int i = 0; i < LENGTH; ++i) {
-            for (int j = 0; j < HEIGHT; ++j) {
+        for (int i = 0; i < length; ++i) {
+            for (int j = 0; j < height; ++j) {
                 if (areas[i][j].get_type() == -1) {
                     areas[i][j] = Area(0, 1, {});
                 }
@@ -124,6 +151,13 @@ Level Level::generate() {
         }
     }
 
+    tileMap = TileMap(areas, AREA_TILES);
+    navigation = NavigationGraph(areas);
+    ledges = LedgeGraph(tileMap);
+    const int radius = interest.getRadius();
+    interest = InterestManager(static_cast<std::size_t>(length) * height);
+    interest.setRadius(radius);
+    scheduleAllSpawns();
     return std::move(*this);
 }
 
@@ -153,40 +187,445 @@ std::set<Direction2D> Level::get_gateway_positions(const int x, const int y) con
     return areas.at(x).at(y).get_gateway_positions();
 }
 
-bool Level::can_spawn_at(const int area_x, const int area_y, const int spawnId) {
-    return areas.at(area_x).at(area_y).can_spawn(spawnId);
+bool Level::can_spawn_at(const int area_x, const int area_y, const int spawnId,
+                         const std::chrono::time_point<std::chrono::steady_clock> now) {
+    return areas.at(area_x).at(area_y).can_spawn(spawnId, now);
 }
 
-int Level::spawn_at(const int area_x, const int area_y, const int spawnId, const double difficultyCoefficient) {
-    if (!can_spawn_at(area_x, area_y, spawnId)) {
+int Level::spawn_at(const int area_x, const int area_y, const int spawnId, const double difficultyCoefficient,
+                    const std::chrono::time_point<std::chrono::steady_clock> now) {
+    if (!can_spawn_at(area_x, area_y, spawnId, now)) {
         throw std::invalid_argument(
             "Cannot spawn at area (" + std::to_string(area_x) + ", " + std::to_string(area_y) + ") with spawn id " +
             std::to_string(spawnId));
     }
-    areas.at(area_x).at(area_y).spawn(spawnId);
-    auto enemy = getARandomEnemy(difficultyCoefficient);
-    enemies.emplace(enemy.getId(), enemy);
+    const Vector2D position = getSpawnPosition(area_x, area_y, spawnId);
+    areas.at(area_x).at(area_y).spawn(spawnId, now);
+    reschedule(area_x, area_y, spawnId);
+    Enemy enemy = getARandomEnemy(difficultyCoefficient);
+    enemy.setPosition(position);
+    return addEnemy(enemy);
+}
+
+void Level::scheduleAllSpawns() {
+    spawnScheduler.clear();
+    spawnPointCount = 0;
+    for (int i = 0; i < static_cast<int>(areas.size()); ++i) {
+        for (int j = 0; j < static_cast<int>(areas[i].size()); ++j) {
+            for (const int spawnId: areas[i][j].get_spawn_ids()) {
+                spawnScheduler.schedule({i, j, spawnId}, areas[i][j].get_next_spawn_time(spawnId));
+                ++spawnPointCount;
+            }
+        }
+    }
+}
+
+void Level::reschedule(const int area_x, const int area_y, const int spawnId) {
+    spawnScheduler.schedule({area_x, area_y, spawnId}, areas.at(area_x).at(area_y).get_next_spawn_time(spawnId));
+    if (spawnScheduler.size() > 2 * spawnPointCount) {
+        spawnScheduler.compact([this](const SpawnScheduler::Entry&entry) { return isLive(entry); });
+    }
+}
+
+bool Level::isLive(const SpawnScheduler::Entry&entry) const {
+    const auto&[areaX, areaY, spawnId] = entry.spawn;
+    return areas.at(areaX).at(areaY).get_next_spawn_time(spawnId) == entry.readyAt;
+}
+
+std::vector<SpawnEvent> Level::drainSpawnEvents(const std::chrono::time_point<std::chrono::steady_clock> now,
+                                                const int maxEvents) {
+    std::vector<SpawnScheduler::Entry> drained;
+    while (static_cast<int>(drained.size()) < maxEvents && spawnScheduler.hasReady(now)) {
+        const auto entry = spawnScheduler.pop();
+        // A spawn used since it was scheduled has a newer entry in the heap: this one is stale.
+        if (isLive(entry)) {
+            drained.push_back(entry);
+        }
+    }
+    std::vector<SpawnEvent> events;
+    events.reserve(drained.size());
+    for (const auto&entry: drained) {
+        // Queued again until used: spawning it makes this entry stale, otherwise the next drain emits it.
+        spawnScheduler.schedule(entry.spawn, entry.readyAt);
+        events.push_back(entry.spawn);
+    }
+    return events;
+}
+
+std::vector<int> Level::spawnReady(const std::chrono::time_point<std::chrono::steady_clock> now, const int budget,
+                                   const double difficultyCoefficient) {
+    std::vector<int> ids;
+    for (const auto&[areaX, areaY, spawnId]: drainSpawnEvents(now, budget)) {
+        ids.push_back(spawn_at(areaX, areaY, spawnId, difficultyCoefficient, now));
+    }
+    return ids;
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Level::getNextSpawnTime() const {
+    return spawnScheduler.nextReadyTime();
+}
+
+std::vector<int> Level::spawnWave(const std::vector<SpawnEvent>&wave, const double difficultyCoefficient,
+                                  const std::chrono::time_point<std::chrono::steady_clock> now) {
+    if (enemies.capacity() < enemies.size() + wave.size()) {
+        reserveEnemies(std::max(2 * enemies.capacity(), enemies.size() + wave.size()));
+    }
+    std::vector<int> ids;
+    ids.reserve(wave.size());
+    for (const auto&[areaX, areaY, spawnId]: wave) {
+        if (can_spawn_at(areaX, areaY, spawnId, now)) {
+            ids.push_back(spawn_at(areaX, areaY, spawnId, difficultyCoefficient, now));
+        }
+    }
+    return ids;
+}
+
+void Level::reserveEnemies(const std::size_t capacity) {
+    enemies.reserve(capacity);
+    enemyIndex.reserve(capacity);
+}
+
+std::size_t Level::getEnemyCount() const {
+    return enemies.size();
+}
+
+std::size_t Level::getEnemyCapacity() const {
+    return enemies.capacity();
+}
+
+int Level::addEnemy(const Enemy&enemy) {
+    enemyIndex.emplace(enemy.getId(), enemies.size());
+    enemies.push_back(enemy);
+    refreshCooldowns(enemies.size() - 1);
+    relocate(enemies.size() - 1);
+    maxFollowRange = std::max(maxFollowRange, enemy.getFollowRange());
+    maxAttackRange = std::max(maxAttackRange, enemy.getAttackRange());
     return enemy.getId();
 }
 
+Enemy& Level::enemyAt(const int id) {
+    if (!enemyIndex.contains(id)) {
+        throw std::invalid_argument("No enemy with id " + std::to_string(id));
+    }
+    return enemies[enemyIndex.at(id)];
+}
+
+Vector2D Level::getSpawnPosition(const int area_x, const int area_y, const int spawnId) const {
+    const auto spawn = tileMap.getObject(area_x, area_y, InterractiveObjectKind::SPAWN, spawnId);
+    return {spawn.getTileX() + 0.5, static_cast<double>(spawn.getTileY())};
+}
+
+void Level::setEnemyPosition(const int id, const Vector2D&position) {
+    enemyAt(id).setPosition(position);
+    relocate(enemyIndex.at(id));
+}
+
+void Level::setEnemyVelocity(const int id, const Vector2D&velocity) {
+    awakeEnemyAt(id).setVelocity(velocity);
+}
+
+void Level::setEnemyRunInput(const int id, const double input) {
+    awakeEnemyAt(id).setRunInput(input);
+}
+
+bool Level::moveEnemy(const int id, const std::string&movementName) {
+    Enemy&enemy = awakeEnemyAt(id);
+    if (!enemy.canMove(movementName)) {
+        return false;
+    }
+    enemy.move(movementName);
+    refreshCooldowns(enemyIndex.at(id));
+    return true;
+}
+
+double Level::getGroundHeight(const Vector2D&position) const {
+    return tileMap.getGroundHeight(position);
+}
+
+const TileMap& Level::getTileMap() const {
+    return tileMap;
+}
+
+std::pair<int, int> Level::getAreaAt(const Vector2D&position) {
+    return {floorToCell(position.x / AREA_SIZE), floorToCell(position.y / AREA_SIZE)};
+}
+
+int Level::getAreaDistance(const int fromX, const int fromY, const int toX, const int toY) {
+    return navigation.getDistance(fromX, fromY, toX, toY);
+}
+
+Direction2D Level::getNextGateway(const int fromX, const int fromY, const int toX, const int toY) {
+    return navigation.getNextGateway(fromX, fromY, toX, toY);
+}
+
+void Level::getEnemyNextGateways(const Vector2D&target, std::vector<int>&ids, std::vector<Direction2D>&gateways) {
+    const auto [targetX, targetY] = getAreaAt(target);
+    ids.clear();
+    gateways.clear();
+    ids.reserve(enemies.size());
+    gateways.reserve(enemies.size());
+    for (const Enemy&enemy: enemies) {
+        if (enemy.getHealth().current <= 0) {
+            continue;
+        }
+        const auto [x, y] = getAreaAt(enemy.getPosition());
+        ids.push_back(enemy.getId());
+        gateways.push_back(navigation.getNextGateway(x, y, targetX, targetY));
+    }
+}
+
+void Level::getChaseDirections(const Vector2D&target, std::vector<int>&ids, std::vector<Vector2D>&directions) {
+    chaseField.update(navigation, tileMap, target);
+    ids = enemiesInRange(target, maxFollowRange, &Enemy::getFollowRange);
+    directions.clear();
+    directions.reserve(ids.size());
+    for (const int id: ids) {
+        directions.push_back(chaseField.getDirection(enemies[enemyIndex.at(id)].getPosition()));
+    }
+}
+
+std::vector<LedgeLink> Level::planRoute(const MovementProfile&profile, const Vector2D&from, const Vector2D&to) {
+    const auto ledgeUnder = [this](const Vector2D&position) {
+        const int ledge = ledges.findLedge(position);
+        return ledge >= 0 ? ledge : ledges.findLedge({position.x, tileMap.getGroundHeight(position)});
+    };
+    return ledges.findRoute(profile, ledgeUnder(from), ledgeUnder(to));
+}
+
+LedgeGraph& Level::getLedgeGraph() {
+    return ledges;
+}
+
+const NavigationGraph& Level::getNavigationGraph() const {
+    return navigation;
+}
+
+void Level::gatherEnemyBodies(KinematicBodies&bodies, const std::chrono::time_point<std::chrono::steady_clock> now) {
+    for (const std::size_t slot: interest.getAwakeEnemies()) {
+        const Enemy&enemy = enemies[slot];
+        if (enemy.getHealth().current > 0) {
+            KinematicIntegrator::gather(enemy, getGroundHeight(enemy.getPosition()), bodies, now);
+        }
+    }
+}
+
+void Level::scatterEnemyBodies(const KinematicBodies&bodies, const std::size_t first) {
+    for (std::size_t i = first; i < bodies.size(); ++i) {
+        const std::size_t slot = enemyIndex.at(bodies.ids[i]);
+        const bool wasLanded = enemies[slot].isLanded();
+        KinematicIntegrator::scatter(bodies, i, enemies[slot]);
+        if (!wasLanded && enemies[slot].isLanded()) {
+            refreshCooldowns(slot);
+        }
+        relocate(slot);
+    }
+}
+
+void Level::gatherEnemyPerception(EnemyPerception&perception, const std::span<const Vector2D> targets,
+                                  const std::function<bool(int)>&isDriven) {
+    const std::vector<CooldownTable::Mask>&masks = cooldowns.getMasks();
+    const std::size_t seen = std::min(targets.size(), EnemyPerception::MAX_TARGETS_IN_SIGHT);
+    for (const std::size_t slot: interest.getAwakeEnemies()) {
+        const Enemy&enemy = enemies[slot];
+        if (enemy.getHealth().current <= 0 || isDriven(enemy.getId())) {
+            continue;
+        }
+        const Vector2D position = enemy.getPosition();
+        const double range = enemy.getAttackRange();
+        std::uint32_t inSight = 0;
+        for (std::size_t target = 0; target < seen; ++target) {
+            if (position.squaredDistanceTo(targets[target]) <= range * range &&
+                hasLineOfSight(position, targets[target])) {
+                inSight |= std::uint32_t{1} << target;
+            }
+        }
+        const unsigned ready = slot < masks.size() ? masks[slot] & CooldownTable::attackBits() : 0u;
+        perception.add(enemy.getId(), position, enemy.getFollowRange(), range, ready != 0 ? std::countr_zero(ready) : -1,
+                       -1, inSight);
+    }
+}
+
+void Level::applyEnemyRunInputs(const EnemyPerception&perception, const EnemyCommands&commands) {
+    for (std::size_t i = 0; i < perception.size(); ++i) {
+        enemies[enemyIndex.at(perception.ids[i])].setRunInput(commands.runInputs[i]);
+    }
+}
+
+Enemy& Level::awakeEnemyAt(const int id) {
+    Enemy&enemy = enemyAt(id);
+    wakeEnemy(id);
+    return enemy;
+}
+
+std::int64_t Level::areaIndexOf(const Vector2D&position) const {
+    const auto [x, y] = getAreaAt(position);
+    return isValidCoordinates(x, y) ? static_cast<std::int64_t>(x) * height + y : -1;
+}
+
+void Level::relocate(const std::size_t slot) {
+    enemyGrid.update(enemies[slot].getId(), enemies[slot].getPosition());
+    if (interest.place(slot, areaIndexOf(enemies[slot].getPosition()))) {
+        fastForward(slot);
+    }
+}
+
+void Level::refreshCooldowns(const std::size_t slot) {
+    cooldowns.update(slot, enemies[slot], std::chrono::steady_clock::now());
+}
+
+void Level::fastForward(const std::size_t slot) {
+    // Cooldowns and animations are absolute time points, which kept elapsing while the enemy slept:
+    // only its motion, frozen when it fell asleep, has to catch up, by landing it on the ground below.
+    Enemy&enemy = enemies[slot];
+    const Vector2D position = enemy.getPosition();
+    enemy.setVelocity({0.0, 0.0});
+    enemy.setPosition({position.x, getGroundHeight(position)});
+    if (!enemy.isLanded()) {
+        enemy.land();
+        refreshCooldowns(slot);
+    }
+    enemyGrid.update(enemy.getId(), enemy.getPosition());
+    interest.place(slot, areaIndexOf(enemy.getPosition()));
+}
+
+void Level::setActivationRadius(const int radius) {
+    interest.setRadius(radius);
+}
+
+int Level::getActivationRadius() const {
+    return interest.getRadius();
+}
+
+std::size_t Level::focusOn(const Vector2D&player) {
+    return focusOn(std::span(&player, 1));
+}
+
+std::size_t Level::focusOn(const std::span<const Vector2D> players) {
+    focusAreas.clear();
+    for (const Vector2D&player: players) {
+        focusAreas.push_back(getAreaAt(player));
+    }
+    interest.focusOn(navigation, focusAreas, woken);
+    for (const std::size_t slot: woken) {
+        fastForward(slot);
+    }
+    return woken.size();
+}
+
+bool Level::wakeEnemy(const int id) {
+    if (!enemyIndex.contains(id)) {
+        throw std::invalid_argument("No enemy with id " + std::to_string(id));
+    }
+    const std::size_t slot = enemyIndex.at(id);
+    if (!interest.wake(slot)) {
+        return false;
+    }
+    fastForward(slot);
+    return true;
+}
+
+bool Level::isEnemyAwake(const int id) const {
+    if (!enemyIndex.contains(id)) {
+        throw std::invalid_argument("No enemy with id " + std::to_string(id));
+    }
+    return interest.isAwake(enemyIndex.at(id));
+}
+
+std::size_t Level::getAwakeEnemyCount() {
+    return interest.getAwakeEnemies().size();
+}
+
+std::vector<int> Level::enemiesInRange(const Vector2D&target, const double queryRadius,
+                                       double (Enemy::*range)() const) const {
+    std::vector<int> candidates;
+    enemyGrid.queryRadius(target, queryRadius, candidates);
+    std::vector<int> ids;
+    ids.reserve(candidates.size());
+    for (const int candidate: candidates) {
+        const Enemy&enemy = enemies[enemyIndex.at(candidate)];
+        const double reach = (enemy.*range)();
+        if (enemy.getHealth().current > 0 && enemy.getPosition().squaredDistanceTo(target) <= reach * reach) {
+            ids.push_back(candidate);
+        }
+    }
+    return ids;
+}
+
+std::vector<int> Level::getEnemiesInFollowRange(const Vector2D&target) const {
+    return enemiesInRange(target, maxFollowRange, &Enemy::getFollowRange);
+}
+
+std::vector<int> Level::getEnemiesInAttackRange(const Vector2D&target) const {
+    return enemiesInRange(target, maxAttackRange, &Enemy::getAttackRange);
+}
+
+bool Level::hasLineOfSight(const Vector2D&from, const Vector2D&to) const {
+    return tileMap.hasLineOfSight({from.x, from.y + EYE_HEIGHT}, {to.x, to.y + EYE_HEIGHT});
+}
+
+std::vector<int> Level::getEnemiesInReach(const Vector2D&target) const {
+    const auto candidates = getEnemiesInAttackRange(target);
+    std::vector<RaySegment> rays;
+    rays.reserve(candidates.size());
+    for (const int candidate: candidates) {
+        const Vector2D position = enemies[enemyIndex.at(candidate)].getPosition();
+        rays.push_back({{position.x, position.y + EYE_HEIGHT}, {target.x, target.y + EYE_HEIGHT}});
+    }
+    std::vector<std::uint8_t> visible;
+    tileMap.hasLineOfSight(rays, visible);
+    std::vector<int> ids;
+    ids.reserve(candidates.size());
+    for (std::size_t i = 0; i < candidates.size(); ++i) {
+        if (visible[i]) {
+            ids.push_back(candidates[i]);
+        }
+    }
+    return ids;
+}
+
+std::vector<int> Level::getEnemiesReadyToAttack(const Vector2D&target) const {
+    std::vector<int> ids = getEnemiesInReach(target);
+    std::erase_if(ids, [this](const int id) {
+        return (cooldowns.getMask(enemyIndex.at(id)) & CooldownTable::attackBits()) == 0;
+    });
+    return ids;
+}
+
+std::vector<int> Level::getEnemyIds() const {
+    std::vector<int> ids;
+    ids.reserve(enemies.size());
+    for (const auto&enemy: enemies) {
+        ids.push_back(enemy.getId());
+    }
+    return ids;
+}
+
 Enemy Level::getEnemy(const int enemyId) const {
-    if (!enemies.contains(enemyId)) {
+    if (!enemyIndex.contains(enemyId)) {
+        throw std::invalid_argument("No enemy with id " + std::to_string(enemyId));
+    }
+    return enemies[enemyIndex.at(enemyId)];
+}
+
+const Enemy& Level::findEnemy(const int enemyId) const {
+    const auto it = enemyIndex.find(enemyId);
+    if (it == enemyIndex.end()) {
         throw std::invalid_argument("No enemy with id " + std::to_string(enemyId));
     }
-    return enemies.at(enemyId);
+    return enemies[it->second];
 }
 
 bool Level::isAValidEnemyId(const int id) const {
-    return enemies.contains(id);
+    return enemyIndex.contains(id);
 }
 
-bool Level::isValidCoordinates(const int x, const int y) {
-    return x >= 0 && x < LENGTH && y >= 0 && y < HEIGHT; 
+bool Level::isValidCoordinates(const int x, const int y) const {
+    return x >= 0 && x < length && y >= 0 && y < height;
 }
 
 std::tuple<std::tuple<int, int>, int> Level::getAnExistingSpawn() const {
-    for (int i = 0; i < LENGTH; ++i) {
-        for (int j = 0; j < HEIGHT; ++j) {
+    for (int i = 0; i < static_cast<int>(areas.size()); ++i) {
+        for (int j = 0; j < static_cast<int>(areas[i].size()); ++j) {
             if (areas[i][j].get_type() != 0 && !areas[i][j].get_spawn_ids().empty()) {
                 return std::make_tuple(std::make_tuple(i, j), areas[i][j].get_spawn_ids().at(0));
             }
@@ -209,10 +648,12 @@ int Level::activateBossSpawn(const int area_x, const int area_y, const int area_
         throw std::runtime_error(
             "Cannot spawn boss at area (" + std::to_string(area_x) + ", " + std::to_string(area_y) + ")");
     }
+    const Vector2D position = getSpawnPosition(area_x, area_y, area_id);
     areas.at(area_x).at(area_y).spawnBoss(area_id);
-    Enemy enemy = DefinedEnemies::getRandomEnemy(true);
-    enemies.emplace(enemy.getId(), enemy);
-    return enemy.getId();
+    reschedule(area_x, area_y, area_id);
+    Enemy boss = DefinedEnemies::getRandomEnemy(true);
+    boss.setPosition(position);
+    return addEnemy(boss);
 }
 
 bool Level::canActivateBossSpawn(const int area_x, const int area_y) const {
@@ -228,17 +669,129 @@ Item Level::openChest(const int area_x, const int area_y, const int chest_id) {
 }
 
 void Level::hurtEnemy(const int id, const int damage) {
-    if (!enemies.contains(id)) {
-        throw std::invalid_argument("No enemy with id " + std::to_string(id));
+    awakeEnemyAt(id).hurt(damage);
+    refreshCooldowns(enemyIndex.at(id));
+}
+
+void Level::findEnemiesInArea(const Vector2D&center, const int facing, const AreaOfEffect&area, const int damage,
+                              std::vector<AreaHit>&hits) const {
+    hits.clear();
+    std::vector<int> candidates;
+    enemyGrid.queryRadius(center, area.radius, candidates);
+    hits.reserve(candidates.size());
+    for (const int candidate: candidates) {
+        const Enemy&enemy = enemies[enemyIndex.at(candidate)];
+        const Vector2D position = enemy.getPosition();
+        if (enemy.getHealth().current > 0 && area.contains({position.x - center.x, position.y - center.y}, facing)) {
+            hits.push_back({candidate, area.damageAt(damage, std::sqrt(position.squaredDistanceTo(center)))});
+        }
     }
-    enemies.at(id).hurt(damage);
+}
+
+void Level::resolveEnemyHits(const std::span<const DamageHit> hits, std::vector<DamageResult>&results) {
+    for (std::size_t first = 0; first < hits.size();) {
+        const std::size_t last = DamageBuffer::endOfTarget(hits, first);
+        const auto slot = enemyIndex.find(hits[first].targetId);
+        if (slot != enemyIndex.end() && enemies[slot->second].getHealth().current > 0) {
+            if (interest.wake(slot->second)) {
+                fastForward(slot->second);
+            }
+            Enemy&enemy = enemies[slot->second];
+            const DamageResult result = DamageBuffer::total(enemy, hits.subspan(first, last - first));
+            enemy.hurt(result.damage);
+            if (result.hurtStarted) {
+                // Only a hurt animation starting changes the readiness of the capabilities.
+                refreshCooldowns(slot->second);
+            }
+            results.push_back(result);
+        }
+        first = last;
+    }
+}
+
+int Level::fireProjectile(const int ownerId, const bool isHostile, const Vector2D&position, const Vector2D&velocity,
+                          const int damage, const double lifetime) {
+    return projectiles.spawn(ownerId, isHostile, position, velocity, damage, lifetime);
+}
+
+void Level::stepProjectiles(const double elapsedSeconds, const std::span<const int> playerIds,
+                            const std::span<const Vector2D> playerPositions, std::vector<DamageHit>&hits) {
+    projectiles.step(elapsedSeconds, tileMap, enemyGrid, [this](const int id) {
+        return enemies[enemyIndex.at(id)].getHealth().current > 0;
+    }, playerIds, playerPositions, hits);
+}
+
+const ProjectilePool& Level::getProjectiles() const {
+    return projectiles;
 }
 
 int Level::attackEnemy(const int id, const std::string& attackName) {
-    if (!enemies.contains(id)) {
-        throw std::invalid_argument("No enemy with id " + std::to_string(id));
+    const int damage = enemyAt(id).attack(attackName);
+    refreshCooldowns(enemyIndex.at(id));
+    return damage;
+}
+
+void Level::landEnemy(const int id) {
+    enemyAt(id).land();
+    refreshCooldowns(enemyIndex.at(id));
+}
+
+void Level::trackModifier(const std::size_t slot, const Modifier&modifier) {
+    if (modifier.expiresAt != ModifierStack::TimePoint::max() && std::ranges::find(buffedEnemies, slot) == buffedEnemies.end()) {
+        buffedEnemies.push_back(slot);
+    }
+}
+
+void Level::truncateEnemies(const std::size_t count) {
+    if (count >= enemies.size()) {
+        return;
+    }
+    for (std::size_t slot = count; slot < enemies.size(); ++slot) {
+        enemyIndex.erase(enemies[slot].getId());
+        enemyGrid.remove(enemies[slot].getId());
+    }
+    enemies.erase(enemies.begin() + static_cast<std::ptrdiff_t>(count), enemies.end());
+    interest.truncate(count);
+    cooldowns.truncate(count);
+    std::erase_if(buffedEnemies, [count](const std::size_t slot) { return slot >= count; });
+}
+
+void Level::addEnemyModifier(const int id, const Modifier&modifier) {
+    enemyAt(id).addModifier(modifier);
+    trackModifier(enemyIndex.at(id), modifier);
+}
+
+void Level::refreshEnemyModifier(const int id, const Modifier&modifier) {
+    enemyAt(id).refreshModifier(modifier);
+    trackModifier(enemyIndex.at(id), modifier);
+}
+
+void Level::bleedEnemy(const int id, const int damage) {
+    enemyAt(id).loseHealth(damage);
+}
+
+void Level::expireEnemyModifiers(const ModifierStack::TimePoint now) {
+    std::erase_if(buffedEnemies, [this, now](const std::size_t slot) {
+        enemies[slot].expireModifiers(now);
+        return enemies[slot].getModifiers().getNextExpiry() == ModifierStack::TimePoint::max();
+    });
+}
+
+void Level::updateReadiness(const std::chrono::time_point<std::chrono::steady_clock> now) {
+    cooldowns.computeMasks(now);
+}
+
+void Level::getEnemyReadiness(std::vector<int>&ids, std::vector<CooldownTable::Mask>&masks) const {
+    ids = getEnemyIds();
+    masks = cooldowns.getMasks();
+}
+
+void Level::getEnemyAttackStates(const std::chrono::time_point<std::chrono::steady_clock> now,
+                                 std::vector<AttackState>&states) const {
+    states.reserve(states.size() + enemies.size());
+    for (const Enemy&enemy: enemies) {
+        states.push_back(enemy.getAttackState(now));
     }
-    return enemies.at(id).attack(attackName);
 }
 
 Enemy Level::getARandomEnemy(double difficulty_coefficient) {
@@ -246,18 +799,27 @@ Enemy Level::getARandomEnemy(double difficulty_coefficient) {
         throw std::invalid_argument("Difficulty coefficient must be greater than or equal to 1.0");
     }
     Enemy enemy = DefinedEnemies::getRandomEnemy(false);
-    enemy.increaseMaxHealth(enemy.getHealth().max * difficulty_coefficient - enemy.getHealth().max);
-    for (const auto& attack_name: enemy.getAllAttackName()) {
-        const auto amount = enemy.getAttack(attack_name).getDamage() * difficulty_coefficient - enemy.getAttack(attack_name).
-                      getDamage();
-        enemy.increaseAttackDamage(amount, {attack_name});
-    }
-    enemy.increaseMovementForce(
-        "RUN", enemy.getMovement("RUN")->getForce() * difficulty_coefficient - enemy.getMovement("RUN")->getForce());
+    for (const Stats stat: {MAX_HEALTH, ATTACK_DAMAGE, RUN_FORCE}) {
+        enemy.addModifier({stat, DIFFICULTY, 0.0, difficulty_coefficient});
+    }
     return enemy;
 }
 
 void Level::unload() {
     enemies = {};
+    enemyIndex = {};
+    enemyGrid.clear();
+    maxFollowRange = 0.0;
+    maxAttackRange = 0.0;
     areas = {};
+    tileMap = {};
+    navigation = {};
+    chaseField = {};
+    ledges = {};
+    interest = InterestManager();
+    cooldowns = CooldownTable();
+    buffedEnemies.clear();
+    projectiles = ProjectilePool();
+    spawnScheduler.clear();
+    spawnPointCount = 0;
 }
@@ -0,0 +1,69 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "ModifierStack.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+ModifierStack::ModifierStack() {
+    multipliers.fill(1.0);
+}
+
+void ModifierStack::aggregate() {
+    added.fill(0.0);
+    multipliers.fill(1.0);
+    nextExpiry = TimePoint::max();
+    for (const Modifier&modifier: modifiers) {
+        added[modifier.stat] += modifier.added;
+        multipliers[modifier.stat] *= modifier.multiplier;
+        nextExpiry = std::min(nextExpiry, modifier.expiresAt);
+    }
+}
+
+void ModifierStack::add(const Modifier&modifier) {
+    if (modifier.multiplier < 0) {
+        throw std::invalid_argument("Multiplier must be positive");
+    }
+    modifiers.push_back(modifier);
+    added[modifier.stat] += modifier.added;
+    multipliers[modifier.stat] *= modifier.multiplier;
+    nextExpiry = std::min(nextExpiry, modifier.expiresAt);
+}
+
+bool ModifierStack::refresh(const Modifier&modifier) {
+    const auto it = std::ranges::find_if(modifiers, [&modifier](const Modifier&candidate) {
+        return candidate.stat == modifier.stat && candidate.source == modifier.source &&
+               candidate.added == modifier.added && candidate.multiplier == modifier.multiplier;
+    });
+    if (it == modifiers.end()) {
+        return false;
+    }
+    it->expiresAt = std::max(it->expiresAt, modifier.expiresAt);
+    aggregate();
+    return true;
+}
+
+bool ModifierStack::expire(const TimePoint now) {
+    if (now < nextExpiry) {
+        return false;
+    }
+    std::erase_if(modifiers, [now](const Modifier&modifier) {
+        return modifier.expiresAt <= now;
+    });
+    // Removing a multiplier by division would accumulate rounding errors, the aggregates are summed again.
+    aggregate();
+    return true;
+}
+
+double ModifierStack::apply(const Stats stat, const double base) const {
+    return (base + added[stat]) * multipliers[stat];
+}
+
+ModifierStack::TimePoint ModifierStack::getNextExpiry() const {
+    return nextExpiry;
+}
+
+const std::vector<Modifier>& ModifierStack::getModifiers() const {
+    return modifiers;
+}
@@ -6,16 +6,17 @@
 #endif
 #include "pch.h"
 #include "Movement.hpp"
+#include <algorithm>
 
 Movement::Movement(std::string name, const double force, const double animationTime, const double cooldown) : name(std::move(name)),
     force(force), animationTime(animationTime), cooldown(cooldown) {
 }
 
-bool Movement::isUsing() const {
+bool Movement::isUsing(const std::chrono::time_point<std::chrono::steady_clock> now) const {
     if (lastUsageTime.time_since_epoch().count() == 0) {
         return false;
     }
-    return std::chrono::steady_clock::now() - lastUsageTime < std::chrono::duration<double>(animationTime);
+    return now - lastUsageTime < std::chrono::duration<double>(animationTime);
 }
 
 bool Movement::canUse() const {
@@ -41,6 +42,23 @@ std::chrono::time_point<std::chrono::steady_clock> Movement::getLastUsageTime()
     return lastUsageTime;
 }
 
+std::chrono::time_point<std::chrono::steady_clock> Movement::getEndTime() const {
+    return lastUsageTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(animationTime));
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Movement::getReadyTime() const {
+    return getEndTime() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(cooldown));
+}
+
+double Movement::getRemainingTime(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    if (lastUsageTime.time_since_epoch().count() == 0) {
+        return 0.0;
+    }
+    return std::max(0.0, std::chrono::duration<double>(getReadyTime() - now).count());
+}
+
 double Movement::getForce() const {
     return force;
 }
@@ -57,9 +75,13 @@ void Movement::stop() {
     // nop
 }
 
-void Movement::increaseForce(const double amount) {
+void Movement::setForce(const double amount) {
     if (amount < 0) {
         throw std::invalid_argument("Amount must be positive");
     }
-    force += amount;
-}
\ No newline at end of file
+    force = amount;
+}
+
+std::shared_ptr<Movement> Movement::clone() const {
+    return std::make_shared<Movement>(*this);
+}
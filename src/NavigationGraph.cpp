@@ -0,0 +1,179 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "NavigationGraph.hpp"
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace {
+    /// Gateway directions by index, in the same order as Direction: right, up, left, down.
+    constexpr std::array<Direction2D, 4> GATEWAYS{{{1, 0}, {0, 1}, {-1, 0}, {0, -1}}};
+
+    /**
+     * @brief Retrieves the index of the opposite gateway.
+     * @param gateway The index of a gateway.
+     * @return The index of the opposite gateway.
+     */
+    constexpr int opposite(const int gateway) {
+        return (gateway + 2) % 4;
+    }
+}
+
+NavigationGraph::NavigationGraph(const std::vector<std::vector<Area>>&areas)
+    : length(static_cast<int>(areas.size())), height(areas.empty() ? 0 : static_cast<int>(areas[0].size())) {
+    if (std::ranges::any_of(areas, [this](const auto&column) {
+        return static_cast<int>(column.size()) != height;
+    })) {
+        throw std::invalid_argument("The areas of a navigation graph must form a rectangle");
+    }
+    std::vector<std::uint8_t> declared(static_cast<std::size_t>(length) * height, 0);
+    for (int x = 0; x < length; ++x) {
+        for (int y = 0; y < height; ++y) {
+            if (areas[x][y].get_type() <= 0) {
+                continue;
+            }
+            const auto positions = areas[x][y].get_gateway_positions();
+            for (int gateway = 0; gateway < static_cast<int>(GATEWAYS.size()); ++gateway) {
+                if (positions.contains(GATEWAYS[gateway])) {
+                    declared[index(x, y)] |= 1 << gateway;
+                }
+            }
+        }
+    }
+    gateways.assign(declared.size(), 0);
+    for (int x = 0; x < length; ++x) {
+        for (int y = 0; y < height; ++y) {
+            for (int gateway = 0; gateway < static_cast<int>(GATEWAYS.size()); ++gateway) {
+                const int nx = x + GATEWAYS[gateway].first;
+                const int ny = y + GATEWAYS[gateway].second;
+                if (declared[index(x, y)] & 1 << gateway && contains(nx, ny) &&
+                    declared[index(nx, ny)] & 1 << opposite(gateway)) {
+                    gateways[index(x, y)] |= 1 << gateway;
+                }
+            }
+        }
+    }
+    fields.resize(gateways.size());
+}
+
+std::size_t NavigationGraph::index(const int x, const int y) const {
+    return static_cast<std::size_t>(x) * height + y;
+}
+
+bool NavigationGraph::contains(const int x, const int y) const {
+    return x >= 0 && y >= 0 && x < length && y < height;
+}
+
+const NavigationGraph::Field& NavigationGraph::field(const std::size_t target) {
+    Field&cached = fields[target];
+    if (!cached.distance.empty()) {
+        return cached;
+    }
+    if (cachedFields >= MAX_CACHED_FIELDS) {
+        for (auto&other: fields) {
+            other = {};
+        }
+        cachedFields = 0;
+    }
+    cached.distance.assign(gateways.size(), UNREACHABLE);
+    cached.next.assign(gateways.size(), NO_GATEWAY);
+    std::vector<std::size_t> queue;
+    queue.reserve(gateways.size());
+    queue.push_back(target);
+    cached.distance[target] = 0;
+    // The graph is undirected: a breadth-first search from the target yields every shortest path to it.
+    for (std::size_t head = 0; head < queue.size(); ++head) {
+        const std::size_t current = queue[head];
+        const int x = static_cast<int>(current / height);
+        const int y = static_cast<int>(current % height);
+        for (int gateway = 0; gateway < static_cast<int>(GATEWAYS.size()); ++gateway) {
+            if (!(gateways[current] & 1 << gateway)) {
+                continue;
+            }
+            const std::size_t neighbour = index(x + GATEWAYS[gateway].first, y + GATEWAYS[gateway].second);
+            if (cached.distance[neighbour] != UNREACHABLE) {
+                continue;
+            }
+            cached.distance[neighbour] = static_cast<std::uint16_t>(cached.distance[current] + 1);
+            cached.next[neighbour] = static_cast<std::uint8_t>(opposite(gateway));
+            queue.push_back(neighbour);
+        }
+    }
+    ++cachedFields;
+    return cached;
+}
+
+void NavigationGraph::collectAreasWithin(const int x, const int y, const int radius,
+                                         std::vector<std::size_t>&areas) {
+    areas.clear();
+    if (!contains(x, y) || radius < 0) {
+        return;
+    }
+    visits.resize(gateways.size(), 0);
+    if (++stamp == 0) {
+        std::ranges::fill(visits, 0);
+        stamp = 1;
+    }
+    areas.push_back(index(x, y));
+    visits[areas.front()] = stamp;
+    // The areas are appended ring after ring, each ring starting where the previous one ended.
+    std::size_t ringStart = 0;
+    for (int ring = 0; ring < radius && ringStart < areas.size(); ++ring) {
+        const std::size_t ringEnd = areas.size();
+        for (std::size_t i = ringStart; i < ringEnd; ++i) {
+            const std::size_t current = areas[i];
+            const int currentX = static_cast<int>(current / height);
+            const int currentY = static_cast<int>(current % height);
+            for (int gateway = 0; gateway < static_cast<int>(GATEWAYS.size()); ++gateway) {
+                if (!(gateways[current] & 1 << gateway)) {
+                    continue;
+                }
+                const std::size_t neighbour = index(currentX + GATEWAYS[gateway].first,
+                                                    currentY + GATEWAYS[gateway].second);
+                if (visits[neighbour] != stamp) {
+                    visits[neighbour] = stamp;
+                    areas.push_back(neighbour);
+                }
+            }
+        }
+        ringStart = ringEnd;
+    }
+}
+
+bool NavigationGraph::isConnected(const int x, const int y, const Direction2D&direction) const {
+    if (!contains(x, y)) {
+        return false;
+    }
+    const auto gateway = std::ranges::find(GATEWAYS, direction);
+    return gateway != GATEWAYS.end() && gateways[index(x, y)] & 1 << (gateway - GATEWAYS.begin());
+}
+
+int NavigationGraph::getDistance(const int fromX, const int fromY, const int toX, const int toY) {
+    if (!contains(fromX, fromY) || !contains(toX, toY)) {
+        return -1;
+    }
+    const std::uint16_t distance = field(index(toX, toY)).distance[index(fromX, fromY)];
+    return distance == UNREACHABLE ? -1 : distance;
+}
+
+Direction2D NavigationGraph::getNextGateway(const int fromX, const int fromY, const int toX, const int toY) {
+    if (!contains(fromX, fromY) || !contains(toX, toY)) {
+        return {0, 0};
+    }
+    const std::uint8_t next = field(index(toX, toY)).next[index(fromX, fromY)];
+    return next == NO_GATEWAY ? Direction2D{0, 0} : GATEWAYS[next];
+}
+
+int NavigationGraph::getLength() const {
+    return length;
+}
+
+int NavigationGraph::getHeight() const {
+    return height;
+}
+
+std::size_t NavigationGraph::getCachedFieldCount() const {
+    return cachedFields;
+}
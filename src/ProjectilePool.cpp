@@ -0,0 +1,159 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "ProjectilePool.hpp"
+#include <stdexcept>
+
+ProjectilePool::ProjectilePool(const std::size_t capacity) : capacity(capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be strictly positive");
+    }
+}
+
+void ProjectilePool::removeAt(const std::size_t index) {
+    const std::size_t last = ids.size() - 1;
+    if (index != last) {
+        ids[index] = ids[last];
+        xs[index] = xs[last];
+        ys[index] = ys[last];
+        velocitiesX[index] = velocitiesX[last];
+        velocitiesY[index] = velocitiesY[last];
+        lifetimes[index] = lifetimes[last];
+        owners[index] = owners[last];
+        damages[index] = damages[last];
+        hostile[index] = hostile[last];
+    }
+    ids.pop_back();
+    xs.pop_back();
+    ys.pop_back();
+    velocitiesX.pop_back();
+    velocitiesY.pop_back();
+    lifetimes.pop_back();
+    owners.pop_back();
+    damages.pop_back();
+    hostile.pop_back();
+}
+
+int ProjectilePool::spawn(const int ownerId, const bool isHostile, const Vector2D&position, const Vector2D&velocity,
+                          const int damage, const double lifetime) {
+    if (damage < 0) {
+        throw std::invalid_argument("Damage must be positive");
+    }
+    if (lifetime <= 0) {
+        throw std::invalid_argument("Lifetime must be strictly positive");
+    }
+    if (ids.size() >= capacity) {
+        return -1;
+    }
+    if (ids.capacity() < capacity) {
+        // Reserved once so that the arrays never move while projectiles are in flight.
+        ids.reserve(capacity);
+        xs.reserve(capacity);
+        ys.reserve(capacity);
+        velocitiesX.reserve(capacity);
+        velocitiesY.reserve(capacity);
+        lifetimes.reserve(capacity);
+        owners.reserve(capacity);
+        damages.reserve(capacity);
+        hostile.reserve(capacity);
+    }
+    const int id = nextId++;
+    ids.push_back(id);
+    xs.push_back(position.x);
+    ys.push_back(position.y);
+    velocitiesX.push_back(velocity.x);
+    velocitiesY.push_back(velocity.y);
+    lifetimes.push_back(lifetime);
+    owners.push_back(ownerId);
+    damages.push_back(damage);
+    hostile.push_back(isHostile ? 1 : 0);
+    return id;
+}
+
+void ProjectilePool::step(const double elapsedSeconds, const TileMap&tiles, const SpatialGrid&enemies,
+                          const std::function<bool(int)>&isAlive, const std::span<const int> playerIds,
+                          const std::span<const Vector2D> playerPositions, std::vector<DamageHit>&hits) {
+    std::size_t i = 0;
+    while (i < ids.size()) {
+        const Vector2D from{xs[i], ys[i]};
+        const Vector2D to{from.x + velocitiesX[i] * elapsedSeconds, from.y + velocitiesY[i] * elapsedSeconds};
+        xs[i] = to.x;
+        ys[i] = to.y;
+        lifetimes[i] -= elapsedSeconds;
+        // A path shorter than a tile cannot skip one, its end is enough.
+        bool spent = from.squaredDistanceTo(to) < 1.0 ? tiles.isSolidAt(to) : tiles.raycast({from, to}).blocked;
+        if (!spent) {
+            int targetId = -1;
+            if (hostile[i] != 0) {
+                for (std::size_t player = 0; player < playerIds.size() && targetId < 0; ++player) {
+                    const Vector2D center{playerPositions[player].x, playerPositions[player].y + HIT_HEIGHT};
+                    if (to.squaredDistanceTo(center) <= HIT_RADIUS * HIT_RADIUS) {
+                        targetId = playerIds[player];
+                    }
+                }
+            }
+            else {
+                // The index holds the feet of the enemies, the query is lowered to their centers.
+                const Vector2D feet{to.x, to.y - HIT_HEIGHT};
+                candidates.clear();
+                enemies.queryRadius(feet, HIT_RADIUS, candidates);
+                for (const int candidate: candidates) {
+                    if (isAlive(candidate)) {
+                        targetId = candidate;
+                        break;
+                    }
+                }
+            }
+            if (targetId >= 0) {
+                hits.push_back({owners[i], targetId, damages[i]});
+                spent = true;
+            }
+        }
+        if (spent || lifetimes[i] <= 0) {
+            removeAt(i);
+            continue;
+        }
+        ++i;
+    }
+}
+
+std::size_t ProjectilePool::size() const {
+    return ids.size();
+}
+
+std::size_t ProjectilePool::getCapacity() const {
+    return capacity;
+}
+
+std::span<const int> ProjectilePool::getIds() const {
+    return ids;
+}
+
+std::span<const double> ProjectilePool::getPositionsX() const {
+    return xs;
+}
+
+std::span<const double> ProjectilePool::getPositionsY() const {
+    return ys;
+}
+
+std::span<const double> ProjectilePool::getVelocitiesX() const {
+    return velocitiesX;
+}
+
+std::span<const double> ProjectilePool::getVelocitiesY() const {
+    return velocitiesY;
+}
+
+void ProjectilePool::clear() {
+    ids.clear();
+    xs.clear();
+    ys.clear();
+    velocitiesX.clear();
+    velocitiesY.clear();
+    lifetimes.clear();
+    owners.clear();
+    damages.clear();
+    hostile.clear();
+}
@@ -21,10 +21,14 @@ void Run::stop() {
     running = false;
 }
 
-bool Run::isUsing() const {
+bool Run::isUsing(std::chrono::time_point<std::chrono::steady_clock>) const {
     return running;
 }
 
 bool Run::canUse() const {
     return true;
-}
\ No newline at end of file
+}
+
+std::shared_ptr<Movement> Run::clone() const {
+    return std::make_shared<Run>(*this);
+}
@@ -0,0 +1,1088 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "Snapshot.hpp"
+#include "Climb.hpp"
+#include "Enemies.hpp"
+#include "Game.hpp"
+#include "GameState.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <stdexcept>
+#ifndef _WIN64
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(SnapshotHeader) == 184, "SnapshotHeader must not be padded");
+static_assert(sizeof(SnapshotGame) == 48, "SnapshotGame must not be padded");
+static_assert(sizeof(SnapshotArea) == 32, "SnapshotArea must not be padded");
+static_assert(sizeof(SnapshotSpawn) == 24, "SnapshotSpawn must not be padded");
+static_assert(sizeof(SnapshotChest) == 16, "SnapshotChest must not be padded");
+static_assert(sizeof(SnapshotCharacter) == 184, "SnapshotCharacter must not be padded");
+static_assert(sizeof(SnapshotAttack) == 72, "SnapshotAttack must not be padded");
+static_assert(sizeof(SnapshotMovement) == 48, "SnapshotMovement must not be padded");
+static_assert(sizeof(SnapshotModifier) == 32, "SnapshotModifier must not be padded");
+static_assert(sizeof(SnapshotItem) == 8, "SnapshotItem must not be padded");
+static_assert(sizeof(SnapshotStatusEffect) == 24, "SnapshotStatusEffect must not be padded");
+
+struct Snapshot::Records {
+    SnapshotGame game{}; ///< The state of the game.
+    std::vector<SnapshotArea> areas; ///< The areas of the active level.
+    std::vector<SnapshotSpawn> spawns; ///< The spawn points of the areas.
+    std::vector<SnapshotChest> chests; ///< The chests of the areas.
+    std::vector<SnapshotCharacter> characters; ///< The players, then the enemies.
+    std::vector<SnapshotAttack> attacks; ///< The attacks of the characters.
+    std::vector<SnapshotMovement> movements; ///< The movements of the characters.
+    std::vector<SnapshotModifier> modifiers; ///< The modifiers of the characters.
+    std::vector<SnapshotItem> items; ///< The items of the characters.
+    std::vector<SnapshotStatusEffect> statusEffects; ///< The status effects of the characters.
+};
+
+struct Snapshot::Sections {
+    std::span<const SnapshotGame> game; ///< The state of the game, a single record.
+    std::span<const SnapshotArea> areas; ///< The areas of the active level.
+    std::span<const SnapshotSpawn> spawns; ///< The spawn points of the areas.
+    std::span<const SnapshotChest> chests; ///< The chests of the areas.
+    std::span<const SnapshotCharacter> characters; ///< The players, then the enemies.
+    std::span<const SnapshotAttack> attacks; ///< The attacks of the characters.
+    std::span<const SnapshotMovement> movements; ///< The movements of the characters.
+    std::span<const SnapshotModifier> modifiers; ///< The modifiers of the characters.
+    std::span<const SnapshotItem> items; ///< The items of the characters.
+    std::span<const SnapshotStatusEffect> statusEffects; ///< The status effects of the characters.
+};
+
+namespace {
+    using TimePoint = Snapshot::TimePoint;
+
+    /**
+     * @brief Retrieves the gateways in the order of the bits of SnapshotArea::gateways.
+     * @return The gateways.
+     */
+    std::array<Direction2D, 4> gatewayBits() {
+        return {Direction::RIGHT, Direction::DOWN, Direction::LEFT, Direction::UP};
+    }
+
+    /**
+     * @brief Stores a time relative to the time of the save.
+     * @param time The time.
+     * @param now The time of the save.
+     * @return The stored time.
+     */
+    std::int64_t toStored(const TimePoint time, const TimePoint now) {
+        if (time == TimePoint{}) {
+            return Snapshot::NEVER;
+        }
+        if (time == TimePoint::max()) {
+            return Snapshot::FOREVER;
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time - now).count();
+    }
+
+    /**
+     * @brief Rebases a stored time on the time of the load.
+     * @param stored The stored time.
+     * @param now The time of the load.
+     * @return The time.
+     */
+    TimePoint fromStored(const std::int64_t stored, const TimePoint now) {
+        if (stored == Snapshot::NEVER) {
+            return {};
+        }
+        if (stored == Snapshot::FOREVER) {
+            return TimePoint::max();
+        }
+        return now + std::chrono::duration_cast<TimePoint::duration>(std::chrono::nanoseconds(stored));
+    }
+
+    /**
+     * @brief Appends a section to a snapshot, aligned on 8 bytes, and records it in the header.
+     * @param bytes The snapshot.
+     * @param header The header.
+     * @param section The section.
+     * @param records The records of the section.
+     */
+    template<typename T>
+    void appendSection(std::vector<std::byte>&bytes, SnapshotHeader&header, const SnapshotSections section,
+                       const std::span<const T> records) {
+        const std::size_t offset = (bytes.size() + 7) & ~static_cast<std::size_t>(7);
+        bytes.resize(offset + records.size_bytes());
+        if (!records.empty()) {
+            std::memcpy(bytes.data() + offset, records.data(), records.size_bytes());
+        }
+        header.sections[section] = {offset, static_cast<std::uint32_t>(records.size()), sizeof(T)};
+    }
+
+    /**
+     * @brief Views a section of a snapshot in place, after checking its bounds.
+     * @param bytes The snapshot.
+     * @param header The header.
+     * @param section The section.
+     * @return The records of the section.
+     * @throws std::invalid_argument If the section lies outside the snapshot or has records of another size.
+     */
+    template<typename T>
+    std::span<const T> sectionOf(const std::span<const std::byte> bytes, const SnapshotHeader&header,
+                                 const SnapshotSections section) {
+        const auto&[offset, count, recordSize] = header.sections[section];
+        if (recordSize != sizeof(T)) {
+            throw std::invalid_argument("Invalid snapshot: unexpected record size");
+        }
+        if (offset % 8 != 0 || offset < sizeof(SnapshotHeader) || offset > header.totalSize ||
+            static_cast<std::uint64_t>(count) * sizeof(T) > header.totalSize - offset) {
+            throw std::invalid_argument("Invalid snapshot: section out of bounds");
+        }
+        return {reinterpret_cast<const T*>(bytes.data() + offset), count};
+    }
+
+    /**
+     * @brief Checks that a range of records lies within its section.
+     * @param first The index of the first record.
+     * @param count The number of records.
+     * @param size The number of records of the section.
+     * @throws std::invalid_argument If the range overflows the section.
+     */
+    void checkRange(const std::uint32_t first, const std::uint32_t count, const std::size_t size) {
+        if (first > size || count > size - first) {
+            throw std::invalid_argument("Invalid snapshot: record range out of bounds");
+        }
+    }
+
+    /**
+     * @brief Checks that a stored value is a value of an enumeration.
+     * @param value The value.
+     * @throws std::invalid_argument If it is not.
+     */
+    template<typename E>
+    void checkEnum(const std::int32_t value) {
+        if (!magic_enum::enum_cast<E>(value).has_value()) {
+            throw std::invalid_argument("Invalid snapshot: unknown " + std::string(magic_enum::enum_type_name<E>()));
+        }
+    }
+
+    /**
+     * @class MappedFile
+     * @brief A file mapped read-only in memory, unmapped on destruction.
+     */
+    class MappedFile {
+        const std::byte* data = nullptr; ///< The first byte of the mapping.
+        std::size_t size = 0; ///< The size of the file.
+#ifdef _WIN64
+        HANDLE mapping = nullptr; ///< The mapping object.
+#endif
+
+    public:
+        /**
+         * @brief Maps a file.
+         * @param path The path of the file.
+         * @throws std::runtime_error If the file cannot be opened or mapped.
+         */
+        explicit MappedFile(const std::string&path) {
+#ifdef _WIN64
+            const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                            FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE) {
+                throw std::runtime_error("Cannot open snapshot " + path);
+            }
+            LARGE_INTEGER length;
+            if (!GetFileSizeEx(file, &length)) {
+                CloseHandle(file);
+                throw std::runtime_error("Cannot read the size of snapshot " + path);
+            }
+            size = static_cast<std::size_t>(length.QuadPart);
+            if (size > 0) {
+                mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping != nullptr) {
+                    data = static_cast<const std::byte*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                }
+            }
+            CloseHandle(file);
+            if (size > 0 && data == nullptr) {
+                if (mapping != nullptr) {
+                    CloseHandle(mapping);
+                }
+                throw std::runtime_error("Cannot map snapshot " + path);
+            }
+#else
+            const int file = open(path.c_str(), O_RDONLY);
+            if (file < 0) {
+                throw std::runtime_error("Cannot open snapshot " + path);
+            }
+            struct stat status{};
+            if (fstat(file, &status) != 0) {
+                close(file);
+                throw std::runtime_error("Cannot read the size of snapshot " + path);
+            }
+            size = static_cast<std::size_t>(status.st_size);
+            if (size > 0) {
+                void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+                if (mapped == MAP_FAILED) {
+                    close(file);
+                    throw std::runtime_error("Cannot map snapshot " + path);
+                }
+                data = static_cast<const std::byte*>(mapped);
+            }
+            close(file);
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile() {
+            if (data == nullptr) {
+                return;
+            }
+#ifdef _WIN64
+            UnmapViewOfFile(data);
+            CloseHandle(mapping);
+#else
+            munmap(const_cast<std::byte*>(data), size);
+#endif
+        }
+
+        /**
+         * @brief Retrieves the content of the file.
+         * @return The bytes of the file.
+         */
+        [[nodiscard]] std::span<const std::byte> bytes() const {
+            return {data, size};
+        }
+    };
+}
+
+void Snapshot::saveCharacter(const Character&character, const Enemy* enemy, Records&records, const TimePoint now) {
+    SnapshotCharacter record{};
+    record.x = character.position.x;
+    record.y = character.position.y;
+    record.velocityX = character.velocity.x;
+    record.velocityY = character.velocity.y;
+    record.runInput = character.runInput;
+    record.baseRunForce = character.baseRunForce;
+    record.hurtTime = character.hurtAnimation.duration;
+    record.hurtStart = toStored(character.hurtAnimation.lastUsage, now);
+    record.id = character.id;
+    record.type = SNAPSHOT_PLAYER;
+    if (enemy != nullptr) {
+        record.type = DefinedEnemies::getId(character.type);
+        record.followRange = enemy->getFollowRange();
+        record.attackRange = enemy->getAttackRange();
+        record.boss = enemy->getIsBoss();
+    }
+    record.health = character.health.current;
+    record.baseMaxHealth = character.baseMaxHealth;
+    record.baseJumpCount = character.baseJumpCount;
+    record.facing = character.facing;
+    record.onGround = character.onGround;
+
+    const Capabilities&capabilities = character.capabilities;
+    const JetPack&jetPack = capabilities.jetPack;
+    record.jetPackForce = jetPack.force;
+    record.jetPackMaxTime = jetPack.maxTime;
+    record.jetPackCooldown = jetPack.cooldown;
+    record.jetPackLanding = jetPack.landingAnimationTime;
+    record.jetPackStart = toStored(jetPack.lastJetpackUse, now);
+    record.jetPackInUse = jetPack.inUse;
+
+    record.firstAttack = static_cast<std::uint32_t>(records.attacks.size());
+    record.attackCount = static_cast<std::uint32_t>(capabilities.attacks.size());
+    for (std::size_t i = 0; i < capabilities.attacks.size(); ++i) {
+        const Attack&attack = capabilities.attacks[i];
+        records.attacks.push_back({
+            toStored(attack.lastUsageTime, now), toStored(attack.chargedTime, now),
+            toStored(attack.recoveryTime, now), toStored(attack.endTime, now), toStored(attack.readyTime, now),
+            attack.cooldown, attack.chargeTime, attack.animationTime,
+            magic_enum::enum_cast<Attacks>(attack.name).value_or(ATTACK1),
+            i < character.baseAttackDamages.size() ? character.baseAttackDamages[i] : attack.damage
+        });
+    }
+
+    record.firstMovement = static_cast<std::uint32_t>(records.movements.size());
+    record.movementCount = static_cast<std::uint32_t>(capabilities.movements.size());
+    for (const auto&[name, movement]: capabilities.movements) {
+        SnapshotMovement stored{};
+        stored.lastUsage = toStored(movement->lastUsageTime, now);
+        stored.force = movement->force;
+        stored.animationTime = movement->animationTime;
+        stored.cooldown = movement->cooldown;
+        stored.movement = magic_enum::enum_cast<Movements>(name).value_or(RUN);
+        if (const auto* jump = dynamic_cast<const Jump*>(movement.get())) {
+            stored.maxUsage = jump->maxUsage;
+            stored.state = jump->currentUsage;
+        }
+        else if (const auto* run = dynamic_cast<const Run*>(movement.get())) {
+            stored.state = run->running;
+        }
+        else if (const auto* climb = dynamic_cast<const Climb*>(movement.get())) {
+            stored.state = climb->climbing;
+        }
+        records.movements.push_back(stored);
+    }
+
+    const std::vector<Modifier>&modifiers = character.modifiers.getModifiers();
+    record.firstModifier = static_cast<std::uint32_t>(records.modifiers.size());
+    record.modifierCount = static_cast<std::uint32_t>(modifiers.size());
+    for (const Modifier&modifier: modifiers) {
+        records.modifiers.push_back({
+            toStored(modifier.expiresAt, now), modifier.added, modifier.multiplier, modifier.stat, modifier.source
+        });
+    }
+
+    record.firstItem = static_cast<std::uint32_t>(records.items.size());
+    for (const auto&[name, count]: character.items) {
+        if (const int item = DefinedItems::getId(name); item >= 0) {
+            records.items.push_back({item, count});
+        }
+    }
+    record.itemCount = static_cast<std::uint32_t>(records.items.size()) - record.firstItem;
+    records.characters.push_back(record);
+}
+
+void Snapshot::saveLevel(const Level&level, Records&records, const TimePoint now) {
+    const auto gateways = gatewayBits();
+    for (const auto&column: level.areas) {
+        for (const Area&area: column) {
+            SnapshotArea record{};
+            record.type = area.type;
+            record.id = area.id;
+            for (std::size_t bit = 0; bit < gateways.size(); ++bit) {
+                if (area.gatewayPositions.contains(gateways[bit])) {
+                    record.gateways |= 1u << bit;
+                }
+            }
+            record.firstSpawn = static_cast<std::uint32_t>(records.spawns.size());
+            record.spawnCount = static_cast<std::uint32_t>(area.spawns.size());
+            for (const Spawn&spawn: area.spawns) {
+                SnapshotSpawn stored{};
+                stored.lastSpawned = toStored(spawn.lastTimeSpawned, now);
+                stored.cooldown = spawn.spawnCoolDown;
+                stored.id = spawn.id;
+                stored.boss = spawn.boss;
+                records.spawns.push_back(stored);
+            }
+            record.firstChest = static_cast<std::uint32_t>(records.chests.size());
+            record.chestCount = static_cast<std::uint32_t>(area.chests.size());
+            for (const Chest&chest: area.chests) {
+                SnapshotChest stored{};
+                stored.id = chest.id;
+                stored.item = DefinedItems::getId(chest.item.getName());
+                stored.empty = chest.empty;
+                records.chests.push_back(stored);
+            }
+            records.areas.push_back(record);
+        }
+    }
+    for (const Enemy&enemy: level.enemies) {
+        saveCharacter(enemy, &enemy, records, now);
+    }
+}
+
+void Snapshot::save(const Game&game, std::vector<std::byte>&bytes, const TimePoint now) {
+    Records records;
+    const Level&level = game.levels.at(game.activeLevel);
+    SnapshotGame&state = records.game;
+    state.difficulty = game.difficulty;
+    state.difficultyUpdate = toStored(game.timeSinceDifficultyUpdate, now);
+    state.nextCharacterId = Character::nextId;
+    state.level = game.activeLevel;
+    state.levelLength = level.getLength();
+    state.levelHeight = level.getHeight();
+    state.playerCount = static_cast<std::int32_t>(game.players.size());
+    state.activationRadius = game.activationRadius;
+    state.over = game.over;
+    state.deferredDamage = game.deferredDamage;
+    state.enemyAI = game.enemyAIEnabled;
+
+    records.characters.reserve(game.players.size() + level.enemies.size());
+    for (const Player&player: game.players) {
+        saveCharacter(player, nullptr, records, now);
+    }
+    saveLevel(level, records, now);
+    for (SnapshotCharacter&record: records.characters | std::views::drop(game.players.size())) {
+        record.behaviour = static_cast<std::uint8_t>(game.behaviours.getScript(record.id) + 1);
+    }
+    for (const StatusEffect&effect: game.statusEffects.getEffects()) {
+        records.statusEffects.push_back({toStored(effect.expiresAt, now), effect.magnitude, effect.characterId, effect.type});
+    }
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    header.headerSize = sizeof(SnapshotHeader);
+    bytes.assign(sizeof(SnapshotHeader), std::byte{0});
+    appendSection(bytes, header, GAME_SECTION, std::span<const SnapshotGame>(&records.game, 1));
+    appendSection<SnapshotArea>(bytes, header, AREA_SECTION, records.areas);
+    appendSection<SnapshotSpawn>(bytes, header, SPAWN_SECTION, records.spawns);
+    appendSection<SnapshotChest>(bytes, header, CHEST_SECTION, records.chests);
+    appendSection<SnapshotCharacter>(bytes, header, CHARACTER_SECTION, records.characters);
+    appendSection<SnapshotAttack>(bytes, header, ATTACK_SECTION, records.attacks);
+    appendSection<SnapshotMovement>(bytes, header, MOVEMENT_SECTION, records.movements);
+    appendSection<SnapshotModifier>(bytes, header, MODIFIER_SECTION, records.modifiers);
+    appendSection<SnapshotItem>(bytes, header, ITEM_SECTION, records.items);
+    appendSection<SnapshotStatusEffect>(bytes, header, STATUS_EFFECT_SECTION, records.statusEffects);
+    header.totalSize = bytes.size();
+    std::memcpy(bytes.data(), &header, sizeof(SnapshotHeader));
+}
+
+void Snapshot::save(const Game&game, const std::string&path) {
+    std::vector<std::byte> bytes;
+    save(game, bytes);
+    // Writing beside the snapshot and renaming keeps the previous one whole if the game crashes meanwhile.
+    const std::string written = path + ".tmp";
+    {
+        std::ofstream file(written, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!file) {
+            throw std::runtime_error("Cannot write snapshot " + written);
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(written, path, error);
+    if (error) {
+        throw std::runtime_error("Cannot replace snapshot " + path + ": " + error.message());
+    }
+}
+
+Snapshot::Sections Snapshot::validate(const std::span<const std::byte> bytes) {
+    SnapshotHeader header{};
+    if (bytes.size() < sizeof(SnapshotHeader)) {
+        throw std::invalid_argument("Invalid snapshot: truncated header");
+    }
+    std::memcpy(&header, bytes.data(), sizeof(SnapshotHeader));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) {
+        throw std::invalid_argument("Invalid snapshot: not a snapshot");
+    }
+    if (header.byteOrder != SNAPSHOT_BYTE_ORDER) {
+        throw std::invalid_argument("Invalid snapshot: saved with another byte order");
+    }
+    if (header.version != SNAPSHOT_VERSION || header.headerSize != sizeof(SnapshotHeader)) {
+        throw std::invalid_argument("Invalid snapshot: unsupported version " + std::to_string(header.version));
+    }
+    if (header.totalSize > bytes.size()) {
+        throw std::invalid_argument("Invalid snapshot: truncated");
+    }
+    if (reinterpret_cast<std::uintptr_t>(bytes.data()) % 8 != 0) {
+        throw std::invalid_argument("Snapshot must be aligned on 8 bytes");
+    }
+
+    Sections sections;
+    sections.game = sectionOf<SnapshotGame>(bytes, header, GAME_SECTION);
+    sections.areas = sectionOf<SnapshotArea>(bytes, header, AREA_SECTION);
+    sections.spawns = sectionOf<SnapshotSpawn>(bytes, header, SPAWN_SECTION);
+    sections.chests = sectionOf<SnapshotChest>(bytes, header, CHEST_SECTION);
+    sections.characters = sectionOf<SnapshotCharacter>(bytes, header, CHARACTER_SECTION);
+    sections.attacks = sectionOf<SnapshotAttack>(bytes, header, ATTACK_SECTION);
+    sections.movements = sectionOf<SnapshotMovement>(bytes, header, MOVEMENT_SECTION);
+    sections.modifiers = sectionOf<SnapshotModifier>(bytes, header, MODIFIER_SECTION);
+    sections.items = sectionOf<SnapshotItem>(bytes, header, ITEM_SECTION);
+    sections.statusEffects = sectionOf<SnapshotStatusEffect>(bytes, header, STATUS_EFFECT_SECTION);
+
+    if (sections.game.size() != 1) {
+        throw std::invalid_argument("Invalid snapshot: expected a single game record");
+    }
+    const SnapshotGame&state = sections.game.front();
+    if (state.level < 0 || state.levelLength < 1 || state.levelHeight < 1 ||
+        sections.areas.size() != static_cast<std::size_t>(state.levelLength) * state.levelHeight) {
+        throw std::invalid_argument("Invalid snapshot: inconsistent level");
+    }
+    if (state.playerCount < 1 || state.playerCount > static_cast<std::int32_t>(Game::MAX_PLAYERS) ||
+        static_cast<std::size_t>(state.playerCount) > sections.characters.size()) {
+        throw std::invalid_argument("Invalid snapshot: invalid number of players");
+    }
+    for (const SnapshotArea&area: sections.areas) {
+        checkRange(area.firstSpawn, area.spawnCount, sections.spawns.size());
+        checkRange(area.firstChest, area.chestCount, sections.chests.size());
+    }
+    for (const SnapshotChest&chest: sections.chests) {
+        if (chest.item >= 0) {
+            checkEnum<Items>(chest.item);
+        }
+    }
+    for (std::size_t i = 0; i < sections.characters.size(); ++i) {
+        const SnapshotCharacter&character = sections.characters[i];
+        if ((character.type == SNAPSHOT_PLAYER) != (i < static_cast<std::size_t>(state.playerCount))) {
+            throw std::invalid_argument("Invalid snapshot: players must come first");
+        }
+        if (character.type != SNAPSHOT_PLAYER) {
+            checkEnum<Enemies>(character.type);
+        }
+        if (character.behaviour != 0) {
+            if (character.type == SNAPSHOT_PLAYER) {
+                throw std::invalid_argument("Invalid snapshot: only enemies run scripts");
+            }
+            checkEnum<Behaviours>(character.behaviour - 1);
+        }
+        checkRange(character.firstAttack, character.attackCount, sections.attacks.size());
+        checkRange(character.firstMovement, character.movementCount, sections.movements.size());
+        checkRange(character.firstModifier, character.modifierCount, sections.modifiers.size());
+        checkRange(character.firstItem, character.itemCount, sections.items.size());
+    }
+    for (const SnapshotAttack&attack: sections.attacks) {
+        checkEnum<Attacks>(attack.attack);
+    }
+    for (const SnapshotMovement&movement: sections.movements) {
+        checkEnum<Movements>(movement.movement);
+        if (movement.movement == JETPACK) {
+            throw std::invalid_argument("Invalid snapshot: the jetpack is not a movement record");
+        }
+    }
+    for (const SnapshotModifier&modifier: sections.modifiers) {
+        checkEnum<Stats>(modifier.stat);
+        checkEnum<ModifierSources>(modifier.source);
+    }
+    for (const SnapshotItem&item: sections.items) {
+        checkEnum<Items>(item.item);
+    }
+    for (const SnapshotStatusEffect&effect: sections.statusEffects) {
+        checkEnum<StatusEffectTypes>(effect.type);
+        if (effect.magnitude < 0) {
+            throw std::invalid_argument("Invalid snapshot: negative status effect");
+        }
+    }
+    return sections;
+}
+
+void Snapshot::loadCharacter(Character&character, const SnapshotCharacter&record, const Sections&sections,
+                             const TimePoint now) {
+    std::vector<Attack> attacks;
+    attacks.reserve(record.attackCount);
+    character.baseAttackDamages.clear();
+    for (const SnapshotAttack&stored: sections.attacks.subspan(record.firstAttack, record.attackCount)) {
+        Attack attack = DefinedAttacks::get(static_cast<Attacks>(stored.attack)).attack;
+        attack.damage = stored.baseDamage;
+        attack.cooldown = stored.cooldown;
+        attack.chargeTime = stored.chargeTime;
+        attack.animationTime = stored.animationTime;
+        attack.lastUsageTime = fromStored(stored.lastUsage, now);
+        attack.chargedTime = fromStored(stored.charged, now);
+        attack.recoveryTime = fromStored(stored.recovery, now);
+        attack.endTime = fromStored(stored.end, now);
+        attack.readyTime = fromStored(stored.ready, now);
+        attacks.push_back(std::move(attack));
+        character.baseAttackDamages.push_back(stored.baseDamage);
+    }
+
+    std::set<std::shared_ptr<Movement>> movements;
+    for (const SnapshotMovement&stored: sections.movements.subspan(record.firstMovement, record.movementCount)) {
+        std::shared_ptr<Movement> movement;
+        switch (static_cast<Movements>(stored.movement)) {
+            case RUN: {
+                auto run = std::make_shared<Run>(stored.force);
+                run->running = stored.state;
+                movement = run;
+                break;
+            }
+            case JUMP: {
+                auto jump = std::make_shared<Jump>(stored.force, stored.maxUsage);
+                jump->currentUsage = stored.state;
+                movement = jump;
+                break;
+            }
+            case CLIMB: {
+                auto climb = std::make_shared<Climb>(stored.force);
+                climb->climbing = stored.state != 0;
+                movement = climb;
+                break;
+            }
+            default:
+                movement = std::make_shared<Dash>(stored.force, stored.animationTime, stored.cooldown);
+                break;
+        }
+        movement->animationTime = stored.animationTime;
+        movement->cooldown = stored.cooldown;
+        movement->lastUsageTime = fromStored(stored.lastUsage, now);
+        movements.insert(std::move(movement));
+    }
+
+    character.capabilities = Capabilities(std::move(attacks), std::move(movements), false);
+    JetPack&jetPack = character.capabilities.jetPack;
+    jetPack = JetPack(record.jetPackForce, record.jetPackMaxTime, record.jetPackCooldown, record.jetPackLanding);
+    jetPack.inUse = record.jetPackInUse != 0;
+    jetPack.lastJetpackUse = fromStored(record.jetPackStart, now);
+
+    character.id = record.id;
+    character.onGround = record.onGround != 0;
+    character.hurtAnimation = Animation(record.hurtTime);
+    character.hurtAnimation.lastUsage = fromStored(record.hurtStart, now);
+    character.position = {record.x, record.y};
+    character.velocity = {record.velocityX, record.velocityY};
+    character.runInput = record.runInput;
+    character.facing = record.facing < 0 ? -1 : 1;
+    character.baseMaxHealth = record.baseMaxHealth;
+    character.baseRunForce = record.baseRunForce;
+    character.baseJumpCount = record.baseJumpCount;
+
+    character.items.clear();
+    for (const auto&[item, count]: sections.items.subspan(record.firstItem, record.itemCount)) {
+        character.items[DefinedItems::getItemName(static_cast<Items>(item))] = count;
+    }
+    character.modifiers = ModifierStack();
+    for (const SnapshotModifier&stored: sections.modifiers.subspan(record.firstModifier, record.modifierCount)) {
+        character.modifiers.add({
+            static_cast<Stats>(stored.stat), static_cast<ModifierSources>(stored.source), stored.added,
+            stored.multiplier, fromStored(stored.expiresAt, now)
+        });
+    }
+    // The modifiers heal the character when they raise its maximum health: its health is restored after them.
+    character.health = {record.baseMaxHealth, record.baseMaxHealth};
+    character.applyModifiers();
+    character.health.current = std::clamp(record.health, 0, character.health.max);
+}
+
+void Snapshot::scheduleTimers(Game&game, const Character&character, const TimePoint now) {
+    const int id = character.id;
+    const auto scheduleRunning = [&game, now](const TimerEvent&event, const TimePoint dueAt) {
+        if (dueAt > now) {
+            game.timers.schedule(event, dueAt);
+        }
+    };
+    // Each state ends with its readiness: the capabilities ready by then, most of them, are skipped without
+    // looking up their names.
+    const Capabilities&capabilities = character.capabilities;
+    for (const Attack&attack: capabilities.attacks) {
+        if (attack.readyTime > now) {
+            const int capability = DefinedAttacks::getAttackValue(attack.name);
+            scheduleRunning({id, ATTACK_CHARGED, capability}, attack.chargedTime);
+            scheduleRunning({id, ATTACK_ENDED, capability}, attack.endTime);
+            scheduleRunning({id, ATTACK_READY, capability}, attack.readyTime);
+        }
+    }
+    for (const auto&[name, movement]: capabilities.movements) {
+        // As Game::scheduleMovementTimers, movements without animation nor cooldown have no events.
+        const bool timed = movement->animationTime > 0 || movement->cooldown > 0;
+        if (timed && movement->getReadyTime() > now) {
+            const int capability = DefinedMovements::getMovementIndex(name);
+            scheduleRunning({id, MOVEMENT_ENDED, capability}, movement->getEndTime());
+            scheduleRunning({id, MOVEMENT_READY, capability}, movement->getReadyTime());
+        }
+    }
+    if (capabilities.jetPack.getReadyTime() > now) {
+        game.timers.schedule({id, JETPACK_READY, DefinedMovements::getMovementIndex("JETPACK")},
+                             capabilities.jetPack.getReadyTime());
+    }
+    scheduleRunning({id, HURT_ENDED, -1}, character.hurtAnimation.getEndTime());
+}
+
+Level Snapshot::loadLevel(const SnapshotGame&state, const Sections&sections, const TimePoint now) {
+    const auto gateways = gatewayBits();
+    // Constructing a spawn point or a chest draws from a random device: the records are restored on copies.
+    const Spawn spawnPrototype(0, 0, 0);
+    const Chest chestPrototype(0);
+    std::vector<std::vector<Area>> areas(state.levelLength);
+    for (int x = 0; x < state.levelLength; ++x) {
+        areas[x].reserve(state.levelHeight);
+        for (int y = 0; y < state.levelHeight; ++y) {
+            const SnapshotArea&record = sections.areas[static_cast<std::size_t>(x) * state.levelHeight + y];
+            std::set<Direction2D> positions;
+            for (std::size_t bit = 0; bit < gateways.size(); ++bit) {
+                if (record.gateways & 1u << bit) {
+                    positions.insert(gateways[bit]);
+                }
+            }
+            std::vector<Spawn> spawns;
+            spawns.reserve(record.spawnCount);
+            for (const SnapshotSpawn&stored: sections.spawns.subspan(record.firstSpawn, record.spawnCount)) {
+                Spawn&spawn = spawns.emplace_back(spawnPrototype);
+                spawn.id = stored.id;
+                spawn.boss = stored.boss != 0;
+                spawn.spawnCoolDown = stored.cooldown;
+                spawn.lastTimeSpawned = fromStored(stored.lastSpawned, now);
+            }
+            std::vector<Chest> chests;
+            chests.reserve(record.chestCount);
+            for (const SnapshotChest&stored: sections.chests.subspan(record.firstChest, record.chestCount)) {
+                Chest&chest = chests.emplace_back(chestPrototype);
+                chest.id = stored.id;
+                if (stored.item >= 0) {
+                    chest.item = DefinedItems::get(static_cast<Items>(stored.item)).item;
+                }
+                chest.empty = stored.empty != 0;
+            }
+            Area&area = areas[x].emplace_back(record.type, 1, std::move(positions), std::move(spawns),
+                                              std::move(chests));
+            area.id = record.id;
+        }
+    }
+
+    Level level(state.level, areas);
+    level.enemies.reserve(sections.characters.size() - state.playerCount);
+    for (const SnapshotCharacter&record: sections.characters.subspan(state.playerCount)) {
+        Enemy enemy(std::string(magic_enum::enum_name(static_cast<Enemies>(record.type))), record.baseMaxHealth,
+                    record.followRange, record.attackRange, record.hurtTime, Capabilities({}, {}, false),
+                    record.boss != 0);
+        loadCharacter(enemy, record, sections, now);
+        if (level.enemyIndex.contains(enemy.getId())) {
+            throw std::invalid_argument("Invalid snapshot: duplicate character ID");
+        }
+        level.addEnemy(enemy);
+        for (const Modifier&modifier: enemy.getModifiers().getModifiers()) {
+            level.trackModifier(level.enemies.size() - 1, modifier);
+        }
+    }
+    return level;
+}
+
+void Snapshot::load(Game&game, const std::span<const std::byte> bytes, const TimePoint now) {
+    const Sections sections = validate(bytes);
+    const SnapshotGame&state = sections.game.front();
+
+    // Everything is rebuilt aside first, so that an invalid snapshot leaves the game untouched.
+    std::vector<Player> players;
+    players.reserve(Game::MAX_PLAYERS);
+    std::unordered_map<int, std::size_t> playerIndex;
+    for (const SnapshotCharacter&record: sections.characters.first(state.playerCount)) {
+        Player&player = players.emplace_back();
+        loadCharacter(player, record, sections, now);
+        if (!playerIndex.emplace(player.getId(), players.size() - 1).second) {
+            throw std::invalid_argument("Invalid snapshot: duplicate character ID");
+        }
+    }
+    Level level = loadLevel(state, sections, now);
+    for (const Player&player: players) {
+        if (level.enemyIndex.contains(player.getId())) {
+            throw std::invalid_argument("Invalid snapshot: duplicate character ID");
+        }
+    }
+
+    game.players = std::move(players);
+    game.playerIndex = std::move(playerIndex);
+    game.levels.clear();
+    game.levels.reserve(static_cast<std::size_t>(state.level) + 1);
+    for (int id = 0; id < state.level; ++id) {
+        game.levels.emplace_back(id);
+    }
+    game.levels.push_back(std::move(level));
+    game.activeLevel = state.level;
+    game.over = state.over != 0;
+    game.difficulty = state.difficulty;
+    game.timeSinceDifficultyUpdate = fromStored(state.difficultyUpdate, now);
+    game.activationRadius = state.activationRadius;
+    game.deferredDamage = state.deferredDamage != 0;
+    game.enemyAIEnabled = state.enemyAI != 0;
+    game.lastEnemyAIUpdate = now;
+
+    game.spawnDirector.reset();
+    game.integrator.reset();
+    game.timers.clear();
+    game.dueTimers.clear();
+    game.damageBuffer.clear();
+    game.deaths.clear();
+    game.behaviours.clear();
+    game.statusEffects = StatusEffectPool();
+    for (const SnapshotStatusEffect&effect: sections.statusEffects) {
+        const TimePoint expiresAt = fromStored(effect.expiresAt, now);
+        if (expiresAt > now && game.isAValidId(effect.characterId)) {
+            game.statusEffects.apply(effect.characterId, static_cast<StatusEffectTypes>(effect.type),
+                                     effect.magnitude, now, expiresAt);
+        }
+    }
+    game.threat = ThreatTable(ThreatTable::DEF_HALF_LIFE, now);
+    for (const Player&player: game.players) {
+        game.threat.addPlayer(player.getId());
+        scheduleTimers(game, player, now);
+    }
+    for (const Enemy&enemy: game.levels.back().enemies) {
+        scheduleTimers(game, enemy, now);
+    }
+    // The state of the coroutines is not saved: the scripts start again from their beginning.
+    for (const SnapshotCharacter&record: sections.characters.subspan(state.playerCount)) {
+        if (record.behaviour != 0) {
+            game.startBehaviour(record.id, record.behaviour - 1);
+        }
+    }
+    // New characters must not take the ID of a restored one.
+    Character::nextId = std::max(Character::nextId, state.nextCharacterId);
+}
+
+void Snapshot::load(Game&game, const std::string&path) {
+    const MappedFile file(path);
+    load(game, file.bytes());
+}
+
+void Snapshot::captureCharacter(const Character&character, GameState&state) {
+    CharacterFrame&frame = state.characters.emplace_back();
+    frame.position = character.position;
+    frame.velocity = character.velocity;
+    frame.runInput = character.runInput;
+    frame.hurtStart = character.hurtAnimation.lastUsage;
+    frame.health = character.health;
+    frame.id = character.id;
+    frame.facing = character.facing;
+    frame.script = -1;
+    frame.onGround = character.onGround;
+
+    const Capabilities&capabilities = character.capabilities;
+    frame.jetPackStart = capabilities.jetPack.lastJetpackUse;
+    frame.jetPackInUse = capabilities.jetPack.inUse;
+
+    frame.firstAttack = static_cast<std::uint32_t>(state.attacks.size());
+    frame.attackCount = static_cast<std::uint16_t>(capabilities.attacks.size());
+    for (const Attack&attack: capabilities.attacks) {
+        state.attacks.push_back({
+            attack.lastUsageTime, attack.chargedTime, attack.recoveryTime, attack.endTime, attack.readyTime,
+            attack.damage
+        });
+    }
+
+    frame.firstMovement = static_cast<std::uint32_t>(state.movements.size());
+    frame.movementCount = static_cast<std::uint16_t>(capabilities.movements.size());
+    for (const auto&movement: capabilities.movements | std::views::values) {
+        MovementFrame&stored = state.movements.emplace_back();
+        stored.lastUsage = movement->lastUsageTime;
+        stored.force = movement->force;
+        if (const auto* jump = dynamic_cast<const Jump*>(movement.get())) {
+            stored.maxUsage = jump->maxUsage;
+            stored.state = jump->currentUsage;
+        }
+        else if (const auto* run = dynamic_cast<const Run*>(movement.get())) {
+            stored.state = run->running;
+        }
+        else if (const auto* climb = dynamic_cast<const Climb*>(movement.get())) {
+            stored.state = climb->climbing;
+        }
+    }
+
+    const std::vector<Modifier>&modifiers = character.modifiers.modifiers;
+    frame.firstModifier = static_cast<std::uint32_t>(state.modifiers.size());
+    frame.modifierCount = static_cast<std::uint16_t>(modifiers.size());
+    state.modifiers.insert(state.modifiers.end(), modifiers.begin(), modifiers.end());
+
+    frame.firstItem = static_cast<std::uint32_t>(state.items.size());
+    for (const auto&[name, count]: character.items) {
+        if (const auto item = magic_enum::enum_cast<Items>(name)) {
+            state.items.push_back({*item, count});
+        }
+    }
+    frame.itemCount = static_cast<std::uint16_t>(state.items.size() - frame.firstItem);
+}
+
+void Snapshot::capture(const Game&game, GameState&state) {
+    const Level&level = game.levels.at(game.activeLevel);
+    state.level = game.activeLevel;
+    state.playerCount = game.players.size();
+    state.over = game.over;
+    state.difficulty = game.difficulty;
+    state.difficultyUpdate = game.timeSinceDifficultyUpdate;
+    state.lastEnemyAIUpdate = game.lastEnemyAIUpdate;
+    state.timersDrained = game.timers.getDrainedTime();
+
+    state.characters.clear();
+    state.attacks.clear();
+    state.movements.clear();
+    state.modifiers.clear();
+    state.items.clear();
+    for (const Player&player: game.players) {
+        captureCharacter(player, state);
+    }
+    for (const Enemy&enemy: level.enemies) {
+        captureCharacter(enemy, state);
+        state.characters.back().script = game.behaviours.getScript(enemy.id);
+    }
+
+    state.spawnTimes.clear();
+    state.emptyChests.clear();
+    for (const auto&column: level.areas) {
+        for (const Area&area: column) {
+            for (const Spawn&spawn: area.spawns) {
+                state.spawnTimes.push_back(spawn.lastTimeSpawned);
+            }
+            for (const Chest&chest: area.chests) {
+                state.emptyChests.push_back(chest.empty);
+            }
+        }
+    }
+
+    // Copy-assigning the pools reuses the capacity of those of the state.
+    state.statusEffects = game.statusEffects;
+    state.threat = game.threat;
+    state.damageBuffer = game.damageBuffer;
+    state.dueTimers = game.dueTimers;
+    state.deaths = game.deaths;
+    state.projectiles = level.projectiles;
+    state.spawnDirector = game.spawnDirector;
+    state.integrator = game.integrator;
+}
+
+bool Snapshot::matches(const Game&game, const GameState&state) {
+    if (state.level != game.activeLevel || state.playerCount != game.players.size()) {
+        return false;
+    }
+    const Level&level = game.levels.at(game.activeLevel);
+    // Enemies are never removed from a level: those of the state are the first ones of the level.
+    if (state.characters.size() - state.playerCount > level.enemies.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < state.characters.size(); ++i) {
+        const CharacterFrame&frame = state.characters[i];
+        const Character&character = i < state.playerCount
+                                        ? static_cast<const Character&>(game.players[i])
+                                        : level.enemies[i - state.playerCount];
+        if (character.id != frame.id || character.capabilities.attacks.size() != frame.attackCount ||
+            character.capabilities.movements.size() != frame.movementCount) {
+            return false;
+        }
+    }
+    std::size_t spawns = 0;
+    std::size_t chests = 0;
+    for (const auto&column: level.areas) {
+        for (const Area&area: column) {
+            spawns += area.spawns.size();
+            chests += area.chests.size();
+        }
+    }
+    return spawns == state.spawnTimes.size() && chests == state.emptyChests.size();
+}
+
+bool Snapshot::restoreCharacter(Character&character, const CharacterFrame&frame, const GameState&state) {
+    bool retimed = character.hurtAnimation.lastUsage != frame.hurtStart;
+    character.position = frame.position;
+    character.velocity = frame.velocity;
+    character.runInput = frame.runInput;
+    character.hurtAnimation.lastUsage = frame.hurtStart;
+    character.health = frame.health;
+    character.facing = frame.facing;
+    character.onGround = frame.onGround;
+
+    Capabilities&capabilities = character.capabilities;
+    retimed |= capabilities.jetPack.lastJetpackUse != frame.jetPackStart;
+    capabilities.jetPack.lastJetpackUse = frame.jetPackStart;
+    capabilities.jetPack.inUse = frame.jetPackInUse;
+
+    const AttackFrame* attack = state.attacks.data() + frame.firstAttack;
+    for (Attack&restored: capabilities.attacks) {
+        retimed |= restored.lastUsageTime != attack->lastUsage;
+        restored.lastUsageTime = attack->lastUsage;
+        restored.chargedTime = attack->charged;
+        restored.recoveryTime = attack->recovery;
+        restored.endTime = attack->end;
+        restored.readyTime = attack->ready;
+        restored.damage = attack->damage;
+        ++attack;
+    }
+
+    // The movements are iterated in the order they were taken, their map being keyed by their names.
+    const MovementFrame* stored = state.movements.data() + frame.firstMovement;
+    for (const auto&movement: capabilities.movements | std::views::values) {
+        retimed |= movement->lastUsageTime != stored->lastUsage;
+        movement->lastUsageTime = stored->lastUsage;
+        movement->force = stored->force;
+        if (auto* jump = dynamic_cast<Jump*>(movement.get())) {
+            jump->maxUsage = stored->maxUsage;
+            jump->currentUsage = stored->state;
+        }
+        else if (auto* run = dynamic_cast<Run*>(movement.get())) {
+            run->running = stored->state;
+        }
+        else if (auto* climb = dynamic_cast<Climb*>(movement.get())) {
+            climb->climbing = stored->state != 0;
+        }
+        ++stored;
+    }
+
+    const auto first = state.modifiers.begin() + frame.firstModifier;
+    character.modifiers.modifiers.assign(first, first + frame.modifierCount);
+    character.modifiers.aggregate();
+
+    const std::span<const ItemFrame> items(state.items.data() + frame.firstItem, frame.itemCount);
+    const bool sameItems = std::ranges::equal(character.items, items, [](const auto&held, const ItemFrame&item) {
+        return held.second == item.count && held.first == magic_enum::enum_name(static_cast<Items>(item.item));
+    });
+    if (!sameItems) {
+        character.items.clear();
+        for (const auto&[item, count]: items) {
+            character.items.emplace(magic_enum::enum_name(static_cast<Items>(item)), count);
+        }
+    }
+    return retimed;
+}
+
+bool Snapshot::restore(Game&game, const GameState&state) {
+    if (!matches(game, state)) {
+        return false;
+    }
+    Level&level = game.levels[game.activeLevel];
+    const std::size_t enemyCount = state.characters.size() - state.playerCount;
+    for (std::size_t slot = enemyCount; slot < level.enemies.size(); ++slot) {
+        game.behaviours.stop(level.enemies[slot].getId());
+    }
+    level.truncateEnemies(enemyCount);
+
+    // The events are scheduled again from the restored times, as Snapshot::load does.
+    game.timers.clear();
+    game.dueTimers = state.dueTimers;
+    for (std::size_t i = 0; i < state.playerCount; ++i) {
+        restoreCharacter(game.players[i], state.characters[i], state);
+        scheduleTimers(game, game.players[i], state.timersDrained);
+    }
+    for (std::size_t slot = 0; slot < enemyCount; ++slot) {
+        const CharacterFrame&frame = state.characters[state.playerCount + slot];
+        Enemy&enemy = level.enemies[slot];
+        const bool moved = enemy.position.x != frame.position.x || enemy.position.y != frame.position.y;
+        if (restoreCharacter(enemy, frame, state)) {
+            level.refreshCooldowns(slot);
+        }
+        if (moved) {
+            // The enemy is put back where it was, without landing it as a relocation waking it up would.
+            level.enemyGrid.update(frame.id, frame.position);
+            level.interest.place(slot, level.areaIndexOf(frame.position));
+        }
+        for (const Modifier&modifier: enemy.modifiers.modifiers) {
+            level.trackModifier(slot, modifier);
+        }
+        scheduleTimers(game, enemy, state.timersDrained);
+    }
+
+    const TimePoint* spawnTime = state.spawnTimes.data();
+    const std::uint8_t* empty = state.emptyChests.data();
+    for (int x = 0; x < static_cast<int>(level.areas.size()); ++x) {
+        for (int y = 0; y < static_cast<int>(level.areas[x].size()); ++y) {
+            Area&area = level.areas[x][y];
+            for (Spawn&spawn: area.spawns) {
+                if (spawn.lastTimeSpawned != *spawnTime) {
+                    spawn.lastTimeSpawned = *spawnTime;
+                    level.reschedule(x, y, spawn.id);
+                }
+                ++spawnTime;
+            }
+            for (Chest&chest: area.chests) {
+                chest.empty = *empty++ != 0;
+            }
+        }
+    }
+
+    game.over = state.over;
+    game.difficulty = state.difficulty;
+    game.timeSinceDifficultyUpdate = state.difficultyUpdate;
+    game.lastEnemyAIUpdate = state.lastEnemyAIUpdate;
+    game.statusEffects = state.statusEffects;
+    game.threat = state.threat;
+    game.damageBuffer = state.damageBuffer;
+    game.deaths = state.deaths;
+    level.projectiles = state.projectiles;
+    game.spawnDirector = state.spawnDirector;
+    game.integrator = state.integrator;
+
+    // A script still running keeps its progress; one stopped or replaced since is started again.
+    for (const CharacterFrame&frame: std::span(state.characters).subspan(state.playerCount)) {
+        const int script = game.behaviours.size() == 0 ? -1 : game.behaviours.getScript(frame.id);
+        if (script == frame.script) {
+            continue;
+        }
+        if (frame.script < 0) {
+            game.behaviours.stop(frame.id);
+        }
+        else {
+            game.startBehaviour(frame.id, frame.script);
+        }
+    }
+    return true;
+}
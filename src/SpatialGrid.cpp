@@ -0,0 +1,111 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "SpatialGrid.hpp"
+#include "GridCell.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+SpatialGrid::SpatialGrid() : SpatialGrid(DEF_CELL_SIZE) {
+}
+
+SpatialGrid::SpatialGrid(const double cellSize) : cellSize(cellSize) {
+    if (cellSize <= 0) {
+        throw std::invalid_argument("Cell size must be strictly positive");
+    }
+}
+
+int SpatialGrid::toCell(const double coordinate) const {
+    return floorToCell(coordinate / cellSize);
+}
+
+std::int64_t SpatialGrid::key(const int cellX, const int cellY) {
+    return static_cast<std::int64_t>(cellX) << 32 | static_cast<std::uint32_t>(cellY);
+}
+
+void SpatialGrid::removeFromCell(const std::int64_t cell, const int id) {
+    const auto bucket = cells.find(cell);
+    if (bucket == cells.end()) {
+        return;
+    }
+    auto&ids = bucket->second;
+    if (const auto it = std::ranges::find(ids, id); it != ids.end()) {
+        *it = ids.back();
+        ids.pop_back();
+    }
+    if (ids.empty()) {
+        cells.erase(bucket);
+    }
+}
+
+void SpatialGrid::update(const int id, const Vector2D&position) {
+    const std::int64_t cell = key(toCell(position.x), toCell(position.y));
+    if (const auto it = entries.find(id); it != entries.end()) {
+        if (it->second.cell != cell) {
+            removeFromCell(it->second.cell, id);
+            cells[cell].push_back(id);
+            it->second.cell = cell;
+        }
+        it->second.position = position;
+        return;
+    }
+    entries.emplace(id, Entry{cell, position});
+    cells[cell].push_back(id);
+}
+
+void SpatialGrid::remove(const int id) {
+    if (const auto it = entries.find(id); it != entries.end()) {
+        removeFromCell(it->second.cell, id);
+        entries.erase(it);
+    }
+}
+
+bool SpatialGrid::contains(const int id) const {
+    return entries.contains(id);
+}
+
+void SpatialGrid::queryRadius(const Vector2D&center, const double radius, std::vector<int>&result) const {
+    if (!std::isfinite(center.x) || !std::isfinite(center.y) || !(radius >= 0)) {
+        return;
+    }
+    const double squaredRadius = radius * radius;
+    const int minX = toCell(center.x - radius);
+    const int maxX = toCell(center.x + radius);
+    const int minY = toCell(center.y - radius);
+    const int maxY = toCell(center.y + radius);
+    const auto spanX = static_cast<std::int64_t>(maxX) - minX + 1;
+    const auto spanY = static_cast<std::int64_t>(maxY) - minY + 1;
+    // Visiting more cells than there are characters costs more than checking every character.
+    if (spanX * spanY > static_cast<std::int64_t>(entries.size())) {
+        for (const auto&[id, entry]: entries) {
+            if (entry.position.squaredDistanceTo(center) <= squaredRadius) {
+                result.push_back(id);
+            }
+        }
+        return;
+    }
+    for (int cellX = minX; cellX <= maxX; ++cellX) {
+        for (int cellY = minY; cellY <= maxY; ++cellY) {
+            const auto bucket = cells.find(key(cellX, cellY));
+            if (bucket == cells.end()) {
+                continue;
+            }
+            for (const int id: bucket->second) {
+                if (entries.at(id).position.squaredDistanceTo(center) <= squaredRadius) {
+                    result.push_back(id);
+                }
+            }
+        }
+    }
+}
+
+std::size_t SpatialGrid::size() const {
+    return entries.size();
+}
+
+void SpatialGrid::clear() {
+    cells.clear();
+    entries.clear();
+}
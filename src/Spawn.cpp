@@ -39,18 +39,28 @@ std::chrono::time_point<std::chrono::steady_clock> Spawn::getLastTimeSpawned() c
     return this->lastTimeSpawned;
 }
 
-bool Spawn::canSpawn() const {
+double Spawn::getSpawnCoolDown() const {
+    return spawnCoolDown;
+}
+
+std::chrono::time_point<std::chrono::steady_clock> Spawn::getNextSpawnTime() const {
     if (lastTimeSpawned.time_since_epoch().count() == 0) {
-        return true;
+        return lastTimeSpawned;
     }
-    return std::chrono::steady_clock::now() - lastTimeSpawned >= std::chrono::duration<double>(spawnCoolDown);
+    return lastTimeSpawned + std::chrono::ceil<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(spawnCoolDown));
+}
+
+bool Spawn::canSpawn(const std::chrono::time_point<std::chrono::steady_clock> now) const {
+    // The same rounded time as the scheduler, so that a spawn point popped when ready is never refused.
+    return now >= getNextSpawnTime();
 }
 
-void Spawn::spawn() {
-    if (!canSpawn()) {
+void Spawn::spawn(const std::chrono::time_point<std::chrono::steady_clock> now) {
+    if (!canSpawn(now)) {
         throw std::runtime_error("Cannot spawn, cool down not reached");
     }
-    this->lastTimeSpawned = std::chrono::steady_clock::now();
+    this->lastTimeSpawned = now;
 }
 
 bool Spawn::canSpawnBoss() const {
@@ -0,0 +1,56 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "SpawnDirector.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+SpawnDirector::SpawnDirector() : SpawnDirector(DEF_CREDITS_PER_SECOND, DEF_WAVE_SIZE, DEF_MAX_SPAWNS_PER_TICK) {
+}
+
+SpawnDirector::SpawnDirector(const double creditsPerSecond, const int waveSize, const int maxSpawnsPerTick)
+    : creditsPerSecond(creditsPerSecond), waveSize(waveSize), maxSpawnsPerTick(maxSpawnsPerTick) {
+    if (creditsPerSecond <= 0 || waveSize <= 0 || maxSpawnsPerTick <= 0) {
+        throw std::invalid_argument("Spawn director settings must be strictly positive");
+    }
+}
+
+std::vector<int> SpawnDirector::update(Level&level, const std::chrono::time_point<std::chrono::steady_clock> now,
+                                       const double difficulty, const int budget) {
+    if (lastUpdate.time_since_epoch().count() == 0) {
+        lastUpdate = now;
+        level.reserveEnemies(level.getEnemyCount() + RESERVED_ENEMIES);
+        return {};
+    }
+    const double elapsed = std::chrono::duration<double>(now - lastUpdate).count();
+    lastUpdate = now;
+    credits = std::min(MAX_CREDITS, credits + elapsed * creditsPerSecond * difficulty);
+    if (credits < waveSize * ENEMY_COST) {
+        return {};
+    }
+    const int affordable = static_cast<int>(credits / ENEMY_COST);
+    const auto wave = level.drainSpawnEvents(now, std::min({affordable, maxSpawnsPerTick, budget}));
+    if (wave.empty()) {
+        return {};
+    }
+    if (level.getEnemyCapacity() < level.getEnemyCount() + wave.size()) {
+        level.reserveEnemies(level.getEnemyCapacity() + RESERVED_ENEMIES);
+    }
+    auto ids = level.spawnWave(wave, difficulty, now);
+    credits -= static_cast<double>(ids.size()) * ENEMY_COST;
+    return ids;
+}
+
+double SpawnDirector::getCredits() const {
+    return credits;
+}
+
+int SpawnDirector::getMaxSpawnsPerTick() const {
+    return maxSpawnsPerTick;
+}
+
+void SpawnDirector::reset() {
+    credits = 0.0;
+    lastUpdate = {};
+}
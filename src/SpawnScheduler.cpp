@@ -0,0 +1,50 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "SpawnScheduler.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+void SpawnScheduler::schedule(const SpawnEvent&spawn, const TimePoint readyAt) {
+    heap.push_back({readyAt, spawn});
+    std::ranges::push_heap(heap, std::greater<>());
+}
+
+bool SpawnScheduler::hasReady(const TimePoint now) const {
+    return !heap.empty() && heap.front().readyAt <= now;
+}
+
+SpawnScheduler::Entry SpawnScheduler::pop() {
+    if (heap.empty()) {
+        throw std::runtime_error("Cannot pop an empty spawn scheduler");
+    }
+    std::ranges::pop_heap(heap, std::greater<>());
+    const Entry entry = heap.back();
+    heap.pop_back();
+    return entry;
+}
+
+SpawnScheduler::TimePoint SpawnScheduler::nextReadyTime() const {
+    if (heap.empty()) {
+        return TimePoint::max();
+    }
+    return heap.front().readyAt;
+}
+
+std::size_t SpawnScheduler::size() const {
+    return heap.size();
+}
+
+bool SpawnScheduler::empty() const {
+    return heap.empty();
+}
+
+void SpawnScheduler::compact(const std::function<bool(const Entry&)>&isLive) {
+    std::erase_if(heap, [&isLive](const Entry&entry) { return !isLive(entry); });
+    std::ranges::make_heap(heap, std::greater<>());
+}
+
+void SpawnScheduler::clear() {
+    heap.clear();
+}
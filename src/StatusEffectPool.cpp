@@ -0,0 +1,117 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "StatusEffectPool.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+std::uint64_t StatusEffectPool::keyOf(const int characterId, const StatusEffectTypes type) {
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(characterId)) << 8 | static_cast<std::uint64_t>(type);
+}
+
+void StatusEffectPool::removeAt(const std::size_t index) {
+    lookup.erase(keyOf(effects[index].characterId, effects[index].type));
+    if (index + 1 != effects.size()) {
+        effects[index] = effects.back();
+        lookup[keyOf(effects[index].characterId, effects[index].type)] = static_cast<std::uint32_t>(index);
+    }
+    effects.pop_back();
+}
+
+bool StatusEffectPool::apply(const int characterId, const StatusEffectTypes type, const double magnitude,
+                             const TimePoint now, const TimePoint expiresAt) {
+    if (magnitude < 0) {
+        throw std::invalid_argument("Magnitude must be positive");
+    }
+    if (expiresAt <= now) {
+        throw std::invalid_argument("Effect must end after now");
+    }
+    const auto [it, added] = lookup.try_emplace(keyOf(characterId, type), static_cast<std::uint32_t>(effects.size()));
+    if (added) {
+        effects.push_back({characterId, type, magnitude, expiresAt, now + TICK_INTERVAL});
+    }
+    else {
+        StatusEffect&effect = effects[it->second];
+        effect.expiresAt = std::max(effect.expiresAt, expiresAt);
+        if (type == BURN) {
+            effect.magnitude = std::max(effect.magnitude, magnitude);
+        }
+    }
+    nextEvent = std::min(nextEvent, type == BURN ? std::min(expiresAt, now + TICK_INTERVAL) : expiresAt);
+    return added;
+}
+
+void StatusEffectPool::tick(const TimePoint now, std::vector<StatusTick>&ticks) {
+    ticks.clear();
+    if (now < nextEvent) {
+        return;
+    }
+    nextEvent = TimePoint::max();
+    std::size_t i = 0;
+    while (i < effects.size()) {
+        StatusEffect&effect = effects[i];
+        if (effect.type == BURN) {
+            const TimePoint last = std::min(now, effect.expiresAt);
+            int damage = 0;
+            for (; effect.nextTick <= last; effect.nextTick += TICK_INTERVAL) {
+                damage += static_cast<int>(effect.magnitude);
+            }
+            if (damage > 0) {
+                ticks.push_back({effect.characterId, damage});
+            }
+        }
+        if (effect.expiresAt <= now) {
+            removeAt(i);
+            continue;
+        }
+        nextEvent = std::min(nextEvent, effect.type == BURN ? std::min(effect.nextTick, effect.expiresAt) : effect.expiresAt);
+        ++i;
+    }
+}
+
+const StatusEffect* StatusEffectPool::find(const int characterId, const StatusEffectTypes type) const {
+    const auto it = lookup.find(keyOf(characterId, type));
+    return it == lookup.end() ? nullptr : &effects[it->second];
+}
+
+const std::vector<StatusEffect>& StatusEffectPool::getEffects() const {
+    return effects;
+}
+
+std::size_t StatusEffectPool::size() const {
+    return effects.size();
+}
+
+void StatusEffectPool::retainOnly(const std::span<const int> characterIds) {
+    std::size_t i = 0;
+    while (i < effects.size()) {
+        if (std::ranges::find(characterIds, effects[i].characterId) == characterIds.end()) {
+            removeAt(i);
+            continue;
+        }
+        ++i;
+    }
+}
+
+void StatusEffectPool::removeCharacter(const int characterId) {
+    std::size_t i = 0;
+    while (i < effects.size()) {
+        if (effects[i].characterId == characterId) {
+            removeAt(i);
+            continue;
+        }
+        ++i;
+    }
+}
+
+Modifier StatusEffectPool::modifierOf(const StatusEffect&effect) {
+    switch (effect.type) {
+        case SLOW:
+            return {RUN_FORCE, STATUS_EFFECT, 0.0, effect.magnitude, effect.expiresAt};
+        case STRENGTH:
+            return {ATTACK_DAMAGE, STATUS_EFFECT, 0.0, effect.magnitude, effect.expiresAt};
+        default:
+            throw std::invalid_argument("This effect does not change a stat");
+    }
+}
@@ -0,0 +1,201 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "ThreatTable.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+ThreatTable::ThreatTable(const double halfLife, const TimePoint now) : halfLife(halfLife), origin(now) {
+    if (halfLife <= 0) {
+        throw std::invalid_argument("Half-life must be strictly positive");
+    }
+    slotPlayers.fill(-1);
+}
+
+int ThreatTable::slotOf(const int playerId) const {
+    for (std::size_t slot = 0; slot < MAX_PLAYERS; ++slot) {
+        if (slotPlayers[slot] == playerId) {
+            return static_cast<int>(slot);
+        }
+    }
+    return -1;
+}
+
+ThreatTable::Row& ThreatTable::rowFor(const int enemyId) {
+    const auto [it, inserted] = rowOf.try_emplace(enemyId, rows.size());
+    if (inserted) {
+        rows.emplace_back();
+        rowEnemies.push_back(enemyId);
+    }
+    return rows[it->second];
+}
+
+void ThreatTable::add(Row&row, const int slot, const float scaled) {
+    row.threats[slot] += scaled;
+    if (row.leader < 0 || row.threats[slot] > row.threats[row.leader]) {
+        row.leader = static_cast<std::int8_t>(slot);
+    }
+}
+
+void ThreatTable::elect(Row&row) {
+    row.leader = -1;
+    for (std::size_t slot = 0; slot < MAX_PLAYERS; ++slot) {
+        if (row.threats[slot] > 0 && (row.leader < 0 || row.threats[slot] > row.threats[row.leader])) {
+            row.leader = static_cast<std::int8_t>(slot);
+        }
+    }
+}
+
+void ThreatTable::advance(const TimePoint now) {
+    const double seconds = std::chrono::duration<double>(now - origin).count();
+    growth = std::exp2(seconds / halfLife);
+    if (growth < REBASE_GROWTH) {
+        return;
+    }
+    // Rescaling every threat by the same factor keeps the leaders.
+    const auto scale = static_cast<float>(1.0 / growth);
+    for (Row&row: rows) {
+        for (float&threat: row.threats) {
+            threat *= scale;
+        }
+    }
+    origin = now;
+    growth = 1.0;
+}
+
+bool ThreatTable::addPlayer(const int playerId) {
+    if (slotOf(playerId) >= 0) {
+        return true;
+    }
+    const int slot = slotOf(-1);
+    if (slot < 0) {
+        return false;
+    }
+    slotPlayers[slot] = playerId;
+    return true;
+}
+
+void ThreatTable::removePlayer(const int playerId) {
+    const int slot = slotOf(playerId);
+    if (slot < 0) {
+        return;
+    }
+    slotPlayers[slot] = -1;
+    for (Row&row: rows) {
+        row.threats[slot] = 0;
+        if (row.leader == slot) {
+            elect(row);
+        }
+    }
+}
+
+void ThreatTable::removeEnemy(const int enemyId) {
+    const auto it = rowOf.find(enemyId);
+    if (it == rowOf.end()) {
+        return;
+    }
+    const std::size_t index = it->second;
+    rowOf.erase(it);
+    if (index != rows.size() - 1) {
+        rows[index] = rows.back();
+        rowEnemies[index] = rowEnemies.back();
+        rowOf[rowEnemies[index]] = index;
+    }
+    rows.pop_back();
+    rowEnemies.pop_back();
+}
+
+void ThreatTable::clearEnemies() {
+    rows.clear();
+    rowEnemies.clear();
+    rowOf.clear();
+}
+
+void ThreatTable::addThreat(const int enemyId, const int playerId, const double threat) {
+    const int slot = slotOf(playerId);
+    if (slot < 0 || threat <= 0) {
+        return;
+    }
+    add(rowFor(enemyId), slot, static_cast<float>(threat * growth));
+}
+
+void ThreatTable::addDamage(const std::span<const DamageHit> hits, const std::span<const DamageResult> results) {
+    std::size_t first = 0;
+    for (const DamageResult&result: results) {
+        // The results follow the groups of hits, skipping the targets that were not hurt.
+        while (first < hits.size() && hits[first].targetId != result.targetId) {
+            ++first;
+        }
+        if (first == hits.size()) {
+            return;
+        }
+        const std::size_t last = DamageBuffer::endOfTarget(hits, first);
+        int dealt = 0;
+        for (std::size_t i = first; i < last; ++i) {
+            dealt += hits[i].damage;
+        }
+        if (result.damage > 0 && dealt > 0) {
+            const double scale = growth * result.damage / dealt;
+            Row* row = nullptr;
+            for (std::size_t i = first; i < last; ++i) {
+                const int slot = slotOf(hits[i].sourceId);
+                if (slot < 0 || hits[i].damage <= 0) {
+                    continue;
+                }
+                // The row is only created for a target hurt by a player.
+                if (row == nullptr) {
+                    row = &rowFor(result.targetId);
+                }
+                add(*row, slot, static_cast<float>(hits[i].damage * scale));
+            }
+        }
+        first = last;
+    }
+}
+
+void ThreatTable::taunt(const int enemyId, const int playerId) {
+    const int slot = slotOf(playerId);
+    if (slot < 0) {
+        return;
+    }
+    Row&row = rowFor(enemyId);
+    const float lead = row.leader >= 0 ? row.threats[row.leader] : 0.0f;
+    const auto target = static_cast<float>(lead + TAUNT_MARGIN * growth);
+    add(row, slot, target - row.threats[slot]);
+}
+
+double ThreatTable::getThreat(const int enemyId, const int playerId) const {
+    const auto it = rowOf.find(enemyId);
+    const int slot = slotOf(playerId);
+    if (it == rowOf.end() || slot < 0) {
+        return 0.0;
+    }
+    return rows[it->second].threats[slot] / growth;
+}
+
+int ThreatTable::getTarget(const int enemyId) const {
+    const auto it = rowOf.find(enemyId);
+    if (it == rowOf.end()) {
+        return -1;
+    }
+    const Row&row = rows[it->second];
+    if (row.leader < 0 || row.threats[row.leader] < MIN_THREAT * growth) {
+        return -1;
+    }
+    return slotPlayers[row.leader];
+}
+
+void ThreatTable::getTargets(const std::span<const int> enemyIds, std::vector<int>&targets) const {
+    targets.resize(enemyIds.size());
+    if (rows.empty()) {
+        std::ranges::fill(targets, -1);
+        return;
+    }
+    std::ranges::transform(enemyIds, targets.begin(), [this](const int id) { return getTarget(id); });
+}
+
+std::size_t ThreatTable::size() const {
+    return rows.size();
+}
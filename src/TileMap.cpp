@@ -0,0 +1,356 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "TileMap.hpp"
+#include "GridCell.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+int TileMap::shapeOf(const Area&area) {
+    if (area.get_type() <= 0) {
+        return FILLED;
+    }
+    int shape = 0;
+    for (const auto&gateway: area.get_gateway_positions()) {
+        if (gateway == Direction::LEFT) {
+            shape |= GATEWAY_LEFT;
+        }
+        else if (gateway == Direction::RIGHT) {
+            shape |= GATEWAY_RIGHT;
+        }
+        else if (gateway == Direction::UP) {
+            shape |= GATEWAY_UP;
+        }
+        else if (gateway == Direction::DOWN) {
+            shape |= GATEWAY_DOWN;
+        }
+    }
+    return shape;
+}
+
+Tile TileMap::layoutTile(const int shape, const int localX, const int localY, const int size) {
+    static constexpr Tile WALL(true, true, ID1);
+    static constexpr Tile PLATFORM(false, true, ID2);
+    if (shape & FILLED) {
+        return WALL;
+    }
+    const int middle = size / 2;
+    const bool inVerticalGateway = localX >= middle - GATEWAY_SIZE / 2 && localX < middle + GATEWAY_SIZE / 2;
+    const bool inHorizontalGateway = localY >= 1 && localY < 1 + GATEWAY_SIZE;
+    if (localY == 0) {
+        return shape & GATEWAY_DOWN && inVerticalGateway ? Tile() : WALL;
+    }
+    if (localY == size - 1) {
+        return shape & GATEWAY_UP && inVerticalGateway ? Tile() : WALL;
+    }
+    if (localX == 0) {
+        return shape & GATEWAY_LEFT && inHorizontalGateway ? Tile() : WALL;
+    }
+    if (localX == size - 1) {
+        return shape & GATEWAY_RIGHT && inHorizontalGateway ? Tile() : WALL;
+    }
+    // Platforms let the characters climb up to the upward gateway.
+    if (shape & GATEWAY_UP && localY % PLATFORM_SPACING == 0 && localX >= middle - GATEWAY_SIZE &&
+        localX < middle + GATEWAY_SIZE) {
+        return PLATFORM;
+    }
+    return {};
+}
+
+std::vector<InterractiveObject> TileMap::placeObjects(const Area&area, const int areaX, const int areaY) const {
+    std::vector<InterractiveObject> placed;
+    if (shapeOf(area) & FILLED) {
+        return placed;
+    }
+    const int originX = areaX * areaTiles;
+    const int floorY = areaY * areaTiles + 1;
+    std::vector<bool> used(areaTiles, false);
+    const auto spawnIds = area.get_spawn_ids();
+    const auto chestIds = area.get_chest_ids();
+    placed.reserve(spawnIds.size() + chestIds.size());
+    // Spawn points are spread evenly along the floor, chests fill the free tiles from the left wall.
+    for (std::size_t i = 0; i < spawnIds.size(); ++i) {
+        const auto spread = static_cast<int>(static_cast<long long>(areaTiles) * (i + 1) / (spawnIds.size() + 1));
+        const int localX = std::clamp(spread, 1, areaTiles - 2);
+        used[localX] = true;
+        placed.emplace_back(InterractiveObjectKind::SPAWN, spawnIds[i], originX + localX, floorY);
+    }
+    int localX = 2;
+    for (const int chestId: chestIds) {
+        while (localX < areaTiles - 2 && used[localX]) {
+            ++localX;
+        }
+        localX = std::min(localX, areaTiles - 2);
+        used[localX] = true;
+        placed.emplace_back(InterractiveObjectKind::CHEST, chestId, originX + localX, floorY);
+        localX += 2;
+    }
+    return placed;
+}
+
+std::size_t TileMap::areaIndex(const int areaX, const int areaY) const {
+    return static_cast<std::size_t>(areaX) * areasHigh + areaY;
+}
+
+TileMap::TileMap(const std::vector<std::vector<Area>>&areas, const int areaTiles)
+    : areasWide(static_cast<int>(areas.size())), areasHigh(areas.empty() ? 0 : static_cast<int>(areas[0].size())),
+      areaTiles(areaTiles) {
+    if (areaTiles < 4) {
+        throw std::invalid_argument("An area must be at least 4 tiles wide");
+    }
+    if (std::ranges::any_of(areas, [this](const auto&column) {
+        return static_cast<int>(column.size()) != areasHigh;
+    })) {
+        throw std::invalid_argument("The areas of a tile map must form a rectangle");
+    }
+    if (static_cast<long long>(areasWide) * areaTiles > std::numeric_limits<std::uint16_t>::max() + 1LL) {
+        throw std::invalid_argument("The areas are too wide to be encoded in a tile map");
+    }
+    const int width = getWidth();
+    const int height = getHeight();
+    std::vector<int> shapes(static_cast<std::size_t>(areasWide) * areasHigh);
+    objects.resize(shapes.size());
+    // Objects sorted by row then column, referencing their slot within their area.
+    std::vector<std::vector<std::pair<int, int>>> rowObjects(height);
+    for (int x = 0; x < areasWide; ++x) {
+        for (int y = 0; y < areasHigh; ++y) {
+            shapes[areaIndex(x, y)] = shapeOf(areas[x][y]);
+            objects[areaIndex(x, y)] = placeObjects(areas[x][y], x, y);
+            const auto&placed = objects[areaIndex(x, y)];
+            for (int slot = 1; slot <= std::min<int>(static_cast<int>(placed.size()), Tile::MAX_OBJECT_SLOT); ++slot) {
+                rowObjects[placed[slot - 1].getTileY()].emplace_back(placed[slot - 1].getTileX(), slot);
+            }
+        }
+    }
+    rowOffsets.reserve(height + 1);
+    for (int y = 0; y < height; ++y) {
+        rowOffsets.push_back(static_cast<std::uint32_t>(runs.size()));
+        auto&row = rowObjects[y];
+        // Only the first object placed on a tile gets referenced by the tile.
+        std::ranges::stable_sort(row, {}, &std::pair<int, int>::first);
+        auto object = row.begin();
+        for (int x = 0; x < width; ++x) {
+            const int localX = x % areaTiles;
+            Tile tile = layoutTile(shapes[areaIndex(x / areaTiles, y / areaTiles)], localX, y % areaTiles, areaTiles);
+            if (object != row.end() && object->first == x) {
+                tile = Tile::fromBits(tile.getBits() | object->second << Tile::OBJECT_SHIFT);
+                while (object != row.end() && object->first == x) {
+                    ++object;
+                }
+            }
+            if (runs.size() == rowOffsets.back() || runs.back().tile != tile.getBits()) {
+                runs.push_back({static_cast<std::uint16_t>(x), tile.getBits()});
+            }
+        }
+    }
+    rowOffsets.push_back(static_cast<std::uint32_t>(runs.size()));
+    runs.shrink_to_fit();
+}
+
+std::size_t TileMap::findRun(const int y, const int x) const {
+    const auto first = runs.begin() + rowOffsets[y];
+    const auto last = runs.begin() + rowOffsets[y + 1];
+    const auto next = std::upper_bound(first, last, x, [](const int value, const Run&run) {
+        return value < run.start;
+    });
+    return static_cast<std::size_t>(next - runs.begin()) - 1;
+}
+
+Tile TileMap::at(const int x, const int y) const {
+    if (x < 0 || y < 0 || x >= getWidth() || y >= getHeight()) {
+        return {true, true, ID1};
+    }
+    return Tile::fromBits(runs[findRun(y, x)].tile);
+}
+
+void TileMap::getRow(const int y, std::vector<Tile>&tiles) const {
+    tiles.clear();
+    if (y < 0 || y >= getHeight()) {
+        return;
+    }
+    tiles.reserve(getWidth());
+    for (std::uint32_t run = rowOffsets[y]; run < rowOffsets[y + 1]; ++run) {
+        const int end = run + 1 < rowOffsets[y + 1] ? runs[run + 1].start : getWidth();
+        tiles.insert(tiles.end(), end - runs[run].start, Tile::fromBits(runs[run].tile));
+    }
+}
+
+bool TileMap::isSolidAt(const Vector2D&point) const {
+    return at(floorToCell(point.x), floorToCell(point.y)).isSolid();
+}
+
+bool TileMap::overlapsSolid(const AABB&box) const {
+    const int minX = floorToCell(box.min.x);
+    const int minY = floorToCell(box.min.y);
+    // A box ending exactly on a tile boundary does not overlap the next tile.
+    const int maxX = std::max(minX, ceilToCell(box.max.x) - 1);
+    const int maxY = std::max(minY, ceilToCell(box.max.y) - 1);
+    if (minX < 0 || minY < 0 || maxX >= getWidth() || maxY >= getHeight()) {
+        return true;
+    }
+    for (int y = minY; y <= maxY; ++y) {
+        const std::size_t end = rowOffsets[y + 1];
+        for (std::size_t run = findRun(y, minX); run < end && runs[run].start <= maxX; ++run) {
+            if (Tile::fromBits(runs[run].tile).isSolid()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+double TileMap::getGroundHeight(const Vector2D&point) const {
+    constexpr double EPSILON = 1e-9;
+    const int x = floorToCell(point.x);
+    if (x < 0 || x >= getWidth()) {
+        return 0.0;
+    }
+    const int below = floorToCell(point.y + EPSILON) - 1;
+    for (int y = std::min(below, getHeight() - 1); y >= 0; --y) {
+        if (Tile::fromBits(runs[findRun(y, x)].tile).isFloor()) {
+            return y + 1.0;
+        }
+    }
+    return 0.0;
+}
+
+InterractiveObject TileMap::getObject(const int areaX, const int areaY, const InterractiveObjectKind kind,
+                                      const int id) const {
+    if (areaX >= 0 && areaY >= 0 && areaX < areasWide && areaY < areasHigh) {
+        for (const auto&object: objects[areaIndex(areaX, areaY)]) {
+            if (object.getKind() == kind && object.getId() == id) {
+                return object;
+            }
+        }
+    }
+    throw std::invalid_argument(
+        "No object with id " + std::to_string(id) + " in area (" + std::to_string(areaX) + ", " +
+        std::to_string(areaY) + ")");
+}
+
+InterractiveObject TileMap::getObjectAt(const int x, const int y) const {
+    const int slot = at(x, y).getObjectSlot();
+    if (slot == 0 || x < 0 || y < 0 || x >= getWidth() || y >= getHeight()) {
+        return {};
+    }
+    return objects[areaIndex(x / areaTiles, y / areaTiles)][slot - 1];
+}
+
+Vector2D TileMap::getGatewayCenter(const int areaX, const int areaY, const Direction2D&direction) const {
+    const double left = areaX * areaTiles;
+    const double bottom = areaY * areaTiles;
+    if (direction.second != 0) {
+        return {left + areaTiles / 2, direction.second > 0 ? bottom + areaTiles : bottom};
+    }
+    return {direction.first > 0 ? left + areaTiles : left, bottom + 1 + GATEWAY_SIZE / 2.0};
+}
+
+int TileMap::getAreaTiles() const {
+    return areaTiles;
+}
+
+int TileMap::getWidth() const {
+    return areasWide * areaTiles;
+}
+
+int TileMap::getHeight() const {
+    return areasHigh * areaTiles;
+}
+
+std::size_t TileMap::getRunCount() const {
+    return runs.size();
+}
+
+std::size_t TileMap::getMemoryUsage() const {
+    std::size_t bytes = runs.capacity() * sizeof(Run) + rowOffsets.capacity() * sizeof(std::uint32_t);
+    for (const auto&placed: objects) {
+        bytes += placed.capacity() * sizeof(InterractiveObject);
+    }
+    return bytes;
+}
+
+RayHit TileMap::raycast(const RaySegment&ray) const {
+    const double dx = ray.to.x - ray.from.x;
+    const double dy = ray.to.y - ray.from.y;
+    const double length = std::sqrt(dx * dx + dy * dy);
+    if (!std::isfinite(length)) {
+        // A ray that is not finite cannot be walked tile by tile: it is blocked where it starts.
+        return {true, ray.from, floorToCell(ray.from.x), floorToCell(ray.from.y), 0.0};
+    }
+    if (length == 0.0) {
+        return {false, ray.to, -1, -1, 0.0};
+    }
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    int x = floorToCell(ray.from.x);
+    int y = floorToCell(ray.from.y);
+    const int stepX = dx > 0 ? 1 : dx < 0 ? -1 : 0;
+    const int stepY = dy > 0 ? 1 : dy < 0 ? -1 : 0;
+    // The ray is parametrized by t in [0, 1]; tMax is the value of t at the next tile boundary.
+    const double tDeltaX = stepX != 0 ? 1.0 / std::abs(dx) : INF;
+    const double tDeltaY = stepY != 0 ? 1.0 / std::abs(dy) : INF;
+    double tMaxX = stepX > 0 ? (x + 1 - ray.from.x) / dx : stepX < 0 ? (ray.from.x - x) / -dx : INF;
+    double tMaxY = stepY > 0 ? (y + 1 - ray.from.y) / dy : stepY < 0 ? (ray.from.y - y) / -dy : INF;
+    double t = 0.0;
+    // Cursor on the run holding the current tile, valid while the ray stays in the same row.
+    int cursorRow = -1;
+    std::size_t run = 0;
+    int runBegin = 0;
+    int runEnd = 0;
+    while (true) {
+        bool solid = true;
+        if (x >= 0 && y >= 0 && x < getWidth() && y < getHeight()) {
+            if (y != cursorRow || x < runBegin || x >= runEnd) {
+                if (y == cursorRow && x == runEnd) {
+                    ++run;
+                }
+                else if (y == cursorRow && x == runBegin - 1) {
+                    --run;
+                }
+                else {
+                    run = findRun(y, x);
+                }
+                cursorRow = y;
+                runBegin = runs[run].start;
+                runEnd = run + 1 < rowOffsets[y + 1] ? runs[run + 1].start : getWidth();
+            }
+            solid = Tile::fromBits(runs[run].tile).isSolid();
+        }
+        if (solid) {
+            return {true, {ray.from.x + dx * t, ray.from.y + dy * t}, x, y, t * length};
+        }
+        if (tMaxX >= 1.0 && tMaxY >= 1.0) {
+            return {false, ray.to, -1, -1, length};
+        }
+        if (tMaxX < tMaxY) {
+            t = tMaxX;
+            x += stepX;
+            tMaxX += tDeltaX;
+        }
+        else {
+            t = tMaxY;
+            y += stepY;
+            tMaxY += tDeltaY;
+        }
+    }
+}
+
+void TileMap::raycast(const std::vector<RaySegment>&rays, std::vector<RayHit>&hits) const {
+    hits.resize(rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        hits[i] = raycast(rays[i]);
+    }
+}
+
+bool TileMap::hasLineOfSight(const Vector2D&from, const Vector2D&to) const {
+    return !raycast({from, to}).blocked;
+}
+
+void TileMap::hasLineOfSight(const std::vector<RaySegment>&rays, std::vector<std::uint8_t>&visible) const {
+    visible.resize(rays.size());
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        visible[i] = !raycast(rays[i]).blocked;
+    }
+}
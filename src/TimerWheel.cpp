@@ -0,0 +1,123 @@
+#ifndef _WIN64
+#define PCH_H
+#endif
+#include "pch.h"
+#include "TimerWheel.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+TimerWheel::TimerWheel(const TimePoint origin) : origin(origin) {
+}
+
+void TimerWheel::insert(const Entry&entry) {
+    const std::uint64_t tick = std::max(entry.tick, current);
+    for (int level = 0; level < LEVELS; ++level) {
+        // The lowest level whose higher bits match the current tick is entered last, right before the due tick.
+        const int shift = SLOT_BITS * (level + 1);
+        if (tick >> shift == current >> shift) {
+            const std::uint64_t index = tick >> (SLOT_BITS * level) & (SLOTS - 1);
+            wheels[level][index].push_back({tick, entry.event});
+            occupied[level] |= std::uint64_t{1} << index;
+            return;
+        }
+    }
+    overflow.push_back({tick, entry.event});
+}
+
+void TimerWheel::cascade(const int level) {
+    const std::uint64_t index = current >> (SLOT_BITS * level) & (SLOTS - 1);
+    auto&slot = wheels[level][index];
+    if (slot.empty()) {
+        return;
+    }
+    const std::vector<Entry> entries = std::move(slot);
+    slot.clear();
+    occupied[level] &= ~(std::uint64_t{1} << index);
+    for (const Entry&entry: entries) {
+        insert(entry);
+    }
+}
+
+std::uint64_t TimerWheel::nextBusyTick() const {
+    std::uint64_t next = std::numeric_limits<std::uint64_t>::max();
+    if (!overflow.empty()) {
+        next = (current / HORIZON + 1) * HORIZON;
+    }
+    for (int level = 0; level < LEVELS; ++level) {
+        // The slots of a level only hold ticks of the block of the current tick, after its own slot.
+        const std::uint64_t index = current >> (SLOT_BITS * level) & (SLOTS - 1);
+        const std::uint64_t later = occupied[level] & ~((std::uint64_t{2} << index) - 1);
+        if (later != 0) {
+            const int shift = SLOT_BITS * (level + 1);
+            const std::uint64_t block = current >> shift << shift;
+            next = std::min(next, block + (static_cast<std::uint64_t>(std::countr_zero(later)) << (SLOT_BITS * level)));
+        }
+    }
+    return next;
+}
+
+void TimerWheel::schedule(const TimerEvent&event, const TimePoint dueAt) {
+    std::uint64_t tick = 0;
+    if (dueAt > origin) {
+        // Rounded up, so that an event never falls due before its time.
+        tick = static_cast<std::uint64_t>(std::chrono::ceil<Tick>(dueAt - origin).count());
+    }
+    insert({tick, event});
+    ++count;
+}
+
+void TimerWheel::advance(const TimePoint now, std::vector<TimerEvent>&due) {
+    if (now < origin) {
+        return;
+    }
+    const auto target = static_cast<std::uint64_t>(std::chrono::floor<Tick>(now - origin).count());
+    while (count > 0 && current <= target) {
+        if (current % HORIZON == 0 && !overflow.empty()) {
+            const std::vector<Entry> entries = std::move(overflow);
+            overflow.clear();
+            for (const Entry&entry: entries) {
+                insert(entry);
+            }
+        }
+        for (int level = LEVELS - 1; level > 0; --level) {
+            if (current % (std::uint64_t{1} << (SLOT_BITS * level)) == 0) {
+                cascade(level);
+            }
+        }
+        auto&slot = wheels[0][current & (SLOTS - 1)];
+        for (const Entry&entry: slot) {
+            due.push_back(entry.event);
+        }
+        count -= slot.size();
+        slot.clear();
+        occupied[0] &= ~(std::uint64_t{1} << (current & (SLOTS - 1)));
+        // The ticks up to the next occupied slot or cascade hold nothing: jump over them.
+        current = std::min(nextBusyTick(), target + 1);
+    }
+    current = std::max(current, target + 1);
+}
+
+TimerWheel::TimePoint TimerWheel::getDrainedTime() const {
+    // An event is due at the tick rounding its time up: the ones before the current tick were drained.
+    return origin + Tick(current) - Tick(1);
+}
+
+std::size_t TimerWheel::size() const {
+    return count;
+}
+
+bool TimerWheel::empty() const {
+    return count == 0;
+}
+
+void TimerWheel::clear() {
+    for (auto&level: wheels) {
+        for (auto&slot: level) {
+            slot.clear();
+        }
+    }
+    occupied.fill(0);
+    overflow.clear();
+    count = 0;
+}
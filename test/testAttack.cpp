@@ -15,4 +15,33 @@ TEST(AttackTest, canUseAttack) {
     EXPECT_TRUE(attack.isUsing()); 
     EXPECT_FALSE(attack.canUse());
     EXPECT_TRUE(attack.isUsing());
-}
\ No newline at end of file
+}
+
+TEST(AttackTest, goesThroughItsPhasesFromTheDeadlinesOfItsUse) {
+    using std::chrono::milliseconds;
+    Attack attack = Attack("ATTACK1", 10, 1.0, 1.0, 2.0);
+    EXPECT_EQ(IDLE, attack.getPhase(std::chrono::steady_clock::now()));
+    EXPECT_DOUBLE_EQ(0.0, attack.getPhaseProgress(std::chrono::steady_clock::now()));
+    attack.use();
+    const auto used = attack.getLastUsageTime();
+    EXPECT_EQ(used + milliseconds(1000), attack.getChargedTime());
+    EXPECT_EQ(WINDUP, attack.getPhase(used));
+    EXPECT_NEAR(0.5, attack.getPhaseProgress(used + milliseconds(500)), 1e-9);
+    EXPECT_EQ(ACTIVE, attack.getPhase(used + milliseconds(1250)));
+    EXPECT_NEAR(0.5, attack.getPhaseProgress(used + milliseconds(1250)), 1e-9);
+    EXPECT_EQ(RECOVERING, attack.getPhase(used + milliseconds(2000)));
+    EXPECT_EQ(COOLDOWN, attack.getPhase(used + milliseconds(3500)));
+    EXPECT_NEAR(0.5, attack.getPhaseProgress(used + milliseconds(3500)), 1e-9);
+    EXPECT_EQ(IDLE, attack.getPhase(used + milliseconds(4500)));
+}
+
+TEST(AttackTest, spendsItsActiveFractionOfTheAnimationStriking) {
+    using std::chrono::milliseconds;
+    EXPECT_THROW(Attack("ATTACK1", 10, 1.0, 1.0, 2.0, 1.5), std::invalid_argument);
+    Attack attack = Attack("ATTACK1", 10, 1.0, 1.0, 2.0, 0.75);
+    EXPECT_DOUBLE_EQ(0.75, attack.getActiveFraction());
+    EXPECT_EQ(10, attack.use());
+    const auto used = attack.getLastUsageTime();
+    EXPECT_EQ(ACTIVE, attack.getPhase(used + milliseconds(2250)));
+    EXPECT_EQ(RECOVERING, attack.getPhase(used + milliseconds(2750)));
+}
@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "Behaviour.hpp"
+
+TEST(BehaviourTest, chaseWaitsForThePlayerThenAttacks) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    EXPECT_FALSE(game.startBehaviour(playerId, CHASE));
+    EXPECT_FALSE(game.startBehaviour(enemyId, 42));
+    game.setCharacterPosition(playerId, {5.0, 5.0});
+    game.setCharacterPosition(enemyId, {80.0, 80.0});
+    ASSERT_TRUE(game.startBehaviour(enemyId, CHASE));
+    EXPECT_TRUE(game.hasBehaviour(enemyId));
+    const int health = game.getPlayerCurrentHealth();
+    game.stepPhysics(0.0);
+    game.stepPhysics(0.0);
+    EXPECT_EQ(health, game.getPlayerCurrentHealth());
+    game.setCharacterPosition(enemyId, {5.0, 5.0});
+    game.stepPhysics(0.0);
+    EXPECT_LT(game.getPlayerCurrentHealth(), health);
+    EXPECT_TRUE(game.stopBehaviour(enemyId));
+    EXPECT_FALSE(game.hasBehaviour(enemyId));
+    EXPECT_FALSE(game.stopBehaviour(enemyId));
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "Game.hpp"
+#include "DamageBuffer.hpp"
+
+TEST(DamageBufferTest, resolvesTheHitsOfATickOncePerTarget) {
+    Level level(1, {{Area(40, 1, {}, {{1, 1, 2}, {2, 1, 2}})}});
+    const int first = level.spawn_at(0, 0, 1, 1.0);
+    const int second = level.spawn_at(0, 0, 2, 1.0);
+    const int health = level.getEnemy(second).getHealth().current;
+    level.addEnemyModifier(first, {DAMAGE_TAKEN, BUFF, 0.0, 0.5});
+    DamageBuffer buffer;
+    buffer.push({7, second, health - 1});
+    buffer.push({8, first, 10});
+    buffer.push({9, second, 5});
+    buffer.push({10, second, 5});
+    buffer.push({11, 424242, 5});
+    EXPECT_THROW(buffer.push({7, first, -1}), std::invalid_argument);
+    std::vector<DamageResult> results;
+    level.resolveEnemyHits(buffer.sortByTarget(), results);
+    std::ranges::sort(results, {}, &DamageResult::targetId);
+    ASSERT_EQ(2u, results.size());
+    EXPECT_EQ(5, results[0].damage);
+    EXPECT_EQ(-1, results[0].killerId);
+    EXPECT_TRUE(results[0].hurtStarted);
+    EXPECT_EQ(health + 9, results[1].damage);
+    EXPECT_EQ(9, results[1].killerId);
+    EXPECT_EQ(0, level.getEnemy(second).getHealth().current);
+}
+
+TEST(DamageBufferTest, deferredHitsWaitForThePhysicsStep) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    const int playerId = game.getPlayerId();
+    ASSERT_NE(-1, enemyId);
+    const int health = game.getCharacterHealth(enemyId);
+    game.setDeferredDamage(true);
+    EXPECT_TRUE(game.isDamageDeferred());
+    game.attack(playerId, "ATTACK1", enemyId);
+    EXPECT_EQ(health, game.getCharacterHealth(enemyId));
+    game.stepPhysics(0.0);
+    const int damage = DefinedAttacks::get(ATTACK1).attack.getDamage();
+    EXPECT_EQ(std::max(0, health - damage), game.getCharacterHealth(enemyId));
+    EXPECT_EQ(health <= damage ? 1u : 0u, game.drainDeathEvents(10).size());
+}
+
+TEST(DamageBufferTest, skipsTheHitsOnDeadEnemies) {
+    Level level(1, {{Area(40, 1, {}, {{1, 1, 2}})}});
+    const int enemyId = level.spawn_at(0, 0, 1, 1.0);
+    const int health = level.getEnemy(enemyId).getHealth().current;
+    level.bleedEnemy(enemyId, health);
+    DamageBuffer buffer;
+    buffer.push({7, enemyId, 10});
+    std::vector<DamageResult> results;
+    level.resolveEnemyHits(buffer.sortByTarget(), results);
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(0, level.getEnemy(enemyId).getHealth().current);
+}
@@ -0,0 +1,21 @@
+#include <gtest/gtest.h>
+#include "FramePool.hpp"
+#include <cstdint>
+
+TEST(FramePoolTest, recyclesItsBlocks) {
+    EXPECT_THROW(FramePool(8), std::invalid_argument);
+    FramePool pool(128);
+    void* first = pool.allocate(64);
+    EXPECT_EQ(1u, pool.getUsedBlocks());
+    EXPECT_EQ(FramePool::BLOCKS_PER_CHUNK, pool.getCapacity());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(first) % alignof(std::max_align_t));
+    FramePool::deallocate(first, 64);
+    EXPECT_EQ(0u, pool.getUsedBlocks());
+    EXPECT_EQ(first, pool.allocate(64));
+    void* large = pool.allocate(512);
+    EXPECT_EQ(1u, pool.getOverflowCount());
+    EXPECT_EQ(1u, pool.getUsedBlocks());
+    FramePool::deallocate(large, 512);
+    pool.reserve(FramePool::BLOCKS_PER_CHUNK + 1);
+    EXPECT_EQ(2 * FramePool::BLOCKS_PER_CHUNK, pool.getCapacity());
+}
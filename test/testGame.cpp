@@ -4,8 +4,13 @@
 #include <gtest/gtest.h>
 #include "Game.hpp"
 #include "GameController.hpp"
+#include <thread>
 #include <tuple>
 #include "Level.hpp"
+#include "GameOverException.hpp"
+#include "Snapshot.hpp"
+#include "GameState.hpp"
+#include <filesystem>
 
 TEST(GameTest, DefaultConstructorInitializesActiveLevelToNegativeOne) {
     Game game;
@@ -539,3 +544,287 @@ TEST(GameTest, nextLevel) {
     EXPECT_NO_THROW(game.nextLevel(bossId));
     EXPECT_EQ(1, game.getActiveLevel().getId());
 }
+
+TEST(GameTest, enemyAIChasesThenAttacksThePlayer) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    const double follow = game.getEnemyFollowRange(enemyId);
+    const double reach = game.getEnemyAttackRange(enemyId);
+    ASSERT_LT(reach, follow);
+    game.setCharacterPosition(playerId, {5.0, 5.0});
+    game.setCharacterPosition(enemyId, {5.0 + (follow + reach) / 2, 5.0});
+    EXPECT_EQ(0, game.updateEnemyAI());
+    EXPECT_EQ(-1.0, game.getCharacter(enemyId).getRunInput());
+    game.setCharacterPosition(enemyId, {5.0 + follow * 2, 5.0});
+    EXPECT_EQ(0, game.updateEnemyAI());
+    EXPECT_EQ(0.0, game.getCharacter(enemyId).getRunInput());
+    const int health = game.getPlayerCurrentHealth();
+    game.setCharacterPosition(enemyId, {5.0, 5.0});
+    EXPECT_EQ(1, game.updateEnemyAI());
+    EXPECT_LT(game.getPlayerCurrentHealth(), health);
+    EXPECT_EQ(0, game.updateEnemyAI());
+    EXPECT_FALSE(game.setEnemyAIWorkers(0));
+    EXPECT_TRUE(game.setEnemyAIWorkers(4));
+}
+
+TEST(GameTest, playersShareTheSessionAndTheEnemies) {
+    Game game;
+    const int hostId = game.getPlayerId();
+    const int guestId = game.addPlayer(1, 2, 3);
+    ASSERT_NE(-1, guestId);
+    EXPECT_EQ(-1, game.addPlayer(-1, 2, 3));
+    EXPECT_EQ((std::vector{hostId, guestId}), game.getPlayerIds());
+    EXPECT_TRUE(game.isPlayer(guestId));
+    EXPECT_TRUE(game.isAValidId(guestId));
+    EXPECT_EQ(0, game.getCharacterType(guestId));
+    EXPECT_FALSE(game.removePlayer(hostId));
+
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    game.setCharacterPosition(hostId, {5.0, 5.0});
+    game.setCharacterPosition(guestId, {50.0, 5.0});
+    game.setCharacterPosition(enemyId, {50.0, 5.0});
+    EXPECT_EQ(guestId, game.getNearestPlayer({49.0, 5.0}));
+    const int guestHealth = game.getCharacter(guestId).getHealth().current;
+    const int hostHealth = game.getPlayerCurrentHealth();
+    EXPECT_EQ(1, game.updateEnemyAI());
+    EXPECT_LT(game.getCharacter(guestId).getHealth().current, guestHealth);
+    EXPECT_EQ(hostHealth, game.getPlayerCurrentHealth());
+
+    std::vector<int> ids;
+    std::vector<double> times;
+    game.getRemainingTimes(ids, times);
+    EXPECT_EQ(hostId, ids[0]);
+    EXPECT_EQ(guestId, ids[1]);
+    EXPECT_EQ(ids.size() * Character::REMAINING_TIME_COUNT, times.size());
+
+    // The game goes on while a player is alive.
+    EXPECT_THROW(game.takePlayerDamage(game.getPlayerMaxHealth() * 10), GameOverException);
+    game.stepPhysics(0.0);
+    EXPECT_FALSE(game.isOver());
+    EXPECT_EQ(guestId, game.getNearestPlayer({5.0, 5.0}));
+    EXPECT_EQ(2, game.applyStatusEffect({guestId, enemyId}, SLOW, 0.5, 60.0));
+    EXPECT_TRUE(game.removePlayer(guestId));
+    EXPECT_FALSE(game.isAValidId(guestId));
+    EXPECT_EQ(1u, game.getPlayerCount());
+    // The last player alive left, with its effects.
+    EXPECT_TRUE(game.isOver());
+    std::vector<int> types;
+    game.getStatusEffects(ids, types, times);
+    EXPECT_EQ(std::vector{enemyId}, ids);
+}
+
+TEST(GameTest, playersCannotHurtEachOther) {
+    Game game;
+    const int hostId = game.getPlayerId();
+    const int guestId = game.addPlayer(1, 2, 3);
+    ASSERT_NE(-1, guestId);
+    const std::string attackName = game.getCharacter(hostId).getAttackAt(0).getName();
+    EXPECT_THROW(game.attack(hostId, attackName, guestId), std::invalid_argument);
+    EXPECT_THROW(game.attack(hostId, attackName, hostId), std::invalid_argument);
+    game.stepPhysics(0.0);
+    EXPECT_EQ(Player::DEF_MAX_HEALTH, game.getCharacterHealth(guestId));
+    EXPECT_EQ(Player::DEF_MAX_HEALTH, game.getCharacterHealth(hostId));
+    EXPECT_TRUE(game.canCharacterAttack(hostId, attackName));
+}
+
+TEST(GameTest, aSessionHoldsAtMostMaxPlayers) {
+    Game game;
+    for (std::size_t i = 1; i < Game::MAX_PLAYERS; ++i) {
+        EXPECT_NE(-1, game.addPlayer(0, 1, 2));
+    }
+    EXPECT_EQ(-1, game.addPlayer(0, 1, 2));
+    EXPECT_EQ(Game::MAX_PLAYERS, game.getPlayerCount());
+}
+
+TEST(GameTest, aSnapshotRestoresTheGame) {
+    const std::string path = (std::filesystem::temp_directory_path() / "aSnapshotRestoresTheGame.ror").string();
+    Game game;
+    const int hostId = game.getPlayerId();
+    const int guestId = game.addPlayer(2, 3, 4);
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    game.setCharacterPosition(guestId, {50.0, 5.0});
+    game.setCharacterPosition(enemyId, {50.0, 5.0});
+    EXPECT_EQ(1, game.updateEnemyAI());
+    game.takePlayerDamage(30);
+    ASSERT_TRUE(game.addCharacterBuff(guestId, MAX_HEALTH, 0.0, 2.0, 60.0));
+    ASSERT_EQ(1, game.applyStatusEffect({enemyId}, SLOW, 0.5, 60.0));
+    game.saveSnapshot(path);
+
+    Game restored;
+    restored.loadSnapshot(path);
+    std::filesystem::remove(path);
+    EXPECT_EQ(game.getPlayerIds(), restored.getPlayerIds());
+    EXPECT_EQ(game.getEnemyIds(), restored.getEnemyIds());
+    EXPECT_EQ(game.getActiveLevel().getId(), restored.getActiveLevel().getId());
+    for (int x = 0; x < Level::LENGTH; ++x) {
+        for (int y = 0; y < Level::HEIGHT; ++y) {
+            EXPECT_EQ(game.get_area_guid_current_level(x, y), restored.get_area_guid_current_level(x, y));
+        }
+    }
+    for (const int id: {hostId, guestId, enemyId}) {
+        Vector2D saved;
+        Vector2D loaded;
+        ASSERT_TRUE(restored.getCharacterPosition(id, loaded));
+        game.getCharacterPosition(id, saved);
+        EXPECT_EQ(saved.x, loaded.x);
+        EXPECT_EQ(saved.y, loaded.y);
+        EXPECT_EQ(game.getCharacterHealth(id), restored.getCharacterHealth(id));
+        EXPECT_EQ(game.getCharacterMaxHealth(id), restored.getCharacterMaxHealth(id));
+        EXPECT_DOUBLE_EQ(game.getCharacterSpeed(id), restored.getCharacterSpeed(id));
+    }
+    EXPECT_EQ(Player::DEF_MAX_HEALTH - 30, restored.getPlayerCurrentHealth());
+    EXPECT_EQ(game.getDamage(guestId, "ATTACK4"), restored.getDamage(guestId, "ATTACK4"));
+    const std::string attack = game.getCharacter(enemyId).getAttackAt(0).getName();
+    EXPECT_FALSE(restored.canCharacterAttack(enemyId, attack));
+    EXPECT_NEAR(game.getCharacterCoolDownAttack(enemyId, attack), restored.getCharacterCoolDownAttack(enemyId, attack), 0.1);
+    EXPECT_GT(restored.getCharacterStatusEffectTime(enemyId, SLOW), 59.0);
+
+    // The characters joining the restored game do not take the IDs of the restored ones.
+    const int newcomerId = restored.addPlayer(0, 1, 2);
+    EXPECT_GT(newcomerId, std::ranges::max(game.getEnemyIds()));
+}
+
+TEST(GameTest, anInvalidSnapshotLeavesTheGameUntouched) {
+    Game game;
+    std::vector<std::byte> bytes;
+    Snapshot::save(game, bytes);
+    Game other;
+    const std::vector<int> ids = other.getPlayerIds();
+    EXPECT_THROW(Snapshot::load(other, std::span(bytes).first(bytes.size() / 2)), std::invalid_argument);
+    bytes[4] = std::byte{0x7f};
+    EXPECT_THROW(Snapshot::load(other, bytes), std::invalid_argument);
+    EXPECT_EQ(ids, other.getPlayerIds());
+    EXPECT_THROW(other.loadSnapshot("no/such/snapshot.ror"), std::runtime_error);
+
+    GameController controller(0, 1, 2);
+    EXPECT_FALSE(controller.loadSnapshot("no/such/snapshot.ror"));
+    EXPECT_FALSE(controller.saveSnapshot("no/such/snapshot.ror"));
+}
+
+TEST(GameTest, aLoadedSnapshotKeepsThePendingTimersAndTheScripts) {
+    Game game;
+    const int hostId = game.getPlayerId();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    ASSERT_TRUE(game.startBehaviour(enemyId, CHASE));
+    game.move(hostId, "DASH");
+    std::vector<std::byte> bytes;
+    Snapshot::save(game, bytes);
+
+    Game restored;
+    Snapshot::load(restored, bytes);
+    EXPECT_TRUE(restored.hasBehaviour(enemyId));
+    EXPECT_TRUE(restored.drainTimerEvents(10).empty());
+    std::this_thread::sleep_for(std::chrono::duration<double>(Dash::DEF_ANIMATION_TIME + 0.05));
+    const auto events = restored.drainTimerEvents(10);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(hostId, events[0].characterId);
+    EXPECT_EQ(MOVEMENT_ENDED, events[0].type);
+    EXPECT_EQ(DASH, events[0].capability);
+}
+
+TEST(GameTest, restoringAStateRewindsTheGame) {
+    Game game;
+    const int hostId = game.getPlayerId();
+    GameState beforeSpawn;
+    game.saveState(beforeSpawn);
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    game.setCharacterPosition(enemyId, {50.0, 5.0});
+    const std::string attack = game.getCharacter(hostId).getAttackAt(0).getName();
+    const int enemyHealth = game.getCharacterHealth(enemyId);
+    GameState state;
+    game.saveState(state);
+
+    game.setCharacterPosition(hostId, {52.0, 5.0});
+    game.setCharacterPosition(enemyId, {10.0, 5.0});
+    game.takePlayerDamage(30);
+    game.attack(hostId, attack, enemyId);
+    ASSERT_TRUE(game.addCharacterBuff(enemyId, MAX_HEALTH, 0.0, 2.0, 60.0));
+    ASSERT_FALSE(game.canCharacterAttack(hostId, attack));
+
+    ASSERT_TRUE(game.restoreState(state));
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemyIds());
+    EXPECT_EQ(Player::DEF_MAX_HEALTH, game.getPlayerCurrentHealth());
+    EXPECT_EQ(enemyHealth, game.getCharacterHealth(enemyId));
+    EXPECT_EQ(enemyHealth, game.getCharacterMaxHealth(enemyId));
+    EXPECT_TRUE(game.canCharacterAttack(hostId, attack));
+    Vector2D position;
+    ASSERT_TRUE(game.getCharacterPosition(enemyId, position));
+    EXPECT_EQ(50.0, position.x);
+
+    // Rewinding before the spawn removes the enemy and makes the spawn point ready again, under a new ID.
+    ASSERT_TRUE(game.restoreState(beforeSpawn));
+    EXPECT_TRUE(game.getEnemyIds().empty());
+    EXPECT_FALSE(game.isAValidId(enemyId));
+    EXPECT_GT(game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1), enemyId);
+    EXPECT_FALSE(Game().restoreState(state));
+}
+
+TEST(GameTest, restoringAStateRewindsTheTimersAndTheScripts) {
+    Game game;
+    const int hostId = game.getPlayerId();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    ASSERT_TRUE(game.startBehaviour(enemyId, CHASE));
+    GameState state;
+    game.saveState(state);
+    game.move(hostId, "DASH");
+    ASSERT_TRUE(game.stopBehaviour(enemyId));
+
+    // The dash is undone: its end is no longer pending.
+    ASSERT_TRUE(game.restoreState(state));
+    EXPECT_TRUE(game.hasBehaviour(enemyId));
+    std::this_thread::sleep_for(std::chrono::duration<double>(Dash::DEF_ANIMATION_TIME + 0.05));
+    EXPECT_TRUE(game.drainTimerEvents(10).empty());
+
+    // A dash taken before the state still ends once.
+    game.move(hostId, "DASH");
+    game.saveState(state);
+    ASSERT_TRUE(game.restoreState(state));
+    std::this_thread::sleep_for(std::chrono::duration<double>(Dash::DEF_ANIMATION_TIME + 0.05));
+    const auto events = game.drainTimerEvents(10);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(MOVEMENT_ENDED, events[0].type);
+    EXPECT_EQ(DASH, events[0].capability);
+}
+
+TEST(EnemyAITest, splittingThePassKeepsTheCommands) {
+    EnemyPerception perception;
+    constexpr int COUNT = 10000;
+    for (int i = 0; i < COUNT; ++i) {
+        perception.add(i, {i % 100 * 0.5, i / 100 * 0.5}, 20.0, 3.0, i % 3 - 1);
+    }
+    const Vector2D target{25.0, 25.0};
+    EnemyCommands serial;
+    EnemyAI(1).decide(perception, target, serial);
+    EnemyCommands parallel;
+    EnemyAI(4, 1000).decide(perception, target, parallel);
+    EXPECT_EQ(serial.runInputs, parallel.runInputs);
+    EXPECT_EQ(serial.attacks, parallel.attacks);
+    const std::size_t near = 50 * 100 + 50;
+    EXPECT_EQ(0.0, serial.runInputs[near]);
+    EXPECT_EQ(perception.readyAttack[near], serial.attacks[near]);
+    EXPECT_EQ(1.0, serial.runInputs[50 * 100 + 40]);
+    EXPECT_EQ(-1, serial.attacks[50 * 100 + 40]);
+    EXPECT_EQ(0.0, serial.runInputs[0]);
+    EXPECT_THROW(EnemyAI(0), std::invalid_argument);
+}
+
+TEST(EnemyAITest, anEnemyOnlyAttacksATargetInSight) {
+    EnemyPerception perception;
+    perception.add(0, {0.0, 0.0}, 20.0, 3.0, ATTACK1, -1, 0);
+    perception.add(1, {0.0, 0.0}, 20.0, 3.0, ATTACK1);
+    EnemyCommands commands;
+    EnemyAI().decide(perception, Vector2D{2.0, 0.0}, commands);
+    // The hidden target is followed around the wall instead.
+    EXPECT_EQ(-1, commands.attacks[0]);
+    EXPECT_EQ(1.0, commands.runInputs[0]);
+    EXPECT_EQ(0, commands.targets[0]);
+    EXPECT_EQ(ATTACK1, commands.attacks[1]);
+    EXPECT_EQ(0.0, commands.runInputs[1]);
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "KinematicIntegrator.hpp"
+
+TEST(KinematicIntegratorTest, fallsUnderGravityUntilTheGround) {
+    KinematicIntegrator integrator(0.1, 10.0);
+    KinematicBodies bodies;
+    bodies.add(0, {0.0, 1.0}, {2.0, 0.0}, {0.0, 0.0}, 1.0, 0.0);
+    integrator.step(bodies);
+    EXPECT_DOUBLE_EQ(-1.0, bodies.vy[0]);
+    EXPECT_DOUBLE_EQ(0.9, bodies.y[0]);
+    EXPECT_DOUBLE_EQ(0.2, bodies.x[0]);
+    EXPECT_EQ(0, bodies.grounded[0]);
+    for (int i = 0; i < 10; ++i) {
+        integrator.step(bodies);
+    }
+    EXPECT_DOUBLE_EQ(0.0, bodies.y[0]);
+    EXPECT_DOUBLE_EQ(0.0, bodies.vy[0]);
+    EXPECT_EQ(1, bodies.grounded[0]);
+}
+
+TEST(KinematicIntegratorTest, thrustLiftsAgainstGravity) {
+    KinematicIntegrator integrator(0.1, KinematicIntegrator::DEF_GRAVITY);
+    KinematicBodies bodies;
+    bodies.add(0, {0.0, 0.0}, {0.0, 0.0}, {0.0, JetPack::DEF_FORCE}, 1.0, 0.0);
+    bodies.add(1, {0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}, 1.0, 0.0);
+    integrator.step(bodies);
+    EXPECT_GT(bodies.y[0], 0.0);
+    EXPECT_EQ(0, bodies.grounded[0]);
+    EXPECT_DOUBLE_EQ(0.0, bodies.y[1]);
+    EXPECT_EQ(1, bodies.grounded[1]);
+}
+
+TEST(KinematicIntegratorTest, carriesTheRemainderOverToTheNextAdvance) {
+    KinematicIntegrator integrator(0.1, 0.0);
+    KinematicBodies bodies;
+    EXPECT_EQ(1, integrator.advance(bodies, 0.15));
+    EXPECT_EQ(1, integrator.advance(bodies, 0.06));
+    EXPECT_EQ(KinematicIntegrator::MAX_STEPS_PER_ADVANCE, integrator.advance(bodies, 100.0));
+    EXPECT_EQ(0, integrator.advance(bodies, 0.0));
+    EXPECT_THROW(integrator.advance(bodies, -1.0), std::invalid_argument);
+    EXPECT_THROW(KinematicIntegrator(0.0, 1.0), std::invalid_argument);
+}
+
+TEST(KinematicIntegratorTest, reportsTheTimeDroppedBeyondTheStepLimit) {
+    KinematicIntegrator integrator(0.1, 0.0);
+    KinematicBodies bodies;
+    EXPECT_EQ(KinematicIntegrator::MAX_STEPS_PER_ADVANCE, integrator.advance(bodies, 1.05));
+    EXPECT_NEAR(0.2, integrator.getDroppedTime(), 1e-9);
+    EXPECT_EQ(0, integrator.advance(bodies, 0.04));
+    EXPECT_EQ(1, integrator.advance(bodies, 0.02));
+    EXPECT_NEAR(0.2, integrator.getDroppedTime(), 1e-9);
+    integrator.reset();
+    EXPECT_DOUBLE_EQ(0.0, integrator.getDroppedTime());
+}
+
+TEST(KinematicIntegratorTest, gathersTheDashAtTheSimulationTime) {
+    Player player;
+    player.move("DASH");
+    const auto start = std::chrono::steady_clock::now();
+    KinematicBodies bodies;
+    KinematicIntegrator::gather(player, 0.0, bodies, start);
+    KinematicIntegrator::gather(player, 0.0, bodies, start + std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::duration<double>(Dash::DEF_ANIMATION_TIME * 2)));
+    EXPECT_DOUBLE_EQ(player.getFacing() * Dash::DEF_FORCE * KinematicIntegrator::DASH_SPEED_SCALE, bodies.vx[0]);
+    EXPECT_DOUBLE_EQ(0.0, bodies.gravityScale[0]);
+    EXPECT_DOUBLE_EQ(0.0, bodies.vx[1]);
+    EXPECT_DOUBLE_EQ(1.0, bodies.gravityScale[1]);
+}
+
+TEST(KinematicIntegratorTest, gathersACharacterWithoutMovementsAtRest) {
+    Enemy still("SMALL_MONSTER", 10, 5.0, 1.0, 0.5, Capabilities({}, {}, false), false);
+    still.setRunInput(1.0);
+    KinematicBodies bodies;
+    KinematicIntegrator::gather(still, 0.0, bodies, std::chrono::steady_clock::now());
+    EXPECT_DOUBLE_EQ(0.0, bodies.vx[0]);
+    EXPECT_DOUBLE_EQ(0.0, bodies.ay[0]);
+    EXPECT_DOUBLE_EQ(1.0, bodies.gravityScale[0]);
+}
+
+TEST(KinematicsTest, playerRunsWithItsRunInput) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    game.setCharacterRunInput(playerId, -1.0);
+    for (int i = 0; i < 60; ++i) {
+        game.stepPhysics(KinematicIntegrator::DEF_TIMESTEP);
+    }
+    Vector2D position{};
+    ASSERT_TRUE(game.getCharacterPosition(playerId, position));
+    EXPECT_NEAR(-Player::DEF_RUN_FORCE, position.x, 0.1);
+    EXPECT_DOUBLE_EQ(0.0, position.y);
+    EXPECT_TRUE(game.isCharacterOnGround(playerId));
+}
+
+TEST(KinematicsTest, playerJumpsAndLandsBack) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    // The area (1, 1) of a generated level is a crossroad with a floor on its first row.
+    const Vector2D floor{Level::AREA_SIZE + 4.5, Level::AREA_SIZE + 1.0};
+    game.setCharacterPosition(playerId, floor);
+    game.move(playerId, "JUMP");
+    EXPECT_FALSE(game.isCharacterOnGround(playerId));
+    game.stepPhysics(KinematicIntegrator::DEF_TIMESTEP * 4);
+    Vector2D position{};
+    ASSERT_TRUE(game.getCharacterPosition(playerId, position));
+    EXPECT_GT(position.y, floor.y);
+    for (int i = 0; i < 600 && !game.isCharacterOnGround(playerId); ++i) {
+        game.stepPhysics(KinematicIntegrator::DEF_TIMESTEP);
+    }
+    ASSERT_TRUE(game.getCharacterPosition(playerId, position));
+    EXPECT_DOUBLE_EQ(floor.y, position.y);
+    EXPECT_TRUE(game.isCharacterOnGround(playerId));
+}
+
+TEST(KinematicsTest, movesSpawnedEnemies) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    Vector2D start{};
+    ASSERT_TRUE(game.getCharacterPosition(enemyId, start));
+    game.setCharacterRunInput(enemyId, 1.0);
+    game.stepPhysics(KinematicIntegrator::DEF_TIMESTEP * 4);
+    Vector2D position{};
+    ASSERT_TRUE(game.getCharacterPosition(enemyId, position));
+    EXPECT_GT(position.x, start.x);
+    game.setCharacterPosition(game.getPlayerId(), position);
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemiesInAttackRange(game.getPlayerId()));
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "Game.hpp"
+#include "ModifierStack.hpp"
+
+TEST(ModifierStackTest, derivesTheStatsFromTheBaseOnes) {
+    Player player;
+    const int damage = player.getAttackAt(0).getDamage();
+    const double runForce = player.getMovement("RUN")->getForce();
+    player.addModifier({MAX_HEALTH, ITEM, 20.0});
+    player.addModifier({MAX_HEALTH, DIFFICULTY, 0.0, 2.0});
+    player.addModifier({ATTACK_DAMAGE, ITEM, 5.0});
+    player.addModifier({RUN_FORCE, ITEM, 1.0});
+    EXPECT_EQ((Player::DEF_MAX_HEALTH + 20) * 2, player.getHealth().max);
+    EXPECT_EQ(player.getHealth().max, player.getHealth().current);
+    EXPECT_EQ(damage + 5, player.getAttackAt(0).getDamage());
+    EXPECT_DOUBLE_EQ(runForce + 1.0, player.getMovement("RUN")->getForce());
+    EXPECT_EQ(4u, player.getModifiers().getModifiers().size());
+    EXPECT_THROW(player.addModifier({RUN_FORCE, BUFF, 0.0, -1.0}), std::invalid_argument);
+}
+
+TEST(ModifierStackTest, buffsExpire) {
+    Game game;
+    const int id = game.getPlayerId();
+    EXPECT_FALSE(game.addCharacterBuff(id, 42, 0.0, 2.0, 1.0));
+    EXPECT_FALSE(game.addCharacterBuff(id, MAX_HEALTH, 0.0, 2.0, 0.0));
+    EXPECT_FALSE(game.addCharacterBuff(-1, MAX_HEALTH, 0.0, 2.0, 1.0));
+    ASSERT_TRUE(game.addCharacterBuff(id, MAX_HEALTH, 0.0, 2.0, 0.05));
+    EXPECT_EQ(Player::DEF_MAX_HEALTH * 2, game.getPlayerMaxHealth());
+    EXPECT_EQ(Player::DEF_MAX_HEALTH * 2, game.getPlayerCurrentHealth());
+    game.stepPhysics(0.0);
+    EXPECT_EQ(Player::DEF_MAX_HEALTH * 2, game.getPlayerMaxHealth());
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    game.stepPhysics(0.0);
+    EXPECT_EQ(Player::DEF_MAX_HEALTH, game.getPlayerMaxHealth());
+    EXPECT_EQ(Player::DEF_MAX_HEALTH, game.getPlayerCurrentHealth());
+}
+
+TEST(ModifierStackTest, raisingTheMaxHealthOnlyHealsTheGain) {
+    Player player;
+    player.loseHealth(30);
+    player.addModifier({MAX_HEALTH, BUFF, 10.0});
+    EXPECT_EQ(Player::DEF_MAX_HEALTH + 10, player.getHealth().max);
+    EXPECT_EQ(Player::DEF_MAX_HEALTH - 20, player.getHealth().current);
+    player.addModifier({MAX_HEALTH, BUFF, 0.0, 0.5});
+    EXPECT_EQ((Player::DEF_MAX_HEALTH + 10) / 2, player.getHealth().max);
+    EXPECT_EQ(player.getHealth().max, player.getHealth().current);
+}
+
+TEST(ModifierStackTest, anItemRaisingTheMaxHealthHealsFully) {
+    Player player;
+    player.loseHealth(30);
+    player.addModifier({MAX_HEALTH, ITEM, 10.0});
+    EXPECT_EQ(Player::DEF_MAX_HEALTH + 10, player.getHealth().max);
+    EXPECT_EQ(player.getHealth().max, player.getHealth().current);
+}
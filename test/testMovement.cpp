@@ -1,6 +1,8 @@
 //
 // Created by Enzo Renard on 27/12/2024.
 //
+#include <Capabilities.hpp>
+#include <Jump.hpp>
 #include <Movement.hpp>
 #include <gtest/gtest.h>
 
@@ -15,4 +17,17 @@ TEST(MovementTest, canUsemovement) {
     EXPECT_TRUE(movement.isUsing()); 
     EXPECT_FALSE(movement.canUse());
     EXPECT_TRUE(movement.isUsing());
-}
\ No newline at end of file
+}
+
+TEST(MovementTest, copiedCapabilitiesDoNotShareTheirMovements) {
+    const Capabilities original({}, {std::make_shared<Jump>(1.0, 1)}, false);
+    Capabilities copy = original;
+    copy.getMovement("JUMP")->use();
+    EXPECT_FALSE(copy.getMovement("JUMP")->canUse());
+    EXPECT_TRUE(original.getMovement("JUMP")->canUse());
+    EXPECT_NE(original.getMovement("JUMP"), copy.getMovement("JUMP"));
+
+    copy = original;
+    EXPECT_TRUE(copy.getMovement("JUMP")->canUse());
+    EXPECT_NE(original.getMovement("JUMP"), copy.getMovement("JUMP"));
+}
@@ -0,0 +1,317 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "Enemies.hpp"
+#include "GridCell.hpp"
+#include "LedgeGraph.hpp"
+#include "NavigationGraph.hpp"
+#include <cmath>
+#include <limits>
+
+namespace {
+    /**
+     * Builds a 3x2 grid: a corridor (0, 0) -> (1, 0) -> (1, 1) -> (2, 1), a filled area at (0, 1),
+     * and (2, 0) whose gateway leads to a wall.
+     */
+    std::vector<std::vector<Area>> buildCorridor() {
+        return {
+            {Area(40, 1, {Direction::RIGHT}, {{1, 1, 2}}), Area(0, 1, {})},
+            {Area(40, 1, {Direction::LEFT, Direction::UP}), Area(40, 1, {Direction::DOWN, Direction::RIGHT})},
+            {Area(40, 1, {Direction::UP}), Area(40, 1, {Direction::LEFT})},
+        };
+    }
+}
+
+TEST(NavigationGraphTest, connectsMatchingGatewaysOnly) {
+    const NavigationGraph graph(buildCorridor());
+    EXPECT_TRUE(graph.isConnected(0, 0, Direction::RIGHT));
+    EXPECT_TRUE(graph.isConnected(1, 0, Direction::LEFT));
+    EXPECT_TRUE(graph.isConnected(1, 1, Direction::DOWN));
+    EXPECT_FALSE(graph.isConnected(2, 0, Direction::UP));
+    EXPECT_FALSE(graph.isConnected(0, 0, Direction::UP));
+    EXPECT_FALSE(graph.isConnected(5, 5, Direction::UP));
+    EXPECT_THROW(NavigationGraph({{Area()}, {Area(), Area()}}), std::invalid_argument);
+}
+
+TEST(NavigationGraphTest, followsTheShortestPathThroughTheGateways) {
+    NavigationGraph graph(buildCorridor());
+    EXPECT_EQ(3, graph.getDistance(0, 0, 2, 1));
+    EXPECT_EQ(Direction::RIGHT, graph.getNextGateway(0, 0, 2, 1));
+    EXPECT_EQ(Direction::UP, graph.getNextGateway(1, 0, 2, 1));
+    EXPECT_EQ(Direction::RIGHT, graph.getNextGateway(1, 1, 2, 1));
+    EXPECT_EQ(Direction::LEFT, graph.getNextGateway(2, 1, 0, 0));
+    EXPECT_EQ(0, graph.getDistance(1, 1, 1, 1));
+    EXPECT_EQ(Direction2D(0, 0), graph.getNextGateway(1, 1, 1, 1));
+}
+
+TEST(NavigationGraphTest, reportsUnreachableAndInvalidAreas) {
+    NavigationGraph graph(buildCorridor());
+    EXPECT_EQ(-1, graph.getDistance(2, 0, 0, 0));
+    EXPECT_EQ(Direction2D(0, 0), graph.getNextGateway(2, 0, 0, 0));
+    EXPECT_EQ(-1, graph.getDistance(0, 0, 3, 0));
+    EXPECT_EQ(Direction2D(0, 0), graph.getNextGateway(-1, 0, 0, 0));
+}
+
+TEST(NavigationGraphTest, computesEachDistanceFieldOnce) {
+    NavigationGraph graph(buildCorridor());
+    EXPECT_EQ(0u, graph.getCachedFieldCount());
+    graph.getNextGateway(0, 0, 2, 1);
+    graph.getDistance(1, 0, 2, 1);
+    graph.getNextGateway(1, 1, 2, 1);
+    EXPECT_EQ(1u, graph.getCachedFieldCount());
+    graph.getDistance(2, 1, 0, 0);
+    EXPECT_EQ(2u, graph.getCachedFieldCount());
+}
+
+TEST(NavigationGraphTest, levelGuidesItsEnemiesTowardATarget) {
+    Level level(1, buildCorridor());
+    EXPECT_EQ(3, level.getLength());
+    EXPECT_EQ(2, level.getHeight());
+    EXPECT_FALSE(level.isValidCoordinates(0, 2));
+    EXPECT_EQ(std::make_pair(1, 0), Level::getAreaAt({1.5 * Level::AREA_SIZE, 3.0}));
+    const int id = level.spawn_at(0, 0, 1, 1.0);
+    std::vector<int> ids;
+    std::vector<Direction2D> gateways;
+    level.getEnemyNextGateways({2.5 * Level::AREA_SIZE, 1.5 * Level::AREA_SIZE}, ids, gateways);
+    ASSERT_EQ(1u, ids.size());
+    EXPECT_EQ(id, ids[0]);
+    EXPECT_EQ(Direction::RIGHT, gateways[0]);
+    level.unload();
+    EXPECT_EQ(0u, level.getNavigationGraph().getCachedFieldCount());
+}
+
+TEST(NavigationGraphTest, levelGridDimensionsAreConfigurable) {
+    EXPECT_THROW(Level(1, 1, 3), std::invalid_argument);
+    const Level level = Level(1, 6, 5).generate();
+    EXPECT_EQ(6, level.getLength());
+    EXPECT_EQ(5, level.getHeight());
+    EXPECT_TRUE(level.isValidCoordinates(5, 4));
+    EXPECT_FALSE(level.isValidCoordinates(6, 0));
+    EXPECT_EQ(6 * Level::AREA_TILES, level.getTileMap().getWidth());
+}
+
+TEST(FlowFieldTest, pointsToTheNextGatewayTowardTheTarget) {
+    const auto areas = buildCorridor();
+    NavigationGraph graph(areas);
+    const TileMap map(areas, Level::AREA_TILES);
+    constexpr double S = Level::AREA_SIZE;
+    FlowField field;
+    EXPECT_TRUE(field.update(graph, map, {2.5 * S, 1.5 * S}));
+    const Vector2D fromStart = field.getDirection({0.5 * S, 3.0});
+    EXPECT_DOUBLE_EQ(1.0, fromStart.x);
+    EXPECT_DOUBLE_EQ(0.0, fromStart.y);
+    const Vector2D fromBelow = field.getDirection({S + S / 2, 5.0});
+    EXPECT_DOUBLE_EQ(0.0, fromBelow.x);
+    EXPECT_DOUBLE_EQ(1.0, fromBelow.y);
+    const Vector2D inTargetArea = field.getDirection({2.5 * S, 1.5 * S - 2.0});
+    EXPECT_DOUBLE_EQ(1.0, inTargetArea.y);
+    const Vector2D unreachable = field.getDirection({2.5 * S, 0.5 * S});
+    EXPECT_DOUBLE_EQ(0.0, unreachable.x);
+    EXPECT_DOUBLE_EQ(0.0, unreachable.y);
+    EXPECT_DOUBLE_EQ(0.0, field.getDirection({-5.0, 3.0}).x);
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_DOUBLE_EQ(0.0, field.getDirection({nan, 3.0}).x);
+    EXPECT_DOUBLE_EQ(0.0, field.getDirection({1e300, -1e300}).y);
+    EXPECT_FALSE(field.update(graph, map, {nan, 3.0}));
+    EXPECT_DOUBLE_EQ(1.0, field.getDirection({0.5 * S, 3.0}).x);
+    EXPECT_EQ(std::make_pair(-MAX_CELL, -MAX_CELL), Level::getAreaAt({nan, -1e300}));
+}
+
+TEST(FlowFieldTest, rebuildsOnlyWhenTheTargetChangesArea) {
+    const auto areas = buildCorridor();
+    NavigationGraph graph(areas);
+    const TileMap map(areas, Level::AREA_TILES);
+    constexpr double S = Level::AREA_SIZE;
+    FlowField field;
+    field.update(graph, map, {2.5 * S, 1.5 * S});
+    EXPECT_FALSE(field.update(graph, map, {2.2 * S, 1.8 * S}));
+    EXPECT_EQ(1u, field.getRebuildCount());
+    const Vector2D followsTheTarget = field.getDirection({2.2 * S, 1.5 * S});
+    EXPECT_DOUBLE_EQ(1.0, followsTheTarget.y);
+    EXPECT_TRUE(field.update(graph, map, {0.5 * S, 3.0}));
+    EXPECT_EQ(2u, field.getRebuildCount());
+    std::vector<Vector2D> directions;
+    field.getDirections({{2.5 * S, S + 3.0}, {1.5 * S, 5.0}}, directions);
+    ASSERT_EQ(2u, directions.size());
+    EXPECT_DOUBLE_EQ(-1.0, directions[0].x);
+    EXPECT_LT(directions[1].x, 0.0);
+}
+
+TEST(FlowFieldTest, levelGuidesTheEnemiesInFollowRange) {
+    constexpr double S = Level::AREA_SIZE;
+    Level level(1, buildCorridor());
+    const int id = level.spawn_at(0, 0, 1, 1.0);
+    level.setEnemyPosition(id, {S - 2.0, 3.0});
+    std::vector<int> ids;
+    std::vector<Vector2D> directions;
+    level.getChaseDirections({S + 2.0, 3.0}, ids, directions);
+    ASSERT_EQ(1u, ids.size());
+    EXPECT_EQ(id, ids[0]);
+    EXPECT_DOUBLE_EQ(1.0, directions[0].x);
+    level.getChaseDirections({2.5 * S, 1.5 * S}, ids, directions);
+    EXPECT_TRUE(ids.empty());
+    EXPECT_TRUE(directions.empty());
+}
+
+namespace {
+    /**
+     * Builds a shaft: an area opened upward, whose platforms every 5 rows lead to the area above.
+     */
+    std::vector<std::vector<Area>> buildShaft() {
+        return {{Area(40, 1, {Direction::UP}), Area(40, 1, {Direction::DOWN})}};
+    }
+
+    MovementProfile runAndJump(const double jump) {
+        MovementProfile profile;
+        profile.strengths[RUN] = std::numeric_limits<double>::infinity();
+        profile.strengths[JUMP] = jump;
+        return profile;
+    }
+}
+
+TEST(LedgeGraphTest, findsTheLedgesStandingOnFloorsAndPlatforms) {
+    const LedgeGraph graph(TileMap(buildShaft(), Level::AREA_TILES));
+    const int ground = graph.findLedge({5.5, 1.0});
+    ASSERT_GE(ground, 0);
+    EXPECT_EQ(1, graph.getLedge(ground).row);
+    EXPECT_EQ(1, graph.getLedge(ground).left);
+    EXPECT_EQ(Level::AREA_TILES - 2, graph.getLedge(ground).right);
+    const int platform = graph.findLedge({15.5, 6.0});
+    ASSERT_GE(platform, 0);
+    EXPECT_EQ(12, graph.getLedge(platform).left);
+    EXPECT_EQ(19, graph.getLedge(platform).right);
+    EXPECT_EQ(-1, graph.findLedge({5.5, 3.0}));
+    EXPECT_EQ(-1, graph.findLedge({-5.0, 1.0}));
+}
+
+TEST(LedgeGraphTest, profilesFollowTheCapabilitiesOfTheCharacters) {
+    const auto spectrum = MovementProfile::of(DefinedEnemies::get(SPECTRUM).enemy);
+    EXPECT_TRUE(spectrum.allows(RUN, 0.0));
+    EXPECT_TRUE(spectrum.allows(JUMP, 5.0));
+    EXPECT_FALSE(spectrum.allows(JUMP, 5.5));
+    EXPECT_FALSE(spectrum.allows(CLIMB, 0.0));
+    const auto player = MovementProfile::of(Player());
+    EXPECT_TRUE(player.allows(CLIMB, 0.0));
+    EXPECT_TRUE(player.allows(DASH, 3.0));
+    EXPECT_TRUE(player.allows(JETPACK, 10.0));
+    EXPECT_EQ(spectrum, MovementProfile::of(DefinedEnemies::get(SPECTRUM).enemy));
+}
+
+TEST(LedgeGraphTest, routesUseOnlyTheMovementsOfTheProfile) {
+    LedgeGraph graph(TileMap(buildShaft(), Level::AREA_TILES));
+    const int ground = graph.findLedge({15.5, 1.0});
+    const int platform = graph.findLedge({15.5, 6.0});
+    EXPECT_TRUE(graph.findRoute(runAndJump(5.0), ground, platform).empty());
+    const auto jumped = graph.findRoute(runAndJump(5.0 * std::sqrt(2.0)), ground, platform);
+    ASSERT_EQ(1u, jumped.size());
+    EXPECT_EQ(JUMP, jumped[0].movement);
+    EXPECT_DOUBLE_EQ(1.0, jumped[0].takeoff.y);
+    EXPECT_DOUBLE_EQ(6.0, jumped[0].landing.y);
+    const auto dropped = graph.findRoute(runAndJump(5.0), platform, ground);
+    ASSERT_EQ(1u, dropped.size());
+    EXPECT_EQ(RUN, dropped[0].movement);
+    EXPECT_TRUE(graph.findRoute(runAndJump(5.0), ground, ground).empty());
+    EXPECT_TRUE(graph.findRoute(runAndJump(5.0), ground, -1).empty());
+}
+
+TEST(LedgeGraphTest, cachesTheUsableLinksPerProfile) {
+    LedgeGraph graph(TileMap(buildShaft(), Level::AREA_TILES));
+    const auto spectrum = MovementProfile::of(DefinedEnemies::get(SPECTRUM).enemy);
+    const auto player = MovementProfile::of(Player());
+    EXPECT_LT(graph.getUsableLinkCount(spectrum), graph.getUsableLinkCount(player));
+    EXPECT_LE(graph.getUsableLinkCount(player), graph.getLinks().size());
+    graph.getUsableLinkCount(MovementProfile::of(DefinedEnemies::get(SPECTRUM).enemy));
+    EXPECT_EQ(2u, graph.getCachedProfileCount());
+}
+
+TEST(LedgeGraphTest, profilesAllowingTheSameLinksShareTheirCacheEntry) {
+    LedgeGraph graph(TileMap(buildShaft(), Level::AREA_TILES));
+    const std::size_t links = graph.getUsableLinkCount(runAndJump(5.0));
+    EXPECT_EQ(links, graph.getUsableLinkCount(runAndJump(std::nextafter(5.0, 6.0))));
+    EXPECT_EQ(1u, graph.getCachedProfileCount());
+    EXPECT_EQ(0u, graph.getUsableLinkCount(MovementProfile{}));
+    EXPECT_EQ(2u, graph.getCachedProfileCount());
+    // However many profiles are queried, the cache stays bounded and the links exact.
+    for (int jump = 0; jump < 100; ++jump) {
+        for (int dash = 0; dash < 8; ++dash) {
+            MovementProfile profile = runAndJump(jump * 0.25);
+            profile.strengths[DASH] = dash;
+            EXPECT_LE(graph.getUsableLinkCount(profile), graph.getLinks().size());
+            EXPECT_LE(graph.getCachedProfileCount(), LedgeGraph::MAX_CACHED_PROFILES);
+        }
+    }
+    EXPECT_TRUE(graph.findRoute(runAndJump(5.0), graph.findLedge({15.5, 1.0}), graph.findLedge({15.5, 6.0})).empty());
+}
+
+TEST(LedgeGraphTest, levelPlansRoutesFromTheGroundUnderTheCharacters) {
+    Level level(1, buildShaft());
+    const auto player = MovementProfile::of(Player());
+    const auto route = level.planRoute(player, {15.5, 3.5}, {5.5, Level::AREA_SIZE + 1.0});
+    ASSERT_FALSE(route.empty());
+    EXPECT_DOUBLE_EQ(1.0, route.front().takeoff.y);
+    EXPECT_DOUBLE_EQ(Level::AREA_SIZE + 1.0, route.back().landing.y);
+    const auto spectrum = MovementProfile::of(DefinedEnemies::get(SPECTRUM).enemy);
+    EXPECT_TRUE(level.planRoute(spectrum, {15.5, 1.0}, {15.5, Level::AREA_SIZE + 1.0}).empty());
+}
+
+namespace {
+    /**
+     * Builds the corridor with a second spawn point, in the area at its far end.
+     */
+    std::vector<std::vector<Area>> buildCorridorWithTwoSpawns() {
+        auto areas = buildCorridor();
+        areas[2][1] = Area(40, 1, {Direction::LEFT}, {{1, 1, 2}});
+        return areas;
+    }
+}
+
+TEST(InterestManagerTest, wakesOnlyTheEnemiesNearThePlayer) {
+    constexpr double S = Level::AREA_SIZE;
+    Level level(1, buildCorridorWithTwoSpawns());
+    const int near = level.spawn_at(0, 0, 1, 1.0);
+    const int far = level.spawn_at(2, 1, 1, 1.0);
+    level.setEnemyPosition(near, {0.5 * S, 1.0});
+    level.setEnemyPosition(far, {2.5 * S, 1.5 * S});
+    EXPECT_EQ(2u, level.getAwakeEnemyCount());
+    level.setActivationRadius(1);
+    EXPECT_EQ(0u, level.focusOn({0.5 * S, 3.0}));
+    EXPECT_TRUE(level.isEnemyAwake(near));
+    EXPECT_FALSE(level.isEnemyAwake(far));
+    EXPECT_EQ(1u, level.getAwakeEnemyCount());
+    EXPECT_EQ(1u, level.focusOn({2.5 * S, 1.5 * S}));
+    EXPECT_FALSE(level.isEnemyAwake(near));
+    EXPECT_TRUE(level.isEnemyAwake(far));
+    level.setEnemyPosition(near, {S + 3.0, 1.5 * S});
+    EXPECT_TRUE(level.isEnemyAwake(near));
+    level.setActivationRadius(InterestManager::UNLIMITED);
+    EXPECT_EQ(2u, level.getAwakeEnemyCount());
+    EXPECT_THROW(level.setActivationRadius(-2), std::invalid_argument);
+}
+
+TEST(InterestManagerTest, dormantEnemiesWakeUpOnDemandOnTheGround) {
+    constexpr double S = Level::AREA_SIZE;
+    Level level(1, buildCorridor());
+    const int id = level.spawn_at(0, 0, 1, 1.0);
+    level.setActivationRadius(0);
+    level.focusOn({0.5 * S, 3.0});
+    level.setEnemyPosition(id, {2.5 * S, S + 10.0});
+    EXPECT_FALSE(level.isEnemyAwake(id));
+    level.hurtEnemy(id, 1);
+    EXPECT_TRUE(level.isEnemyAwake(id));
+    const Vector2D position = level.getEnemy(id).getPosition();
+    EXPECT_DOUBLE_EQ(level.getGroundHeight({2.5 * S, S + 10.0}), position.y);
+    EXPECT_FALSE(level.wakeEnemy(id));
+    level.focusOn({S + 3.0, 3.0});
+    EXPECT_FALSE(level.isEnemyAwake(id));
+    EXPECT_THROW(level.wakeEnemy(-1), std::invalid_argument);
+}
+
+TEST(InterestManagerTest, gameValidatesTheActivationRadius) {
+    Game game;
+    EXPECT_EQ(InterestManager::UNLIMITED, game.getActivationRadius());
+    EXPECT_FALSE(game.setActivationRadius(-2));
+    EXPECT_TRUE(game.setActivationRadius(0));
+    EXPECT_EQ(0, game.getActivationRadius());
+    game.stepPhysics(0.1);
+    EXPECT_TRUE(game.isCharacterAwake(game.getPlayerId()));
+    EXPECT_FALSE(game.isCharacterAwake(-5));
+}
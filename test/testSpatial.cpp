@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include "Game.hpp"
+#include "ProjectilePool.hpp"
+#include "SpatialGrid.hpp"
+
+TEST(SpatialGridTest, queriesOnlyPointsWithinRadius) {
+    SpatialGrid grid(4.0);
+    grid.update(1, {0.0, 0.0});
+    grid.update(2, {3.0, 4.0});
+    grid.update(3, {-20.0, 7.5});
+    std::vector<int> ids;
+    grid.queryRadius({0.0, 0.0}, 5.0, ids);
+    std::ranges::sort(ids);
+    EXPECT_EQ((std::vector<int>{1, 2}), ids);
+}
+
+TEST(SpatialGridTest, movesAndRemovesPointsAcrossCells) {
+    SpatialGrid grid(4.0);
+    grid.update(1, {0.0, 0.0});
+    grid.update(1, {100.0, 100.0});
+    std::vector<int> ids;
+    grid.queryRadius({0.0, 0.0}, 10.0, ids);
+    EXPECT_TRUE(ids.empty());
+    grid.queryRadius({101.0, 99.0}, 2.0, ids);
+    EXPECT_EQ(std::vector<int>{1}, ids);
+    grid.remove(1);
+    EXPECT_FALSE(grid.contains(1));
+    EXPECT_EQ(0, grid.size());
+    EXPECT_THROW(SpatialGrid(0.0), std::invalid_argument);
+}
+
+TEST(SpatialGridTest, clampsCoordinatesOutOfTheRangeOfCells) {
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    SpatialGrid grid(4.0);
+    grid.update(1, {0.0, 0.0});
+    grid.update(2, {1e300, -INF});
+    grid.update(3, {std::numeric_limits<double>::quiet_NaN(), 0.0});
+    EXPECT_EQ(3u, grid.size());
+    std::vector<int> ids;
+    grid.queryRadius({0.0, 0.0}, 1.0, ids);
+    EXPECT_EQ(std::vector<int>{1}, ids);
+    ids.clear();
+    grid.queryRadius({0.0, 0.0}, INF, ids);
+    std::ranges::sort(ids);
+    EXPECT_EQ((std::vector<int>{1, 2}), ids);
+    ids.clear();
+    grid.queryRadius({INF, 0.0}, 1.0, ids);
+    grid.queryRadius({0.0, 0.0}, std::numeric_limits<double>::quiet_NaN(), ids);
+    EXPECT_TRUE(ids.empty());
+    grid.update(2, {1.0, 1.0});
+    grid.queryRadius({0.0, 0.0}, 2.0, ids);
+    std::ranges::sort(ids);
+    EXPECT_EQ((std::vector<int>{1, 2}), ids);
+}
+
+TEST(SpatialTest, spawnedEnemiesArePlacedInTheirArea) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    Vector2D position{};
+    ASSERT_TRUE(game.getCharacterPosition(enemyId, position));
+    EXPECT_GE(position.x, Level::AREA_SIZE);
+    EXPECT_LT(position.x, 2 * Level::AREA_SIZE);
+    EXPECT_GE(position.y, Level::AREA_SIZE);
+    EXPECT_LT(position.y, 2 * Level::AREA_SIZE);
+    EXPECT_FALSE(game.getCharacterPosition(-5, position));
+}
+
+TEST(SpatialTest, batchesEnemiesInRangeOfThePlayer) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    const int playerId = game.getPlayerId();
+    ASSERT_NE(-1, enemyId);
+    const double followRange = game.getEnemyFollowRange(enemyId);
+    const double attackRange = game.getEnemyAttackRange(enemyId);
+    game.setCharacterPosition(enemyId, {0.0, 0.0});
+
+    game.setCharacterPosition(playerId, {attackRange / 2, 0.0});
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemiesInFollowRange(playerId));
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemiesInAttackRange(playerId));
+
+    game.setCharacterPosition(playerId, {0.0, (attackRange + followRange) / 2});
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemiesInFollowRange(playerId));
+    EXPECT_TRUE(game.getEnemiesInAttackRange(playerId).empty());
+
+    game.setCharacterPosition(playerId, {followRange + 1.0, 0.0});
+    EXPECT_TRUE(game.getEnemiesInFollowRange(playerId).empty());
+
+    game.setCharacterPosition(enemyId, {followRange + 1.0, 1.0});
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemiesInAttackRange(playerId));
+}
+
+TEST(SpatialTest, setsVelocities) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    game.setCharacterVelocity(playerId, {2.0, -1.0});
+    Vector2D velocity{};
+    ASSERT_TRUE(game.getCharacterVelocity(playerId, velocity));
+    EXPECT_DOUBLE_EQ(2.0, velocity.x);
+    EXPECT_DOUBLE_EQ(-1.0, velocity.y);
+}
+
+TEST(AreaAttackTest, hitsEveryEnemyWithinTheShape) {
+    Level level(1, {{Area(40, 1, {}, {{1, 1, 2}, {2, 1, 2}, {3, 1, 2}})}});
+    const int front = level.spawn_at(0, 0, 1, 1.0);
+    const int behind = level.spawn_at(0, 0, 2, 1.0);
+    const int far = level.spawn_at(0, 0, 3, 1.0);
+    const Vector2D center{10.0, 5.0};
+    level.setEnemyPosition(front, {12.0, 5.0});
+    level.setEnemyPosition(behind, {7.0, 5.0});
+    level.setEnemyPosition(far, {20.0, 5.0});
+    const int health = level.getEnemy(front).getHealth().current;
+    std::vector<AreaHit> hits;
+    level.findEnemiesInArea(center, 1, {CONE, 4.0, 0.5}, 40, hits);
+    ASSERT_EQ(1u, hits.size());
+    EXPECT_EQ(front, hits[0].characterId);
+    EXPECT_EQ(30, hits[0].damage);
+    level.findEnemiesInArea(center, 1, {CIRCLE, 4.0, 0.0}, 10, hits);
+    std::ranges::sort(hits, {}, &AreaHit::characterId);
+    ASSERT_EQ(2u, hits.size());
+    EXPECT_EQ(front, hits[0].characterId);
+    EXPECT_EQ(behind, hits[1].characterId);
+    EXPECT_EQ(10, hits[1].damage);
+    EXPECT_EQ(health, level.getEnemy(front).getHealth().current);
+}
+
+TEST(AreaAttackTest, playerHitsTheEnemiesInFront) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    const int playerId = game.getPlayerId();
+    ASSERT_NE(-1, enemyId);
+    game.setCharacterPosition(playerId, {50.0, 50.0});
+    game.setCharacterPosition(enemyId, {51.5, 50.0});
+    const int health = game.getCharacterHealth(enemyId);
+    const AreaOfEffect area = DefinedAttacks::getAreaOfEffect("ATTACK3");
+    const int damage = area.damageAt(DefinedAttacks::get(ATTACK3).attack.getDamage(), 1.5);
+    const auto hits = game.attackArea(playerId, "ATTACK3");
+    ASSERT_EQ(1u, hits.size());
+    EXPECT_EQ(enemyId, hits[0].characterId);
+    EXPECT_EQ(damage, hits[0].damage);
+    EXPECT_EQ(std::max(0, health - damage), game.getCharacterHealth(enemyId));
+    EXPECT_TRUE(game.attackArea(playerId, "ATTACK3").empty());
+    EXPECT_THROW(game.attackArea(playerId, "ATTACK1"), std::invalid_argument);
+    EXPECT_THROW(game.attackArea(-4, "ATTACK3"), std::invalid_argument);
+}
+
+TEST(ProjectilePoolTest, holdsAFixedNumberOfProjectiles) {
+    EXPECT_THROW(ProjectilePool(0), std::invalid_argument);
+    ProjectilePool pool(2);
+    EXPECT_THROW(pool.spawn(1, false, {0.0, 0.0}, {1.0, 0.0}, -1, 1.0), std::invalid_argument);
+    EXPECT_THROW(pool.spawn(1, false, {0.0, 0.0}, {1.0, 0.0}, 10, 0.0), std::invalid_argument);
+    const int first = pool.spawn(1, false, {1.0, 2.0}, {3.0, 4.0}, 10, 1.0);
+    const int second = pool.spawn(1, true, {5.0, 6.0}, {7.0, 8.0}, 10, 1.0);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(-1, pool.spawn(1, false, {0.0, 0.0}, {1.0, 0.0}, 10, 1.0));
+    ASSERT_EQ(2u, pool.size());
+    EXPECT_EQ(second, pool.getIds()[1]);
+    EXPECT_DOUBLE_EQ(5.0, pool.getPositionsX()[1]);
+    EXPECT_DOUBLE_EQ(8.0, pool.getVelocitiesY()[1]);
+    pool.clear();
+    EXPECT_EQ(0u, pool.size());
+    EXPECT_EQ(2u, pool.getCapacity());
+}
+
+TEST(ProjectilePoolTest, projectilesStopAtTilesCharactersOrTheEndOfTheirFlight) {
+    Level level(1, {{Area(40, 1, {}, {{1, 1, 2}})}});
+    const int enemyId = level.spawn_at(0, 0, 1, 1.0);
+    level.setEnemyPosition(enemyId, {12.0, 5.0});
+    const int playerId = 424242;
+    const Vector2D playerPosition{25.0, 5.0};
+    EXPECT_NE(-1, level.fireProjectile(playerId, false, {10.0, 5.5}, {6.0, 0.0}, 20, 5.0));
+    EXPECT_NE(-1, level.fireProjectile(playerId, false, {3.0, 5.5}, {-6.0, 0.0}, 20, 5.0));
+    EXPECT_NE(-1, level.fireProjectile(playerId, false, {20.0, 5.5}, {6.0, 0.0}, 20, 0.25));
+    EXPECT_NE(-1, level.fireProjectile(enemyId, true, {24.0, 5.5}, {6.0, 0.0}, 30, 5.0));
+    std::vector<DamageHit> hits;
+    for (int i = 0; i < 10; ++i) {
+        level.stepProjectiles(0.1, std::span(&playerId, 1), std::span(&playerPosition, 1), hits);
+    }
+    EXPECT_EQ(0u, level.getProjectiles().size());
+    std::ranges::sort(hits, {}, &DamageHit::targetId);
+    ASSERT_EQ(2u, hits.size());
+    EXPECT_EQ(enemyId, hits[0].targetId);
+    EXPECT_EQ(playerId, hits[0].sourceId);
+    EXPECT_EQ(20, hits[0].damage);
+    EXPECT_EQ(playerId, hits[1].targetId);
+    EXPECT_EQ(enemyId, hits[1].sourceId);
+
+    Game game;
+    EXPECT_THROW(game.shoot(game.getPlayerId(), "ATTACK1", {1.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(game.shoot(-4, "ATTACK_SPECTRUM", {1.0, 0.0}), std::invalid_argument);
+    EXPECT_EQ(0u, game.getProjectiles().size());
+}
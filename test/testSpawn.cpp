@@ -1,3 +1,111 @@
 //
 // Created by Enzo Renard on 27/12/2024.
-//
\ No newline at end of file
+//
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "Spawn.hpp"
+#include "SpawnScheduler.hpp"
+#include "SpawnDirector.hpp"
+
+TEST(SpawnTest, nextSpawnTimeIsEpochBeforeFirstSpawn) {
+    Spawn spawn(1, 20, 40);
+    EXPECT_EQ(0, spawn.getNextSpawnTime().time_since_epoch().count());
+    spawn.spawn();
+    EXPECT_GE(spawn.getNextSpawnTime() - spawn.getLastTimeSpawned(), std::chrono::seconds(20));
+}
+
+TEST(SpawnTest, isReadyExactlyAtItsNextSpawnTime) {
+    Spawn spawn(1, 1, 1);
+    const auto start = std::chrono::steady_clock::now();
+    spawn.spawn(start);
+    const auto ready = spawn.getNextSpawnTime();
+    EXPECT_FALSE(spawn.canSpawn(ready - std::chrono::nanoseconds(1)));
+    EXPECT_TRUE(spawn.canSpawn(ready));
+    EXPECT_NO_THROW(spawn.spawn(ready));
+    EXPECT_EQ(ready, spawn.getLastTimeSpawned());
+}
+
+TEST(SpawnSchedulerTest, popsEntriesInReadyOrder) {
+    SpawnScheduler scheduler;
+    const auto now = std::chrono::steady_clock::now();
+    scheduler.schedule({0, 0, 2}, now + std::chrono::seconds(2));
+    scheduler.schedule({0, 0, 1}, now + std::chrono::seconds(1));
+    scheduler.schedule({1, 1, 3}, now + std::chrono::seconds(5));
+    EXPECT_FALSE(scheduler.hasReady(now));
+    EXPECT_TRUE(scheduler.hasReady(now + std::chrono::seconds(3)));
+    EXPECT_EQ(1, scheduler.pop().spawn.spawnId);
+    EXPECT_EQ(2, scheduler.pop().spawn.spawnId);
+    EXPECT_FALSE(scheduler.hasReady(now + std::chrono::seconds(3)));
+    EXPECT_EQ(now + std::chrono::seconds(5), scheduler.nextReadyTime());
+}
+
+TEST(SpawnSchedulerTest, compactKeepsTheLiveEntriesInOrder) {
+    SpawnScheduler scheduler;
+    const auto now = std::chrono::steady_clock::now();
+    for (int i = 0; i < 10; ++i) {
+        scheduler.schedule({0, 0, i}, now + std::chrono::seconds(10 - i));
+    }
+    scheduler.compact([](const SpawnScheduler::Entry&entry) { return entry.spawn.spawnId % 3 == 0; });
+    ASSERT_EQ(4, scheduler.size());
+    EXPECT_EQ(9, scheduler.pop().spawn.spawnId);
+    EXPECT_EQ(6, scheduler.pop().spawn.spawnId);
+    EXPECT_EQ(3, scheduler.pop().spawn.spawnId);
+    EXPECT_EQ(0, scheduler.pop().spawn.spawnId);
+}
+
+TEST(SpawnSchedulerTest, gameEmitsADrainedSpawnAgainUntilItIsUsed) {
+    Game game;
+    const auto events = game.drainSpawnEvents(1000);
+    ASSERT_FALSE(events.empty());
+    EXPECT_EQ(events.size(), game.drainSpawnEvents(1000).size());
+    EXPECT_EQ(1, game.spawnReadyEnemies(1).size());
+    EXPECT_EQ(events.size() - 1, game.drainSpawnEvents(1000).size());
+}
+
+TEST(SpawnSchedulerTest, spawnReadyEnemiesRespectsBudget) {
+    Game game;
+    const auto ids = game.spawnReadyEnemies(2);
+    EXPECT_EQ(2, ids.size());
+    for (const int id: ids) {
+        EXPECT_TRUE(game.isAValidId(id));
+    }
+    EXPECT_FALSE(game.drainSpawnEvents(1000).empty());
+}
+
+TEST(SpawnDirectorTest, firstUpdateOnlyStartsTheClock) {
+    Game game;
+    EXPECT_TRUE(game.updateSpawnDirector(SpawnDirector::DEF_MAX_SPAWNS_PER_TICK).empty());
+}
+
+TEST(SpawnDirectorTest, spendsCreditsOnWavesWithinBudget) {
+    Game game;
+    Level level = game.getActiveLevel();
+    SpawnDirector director(1.0, 2, 2);
+    const auto now = std::chrono::steady_clock::now();
+    EXPECT_TRUE(director.update(level, now, 1.0, 10).empty());
+    EXPECT_TRUE(director.update(level, now + std::chrono::seconds(1), 1.0, 10).empty());
+    const auto wave = director.update(level, now + std::chrono::seconds(5), 1.0, 10);
+    EXPECT_EQ(2, wave.size());
+    EXPECT_DOUBLE_EQ(3.0, director.getCredits());
+    EXPECT_GE(level.getEnemyCapacity(), SpawnDirector::RESERVED_ENEMIES);
+    for (const int id: wave) {
+        EXPECT_TRUE(level.isAValidEnemyId(id));
+    }
+}
+
+TEST(SpawnDirectorTest, spawnsOnItsOwnClock) {
+    Game game;
+    Level level = game.getActiveLevel();
+    SpawnDirector director(100.0, 1, 1000);
+    const auto now = std::chrono::steady_clock::now();
+    EXPECT_TRUE(director.update(level, now, 1.0, 1000).empty());
+    const auto first = director.update(level, now + std::chrono::seconds(10), 1.0, 1000);
+    ASSERT_FALSE(first.empty());
+    // An hour later on the clock of the director, the spawn points are ready again, whatever the wall clock says.
+    EXPECT_FALSE(director.update(level, now + std::chrono::hours(1), 1.0, 1000).empty());
+}
+
+TEST(SpawnDirectorTest, rejectsInvalidSettings) {
+    EXPECT_THROW(SpawnDirector(0.0, 1, 1), std::invalid_argument);
+    EXPECT_THROW(SpawnDirector(1.0, 1, 0), std::invalid_argument);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "Player.hpp"
+#include "StatusEffectPool.hpp"
+#include <unistd.h>
+
+using std::chrono::milliseconds;
+
+TEST(StatusEffectPoolTest, burnsAndExpiresInOnePass) {
+    const StatusEffectPool::TimePoint origin{};
+    StatusEffectPool pool;
+    std::vector<StatusTick> ticks;
+    EXPECT_TRUE(pool.apply(1, BURN, 3.0, origin, origin + milliseconds(1200)));
+    EXPECT_TRUE(pool.apply(2, SLOW, 0.5, origin, origin + milliseconds(700)));
+    EXPECT_TRUE(pool.apply(1, SLOW, 0.5, origin, origin + milliseconds(300)));
+    EXPECT_FALSE(pool.apply(1, BURN, 2.0, origin, origin + milliseconds(200)));
+    EXPECT_THROW(pool.apply(3, BURN, -1.0, origin, origin + milliseconds(200)), std::invalid_argument);
+    EXPECT_EQ(3u, pool.size());
+    pool.tick(origin + milliseconds(400), ticks);
+    EXPECT_TRUE(ticks.empty());
+    EXPECT_EQ(nullptr, pool.find(1, SLOW));
+    pool.tick(origin + milliseconds(1100), ticks);
+    ASSERT_EQ(1u, ticks.size());
+    EXPECT_EQ(1, ticks[0].characterId);
+    EXPECT_EQ(6, ticks[0].damage);
+    EXPECT_EQ(nullptr, pool.find(2, SLOW));
+    pool.tick(origin + std::chrono::seconds(5), ticks);
+    EXPECT_TRUE(ticks.empty());
+    EXPECT_EQ(0u, pool.size());
+}
+
+TEST(StatusEffectPoolTest, gameAppliesEffectsInBatch) {
+    Game game;
+    const auto [area, spawnId] = game.getExistingSpawn();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(std::get<0>(area), std::get<1>(area), spawnId);
+    ASSERT_GE(enemyId, 0);
+    const int playerId = game.getPlayerId();
+    const double runForce = game.getCharacterSpeed(playerId);
+    const int enemyHealth = game.getCharacterHealth(enemyId);
+    EXPECT_EQ(2, game.applyStatusEffect({playerId, enemyId, -3}, BURN, 5.0, 0.6));
+    EXPECT_EQ(0, game.applyStatusEffect({playerId}, 42, 5.0, 0.6));
+    EXPECT_EQ(1, game.applyStatusEffect({playerId}, SLOW, 0.5, 0.6));
+    EXPECT_EQ(1, game.applyStatusEffect({playerId}, SLOW, 0.5, 0.6));
+    EXPECT_DOUBLE_EQ(runForce * 0.5, game.getCharacterSpeed(playerId));
+    EXPECT_GT(game.getCharacterStatusEffectTime(playerId, SLOW), 0.0);
+    EXPECT_DOUBLE_EQ(0.0, game.getCharacterStatusEffectTime(enemyId, SLOW));
+    EXPECT_DOUBLE_EQ(-1.0, game.getCharacterStatusEffectTime(-3, SLOW));
+    std::vector<int> ids;
+    std::vector<int> types;
+    std::vector<double> times;
+    game.getStatusEffects(ids, types, times);
+    EXPECT_EQ(3u, ids.size());
+    usleep(650000);
+    game.stepPhysics(0.0);
+    EXPECT_EQ(enemyHealth - 5, game.getCharacterHealth(enemyId));
+    EXPECT_EQ(Player::DEF_MAX_HEALTH - 5, game.getPlayerCurrentHealth());
+    EXPECT_DOUBLE_EQ(runForce, game.getCharacterSpeed(playerId));
+    game.getStatusEffects(ids, types, times);
+    EXPECT_TRUE(ids.empty());
+}
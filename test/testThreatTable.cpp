@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <unistd.h>
+#include "Game.hpp"
+#include "ThreatTable.hpp"
+
+TEST(ThreatTableTest, enemiesTargetThePlayerWithTheMostThreat) {
+    const auto start = std::chrono::steady_clock::now();
+    ThreatTable table(1.0, start);
+    EXPECT_THROW(ThreatTable(0.0), std::invalid_argument);
+    EXPECT_TRUE(table.addPlayer(1));
+    EXPECT_TRUE(table.addPlayer(2));
+    EXPECT_EQ(-1, table.getTarget(100));
+    const std::vector<DamageHit> hits{{100, 1, 50}, {1, 100, 10}, {2, 100, 30}, {1, 101, 5}, {3, 101, 99}};
+    const std::vector<DamageResult> results{{100, 40, -1, true}, {101, 104, -1, true}};
+    table.addDamage(hits, results);
+    EXPECT_EQ(2u, table.size());
+    EXPECT_EQ(2, table.getTarget(100));
+    EXPECT_EQ(1, table.getTarget(101));
+    EXPECT_DOUBLE_EQ(30.0, table.getThreat(100, 2));
+
+    // The threats halve every half-life, the leaders staying the same.
+    table.advance(start + std::chrono::seconds(2));
+    EXPECT_NEAR(7.5, table.getThreat(100, 2), 1e-4);
+    EXPECT_EQ(2, table.getTarget(100));
+    table.taunt(100, 1);
+    EXPECT_EQ(1, table.getTarget(100));
+    std::vector<int> targets;
+    table.getTargets(std::vector{100, 101, 102}, targets);
+    EXPECT_EQ((std::vector{1, 1, -1}), targets);
+
+    // Long after, far beyond a rescale of the rows, the threat is forgotten.
+    table.advance(start + std::chrono::seconds(200));
+    EXPECT_EQ(-1, table.getTarget(101));
+    table.addThreat(101, 2, 3.0);
+    EXPECT_EQ(2, table.getTarget(101));
+    EXPECT_NEAR(3.0, table.getThreat(101, 2), 1e-4);
+    table.removePlayer(2);
+    EXPECT_EQ(-1, table.getTarget(101));
+    table.removeEnemy(100);
+    EXPECT_EQ(1u, table.size());
+    EXPECT_EQ(0.0, table.getThreat(100, 1));
+}
+
+TEST(ThreatTableTest, hurtingAnEnemyDrawsItAwayFromTheNearestPlayer) {
+    Game game;
+    const int hostId = game.getPlayerId();
+    const int guestId = game.addPlayer(0, 1, 2);
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    const double follow = game.getEnemyFollowRange(enemyId);
+    const double reach = game.getEnemyAttackRange(enemyId);
+    game.setCharacterPosition(enemyId, {50.0, 5.0});
+    game.setCharacterPosition(hostId, {50.0 - reach / 2, 5.0});
+    game.setCharacterPosition(guestId, {50.0 + (follow + reach) / 2, 5.0});
+    EXPECT_EQ(hostId, game.getEnemyTarget(enemyId));
+    game.attack(guestId, game.getCharacter(guestId).getAttackAt(0).getName(), enemyId);
+    EXPECT_GT(game.getThreat(enemyId, guestId), 0.0);
+    EXPECT_EQ(guestId, game.getEnemyTarget(enemyId));
+    game.updateEnemyAI();
+    EXPECT_EQ(1.0, game.getCharacter(enemyId).getRunInput());
+    EXPECT_TRUE(game.taunt(hostId, enemyId));
+    EXPECT_FALSE(game.taunt(enemyId, hostId));
+    std::vector<int> ids;
+    std::vector<int> targets;
+    game.getEnemyTargets(ids, targets);
+    ASSERT_EQ(ids.size(), targets.size());
+    EXPECT_EQ(hostId, targets[std::ranges::find(ids, enemyId) - ids.begin()]);
+    EXPECT_EQ(-1, game.getEnemyTarget(hostId));
+}
+
+TEST(ThreatTableTest, playersGainTheThreatOfTheDamageDealt) {
+    ThreatTable table;
+    table.addPlayer(1);
+    table.addPlayer(2);
+    const std::vector<DamageHit> hits{{1, 100, 10}, {2, 100, 30}, {1, 101, 5}, {2, 102, 8}};
+    // The first target takes half the damage, the second one is dead and has no result.
+    const std::vector<DamageResult> results{{100, 20, -1, true}, {102, 8, -1, true}};
+    table.addDamage(hits, results);
+    EXPECT_NEAR(5.0, table.getThreat(100, 1), 1e-4);
+    EXPECT_NEAR(15.0, table.getThreat(100, 2), 1e-4);
+    EXPECT_EQ(-1, table.getTarget(101));
+    EXPECT_NEAR(8.0, table.getThreat(102, 2), 1e-4);
+    EXPECT_EQ(2u, table.size());
+}
+
+TEST(ThreatTableTest, enemiesKilledByABurnLoseTheirThreat) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    ASSERT_TRUE(game.taunt(playerId, enemyId));
+    EXPECT_GT(game.getThreat(enemyId, playerId), 0.0);
+    ASSERT_EQ(1, game.applyStatusEffect({enemyId}, BURN, game.getCharacterHealth(enemyId), 0.6));
+    usleep(650000);
+    game.stepPhysics(0.0);
+    EXPECT_EQ(0, game.getCharacterHealth(enemyId));
+    EXPECT_DOUBLE_EQ(0.0, game.getThreat(enemyId, playerId));
+}
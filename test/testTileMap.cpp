@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include <tuple>
+#include "Game.hpp"
+#include "TileMap.hpp"
+
+namespace {
+    constexpr int SIZE = 32;
+
+    TileMap buildCrossroad() {
+        const Area area(40, 2, {Direction::UP, Direction::RIGHT, Direction::DOWN, Direction::LEFT},
+                        {{1, 20, 40}, {2, 20, 40}}, {Chest(1)});
+        return {{{area}, {Area(0, 1, {})}}, SIZE};
+    }
+}
+
+TEST(TileTest, packsFlagsTextureAndObjectSlot) {
+    constexpr Tile tile(false, true, ID2, 17);
+    EXPECT_FALSE(tile.isSolid());
+    EXPECT_TRUE(tile.isFloor());
+    EXPECT_EQ(ID2, tile.getTexture());
+    EXPECT_EQ(17, tile.getObjectSlot());
+    EXPECT_EQ(tile, Tile::fromBits(tile.getBits()));
+    EXPECT_TRUE(Tile(true, false, ID1).isFloor());
+    EXPECT_EQ(2u, sizeof(Tile));
+}
+
+TEST(TileMapTest, opensTheWallsAtTheGateways) {
+    const TileMap map = buildCrossroad();
+    EXPECT_EQ(2 * SIZE, map.getWidth());
+    EXPECT_EQ(SIZE, map.getHeight());
+    EXPECT_TRUE(map.at(0, 10).isSolid());
+    EXPECT_FALSE(map.at(0, 2).isSolid());
+    EXPECT_FALSE(map.at(SIZE / 2, 0).isSolid());
+    EXPECT_TRUE(map.at(2, 0).isSolid());
+    EXPECT_FALSE(map.at(SIZE / 2, SIZE - 1).isSolid());
+    EXPECT_TRUE(map.at(SIZE / 2, 5).isFloor());
+    EXPECT_FALSE(map.at(SIZE / 2, 5).isSolid());
+    EXPECT_TRUE(map.at(SIZE + 5, 5).isSolid());
+    EXPECT_TRUE(map.at(-1, 5).isSolid());
+    EXPECT_LT(map.getRunCount(), 4u * SIZE);
+    EXPECT_LT(map.getMemoryUsage(), 2u * SIZE * SIZE * sizeof(Tile));
+}
+
+TEST(TileMapTest, placesObjectsOnTheFloor) {
+    const TileMap map = buildCrossroad();
+    const auto spawn = map.getObject(0, 0, InterractiveObjectKind::SPAWN, 2);
+    EXPECT_EQ(1, spawn.getTileY());
+    const auto found = map.getObjectAt(spawn.getTileX(), spawn.getTileY());
+    EXPECT_EQ(InterractiveObjectKind::SPAWN, found.getKind());
+    EXPECT_EQ(2, found.getId());
+    const auto chest = map.getObject(0, 0, InterractiveObjectKind::CHEST, 1);
+    EXPECT_EQ(InterractiveObjectKind::CHEST, map.getObjectAt(chest.getTileX(), chest.getTileY()).getKind());
+    EXPECT_NE(chest.getTileX(), spawn.getTileX());
+    EXPECT_EQ(InterractiveObjectKind::NONE, map.getObjectAt(3, 3).getKind());
+    EXPECT_THROW(std::ignore = map.getObject(0, 0, InterractiveObjectKind::SPAWN, 9), std::invalid_argument);
+}
+
+TEST(TileMapTest, answersPointAndBoxQueries) {
+    const TileMap map = buildCrossroad();
+    EXPECT_FALSE(map.isSolidAt({4.5, 4.5}));
+    EXPECT_TRUE(map.isSolidAt({4.5, 0.5}));
+    EXPECT_FALSE(map.overlapsSolid({{2.0, 1.0}, {4.0, 3.0}}));
+    EXPECT_TRUE(map.overlapsSolid({{2.0, 0.5}, {4.0, 3.0}}));
+    EXPECT_TRUE(map.overlapsSolid({{SIZE - 2.0, 10.0}, {SIZE + 1.0, 11.0}}));
+    EXPECT_TRUE(map.overlapsSolid({{-1.0, 2.0}, {1.0, 3.0}}));
+}
+
+TEST(TileMapTest, findsTheGroundBelowAPoint) {
+    const TileMap map = buildCrossroad();
+    EXPECT_DOUBLE_EQ(1.0, map.getGroundHeight({4.5, 3.0}));
+    EXPECT_DOUBLE_EQ(1.0, map.getGroundHeight({4.5, 1.0}));
+    EXPECT_DOUBLE_EQ(6.0, map.getGroundHeight({SIZE / 2 + 0.5, 8.0}));
+    EXPECT_DOUBLE_EQ(0.0, map.getGroundHeight({SIZE / 2 + 0.5, 4.0}));
+}
+
+TEST(TileMapTest, levelsSpawnEnemiesOnTheirSpawnTile) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    Vector2D position{};
+    ASSERT_TRUE(game.getCharacterPosition(enemyId, position));
+    const Tile below = game.getTileAt(static_cast<int>(position.x), static_cast<int>(position.y) - 1);
+    EXPECT_TRUE(below.isSolid());
+    EXPECT_GT(game.getTileAt(static_cast<int>(position.x), static_cast<int>(position.y)).getObjectSlot(), 0);
+}
+
+TEST(RaycastTest, stopsAtTheFirstSolidTile) {
+    const TileMap map = buildCrossroad();
+    const RayHit hit = map.raycast({{4.5, 10.5}, {SIZE + 4.5, 10.5}});
+    EXPECT_TRUE(hit.blocked);
+    EXPECT_EQ(SIZE - 1, hit.tileX);
+    EXPECT_EQ(10, hit.tileY);
+    EXPECT_DOUBLE_EQ(SIZE - 1.0, hit.point.x);
+    EXPECT_DOUBLE_EQ(SIZE - 1.0 - 4.5, hit.distance);
+}
+
+TEST(RaycastTest, passesThroughOpenTiles) {
+    const TileMap map = buildCrossroad();
+    EXPECT_TRUE(map.hasLineOfSight({2.5, 2.5}, {20.5, 12.5}));
+    EXPECT_FALSE(map.hasLineOfSight({-0.5, 2.5}, {4.5, 2.5}));
+    EXPECT_TRUE(map.hasLineOfSight({SIZE / 2.0, 2.5}, {SIZE / 2.0, SIZE - 0.5}));
+    EXPECT_FALSE(map.hasLineOfSight({4.5, 2.5}, {4.5, -3.0}));
+    EXPECT_TRUE(map.hasLineOfSight({4.5, 2.5}, {4.5, 2.5}));
+}
+
+TEST(RaycastTest, castsBatchesInOrder) {
+    const TileMap map = buildCrossroad();
+    const std::vector<RaySegment> rays{
+        {{4.5, 2.5}, {10.5, 2.5}}, {{4.5, 2.5}, {4.5, 0.5}}, {{10.5, 20.5}, {3.5, 3.5}}
+    };
+    std::vector<std::uint8_t> visible;
+    map.hasLineOfSight(rays, visible);
+    EXPECT_EQ((std::vector<std::uint8_t>{1, 0, 1}), visible);
+    std::vector<RayHit> hits;
+    map.raycast(rays, hits);
+    ASSERT_EQ(3u, hits.size());
+    EXPECT_TRUE(hits[1].blocked);
+    EXPECT_EQ(0, hits[1].tileY);
+}
+
+TEST(RaycastTest, enemiesReachThePlayerInRangeAndInSight) {
+    Game game;
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    const int playerId = game.getPlayerId();
+    ASSERT_NE(-1, enemyId);
+    Vector2D position{};
+    ASSERT_TRUE(game.getCharacterPosition(enemyId, position));
+    game.setCharacterPosition(playerId, {position.x + game.getEnemyAttackRange(enemyId) / 2, position.y});
+    EXPECT_TRUE(game.canCharacterReach(enemyId, playerId));
+    EXPECT_TRUE(game.canCharacterReach(playerId, enemyId));
+    EXPECT_EQ(std::vector<int>{enemyId}, game.getEnemiesInReach(playerId));
+    // Under the floor of the area: in range, but hidden by the floor tiles.
+    game.setCharacterPosition(playerId, {position.x, position.y - 1.6});
+    EXPECT_FALSE(game.canCharacterReach(enemyId, playerId));
+    EXPECT_FALSE(game.canCharacterReach(playerId, enemyId));
+    EXPECT_TRUE(game.getEnemiesInReach(playerId).empty());
+    EXPECT_EQ(0, game.updateEnemyAI());
+    game.setCharacterPosition(playerId, {position.x + game.getEnemyFollowRange(enemyId), position.y});
+    EXPECT_FALSE(game.canCharacterReach(enemyId, playerId));
+    game.setCharacterPosition(playerId, {position.x + game.getEnemyAttackRange(enemyId) / 2, position.y});
+    EXPECT_EQ(1, game.updateEnemyAI());
+}
+
+TEST(RaycastTest, charactersOutOfTheRangeOfTheGridAreNeverInReach) {
+    Game game;
+    const int playerId = game.getPlayerId();
+    const int enemyId = game.ifCanSpawnCurrentLevelSpawnAt(1, 1, 1);
+    ASSERT_NE(-1, enemyId);
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (const Vector2D&position: {Vector2D{nan, 5.0}, Vector2D{1e300, -1e300}, Vector2D{-INF, INF}}) {
+        game.setCharacterPosition(playerId, position);
+        EXPECT_NO_THROW(game.stepPhysics(KinematicIntegrator::DEF_TIMESTEP));
+        EXPECT_FALSE(game.canCharacterReach(enemyId, playerId));
+        EXPECT_FALSE(game.canCharacterReach(playerId, enemyId));
+        EXPECT_TRUE(game.getEnemiesInReach(playerId).empty());
+        EXPECT_TRUE(game.overlapsSolidTile({position, position}));
+        EXPECT_TRUE(game.raycast({{5.5, 5.5}, position}).blocked);
+    }
+}
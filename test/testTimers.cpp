@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+#include "Game.hpp"
+#include "CooldownTable.hpp"
+#include "Dash.hpp"
+#include "Enemies.hpp"
+#include "TimerWheel.hpp"
+#include <random>
+#include <unistd.h>
+
+namespace {
+    using std::chrono::milliseconds;
+
+    std::vector<int> drainedIds(TimerWheel&wheel, const TimerWheel::TimePoint now) {
+        std::vector<TimerEvent> due;
+        wheel.advance(now, due);
+        std::vector<int> ids;
+        for (const TimerEvent&event: due) {
+            ids.push_back(event.characterId);
+        }
+        return ids;
+    }
+}
+
+TEST(TimerWheelTest, firesEventsInOrderOnceDue) {
+    const TimerWheel::TimePoint origin{};
+    TimerWheel wheel(origin);
+    wheel.schedule({3, HURT_ENDED, -1}, origin + milliseconds(5000));
+    wheel.schedule({1, ATTACK_ENDED, 0}, origin + milliseconds(5));
+    wheel.schedule({2, ATTACK_READY, 0}, origin + milliseconds(70));
+    wheel.schedule({4, MOVEMENT_READY, DASH}, origin + std::chrono::minutes(20));
+    EXPECT_EQ(4u, wheel.size());
+    EXPECT_TRUE(drainedIds(wheel, origin + milliseconds(4)).empty());
+    EXPECT_EQ(std::vector<int>{1}, drainedIds(wheel, origin + milliseconds(5)));
+    EXPECT_EQ((std::vector<int>{2, 3}), drainedIds(wheel, origin + milliseconds(6000)));
+    EXPECT_TRUE(drainedIds(wheel, origin + std::chrono::minutes(19)).empty());
+    EXPECT_EQ(std::vector<int>{4}, drainedIds(wheel, origin + std::chrono::minutes(20)));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, keepsEventsBeyondItsSpanAndLateEvents) {
+    const TimerWheel::TimePoint origin{};
+    TimerWheel wheel(origin);
+    wheel.schedule({1, JETPACK_READY, JETPACK}, origin + std::chrono::hours(10));
+    EXPECT_TRUE(drainedIds(wheel, origin + std::chrono::hours(9)).empty());
+    wheel.schedule({2, HURT_ENDED, -1}, origin);
+    EXPECT_EQ(std::vector<int>{2}, drainedIds(wheel, origin + std::chrono::hours(9) + milliseconds(1)));
+    EXPECT_EQ(std::vector<int>{1}, drainedIds(wheel, origin + std::chrono::hours(10)));
+    wheel.schedule({3, HURT_ENDED, -1}, origin + std::chrono::hours(11));
+    wheel.clear();
+    EXPECT_TRUE(drainedIds(wheel, origin + std::chrono::hours(12)).empty());
+}
+
+TEST(TimerWheelTest, jumpsOverEmptySlotsInOrder) {
+    const TimerWheel::TimePoint origin{};
+    TimerWheel wheel(origin);
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<long> delay(0, 2 * TimerWheel::HORIZON);
+    std::vector<long> dues;
+    for (int id = 0; id < 500; ++id) {
+        dues.push_back(delay(gen));
+        wheel.schedule({id, HURT_ENDED, -1}, origin + milliseconds(dues.back()));
+    }
+    // Long advances, each across many empty slots and several cascades.
+    std::vector<int> drained;
+    for (long now = 0; now < 2 * static_cast<long>(TimerWheel::HORIZON) + 987654; now += 987654) {
+        const std::vector<int> ids = drainedIds(wheel, origin + milliseconds(now));
+        for (const int id: ids) {
+            EXPECT_LE(dues[id], now);
+        }
+        drained.insert(drained.end(), ids.begin(), ids.end());
+    }
+    ASSERT_EQ(dues.size(), drained.size());
+    for (std::size_t i = 1; i < drained.size(); ++i) {
+        EXPECT_LE(dues[drained[i - 1]], dues[drained[i]]);
+    }
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, gameReportsTheEndOfADash) {
+    Game game;
+    const int id = game.getPlayerId();
+    game.move(id, "DASH");
+    EXPECT_TRUE(game.drainTimerEvents(10).empty());
+    usleep((Dash::DEF_ANIMATION_TIME + 0.05) * 1000000);
+    EXPECT_TRUE(game.drainTimerEvents(0).empty());
+    const auto events = game.drainTimerEvents(10);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(id, events[0].characterId);
+    EXPECT_EQ(MOVEMENT_ENDED, events[0].type);
+    EXPECT_EQ(DASH, events[0].capability);
+    EXPECT_TRUE(game.drainTimerEvents(10).empty());
+}
+
+TEST(RemainingTimeTest, followsTheCooldownsAndTheBusyState) {
+    Game game;
+    const int id = game.getPlayerId();
+    std::vector<double> times;
+    ASSERT_TRUE(game.getCharacterRemainingTimes(id, times));
+    ASSERT_EQ(Character::REMAINING_TIME_COUNT, times.size());
+    const std::span<const double> movements(times.data() + DefinedAttacks::size(), DefinedMovements::size());
+    EXPECT_DOUBLE_EQ(0.0, movements[DASH]);
+    EXPECT_DOUBLE_EQ(0.0, times.back());
+    EXPECT_DOUBLE_EQ(Character::NO_CAPABILITY, times[ATTACK_SPECTRUM]);
+    game.move(id, "DASH");
+    game.getCharacterRemainingTimes(id, times);
+    EXPECT_GT(movements[DASH], Dash::DEF_COOLDOWN);
+    EXPECT_LE(movements[DASH], Dash::DEF_COOLDOWN + Dash::DEF_ANIMATION_TIME);
+    EXPECT_GT(movements[RUN], 0.0);
+    for (const std::string&attack: Player().getAllAttackName()) {
+        EXPECT_GT(times[DefinedAttacks::getAttackValue(attack)], 0.0);
+    }
+    EXPECT_FALSE(game.getCharacterRemainingTimes(-5, times));
+    EXPECT_TRUE(times.empty());
+}
+
+TEST(RemainingTimeTest, coversEveryCharacterAtOnce) {
+    Game game;
+    std::vector<int> ids;
+    std::vector<double> times;
+    game.getRemainingTimes(ids, times);
+    ASSERT_FALSE(ids.empty());
+    EXPECT_EQ(game.getPlayerId(), ids[0]);
+    EXPECT_EQ(game.getEnemyIds().size() + 1, ids.size());
+    EXPECT_EQ(ids.size() * Character::REMAINING_TIME_COUNT, times.size());
+}
+
+TEST(RemainingTimeTest, reportsThePhaseOfTheLastAttack) {
+    Game game;
+    const int id = game.getPlayerId();
+    std::vector<int> ids;
+    std::vector<AttackState> states;
+    game.getAttackStates(ids, states);
+    ASSERT_EQ(ids.size(), states.size());
+    EXPECT_EQ(-1, states[0].attack);
+    EXPECT_EQ(IDLE, states[0].phase);
+    game.attack(id, "ATTACK1", -1);
+    game.getAttackStates(ids, states);
+    EXPECT_EQ(ATTACK1, states[0].attack);
+    EXPECT_NE(IDLE, states[0].phase);
+    EXPECT_NE(COOLDOWN, states[0].phase);
+    usleep(0.1 * 1000000);
+    const auto events = game.drainTimerEvents(10);
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(ATTACK_CHARGED, events[0].type);
+    EXPECT_EQ(ATTACK1, events[0].capability);
+}
+
+TEST(CooldownTableTest, masksFollowTheReadyAtTicks) {
+    const auto now = std::chrono::steady_clock::now();
+    CooldownTable table(now);
+    Enemy spectrum = DefinedEnemies::get(SPECTRUM).enemy;
+    table.update(0, spectrum, now);
+    table.computeMasks(now);
+    const CooldownTable::Mask attack = CooldownTable::bit(ATTACK_SPECTRUM);
+    const CooldownTable::Mask run = CooldownTable::bit(DefinedAttacks::size() + RUN);
+    EXPECT_EQ(attack, table.getMask(0) & CooldownTable::attackBits());
+    EXPECT_TRUE(table.getMask(0) & run);
+    EXPECT_FALSE(table.getMask(0) & CooldownTable::bit(DefinedAttacks::size() + CLIMB));
+    spectrum.attack("ATTACK_SPECTRUM");
+    table.update(0, spectrum, now);
+    table.computeMasks(now);
+    EXPECT_FALSE(table.getMask(0) & attack);
+    table.computeMasks(now + std::chrono::seconds(8));
+    EXPECT_TRUE(table.getMask(0) & attack);
+    EXPECT_THROW(table.update(5, spectrum, now), std::out_of_range);
+}
+
+TEST(CooldownTableTest, levelKeepsTheMasksOfItsEnemies) {
+    Level level(1, {{Area(40, 1, {}, {{1, 1, 2}})}});
+    const int id = level.spawn_at(0, 0, 1, 1.0);
+    level.updateReadiness(std::chrono::steady_clock::now());
+    std::vector<int> ids;
+    std::vector<CooldownTable::Mask> masks;
+    level.getEnemyReadiness(ids, masks);
+    ASSERT_EQ(std::vector<int>{id}, ids);
+    EXPECT_NE(0, masks[0] & CooldownTable::attackBits());
+    const Vector2D position = level.getEnemy(id).getPosition();
+    EXPECT_EQ(std::vector<int>{id}, level.getEnemiesReadyToAttack(position));
+    for (const std::string&attack: level.getEnemy(id).getAllAttackName()) {
+        level.attackEnemy(id, attack);
+    }
+    level.updateReadiness(std::chrono::steady_clock::now());
+    EXPECT_TRUE(level.getEnemiesReadyToAttack(position).empty());
+}